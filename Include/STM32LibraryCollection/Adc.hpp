@@ -6,7 +6,10 @@
 
 #include <algorithm>
 #include <array>
-#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
 #include <utility>
 
 #include "__Internal/__Utility.hpp"
@@ -201,6 +204,223 @@ concept IsAdcTimeout =
     __Internal::__IsConstant<T> &&
     std::same_as<typename T::ValueTypeT, std::uint32_t>;
 
+/**
+ * @namespace AdcFilter, Tag types for ADC filter engine selection.
+ *
+ * The filter engine determines how the median of AdcMedianFilterSize samples is obtained.
+ */
+namespace AdcFilter {
+
+/**
+ * @struct Median, Tag for a burst median filter.
+ *
+ * Each Get() call takes AdcMedianFilterSize samples and returns their median.
+ * Sizes 1, 3, 5, 7 and 9 use a branchless compile-time selection network,
+ * larger sizes use a linear-time selection algorithm.
+ */
+struct Median { };
+
+/**
+ * @struct RunningMedian, Tag for a sliding-window median filter.
+ *
+ * Each Get() call takes a single sample and returns the median of the last
+ * AdcMedianFilterSize samples. The window is kept across calls and updated in O(N).
+ *
+ * @note Get() is non-const with this filter, since it updates the window.
+ */
+struct RunningMedian { };
+
+} /* namespace AdcFilter */
+
+/**
+ * @brief IsAdcFilter, A concept to check if a type is a AdcFilter.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Adc.hpp>
+ *
+ * static_assert(STM32::IsAdcFilter<STM32::AdcFilter::RunningMedian>);
+ * static_assert(!STM32::IsAdcFilter<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsAdcFilter =
+    std::same_as<T, AdcFilter::Median> ||
+    std::same_as<T, AdcFilter::RunningMedian>;
+
+namespace __Internal {
+
+/**
+ * @brief Compare-exchange pairs of median selection networks.
+ *
+ * After applying all pairs (lower value to the first index), the median is at index SizeV / 2.
+ * Only sizes with a network are defined, see __HasMedianNetwork.
+ */
+template <std::size_t SizeV>
+struct __MedianNetwork;
+
+template <>
+struct __MedianNetwork<1> {
+    static constexpr std::array<std::pair<std::uint8_t, std::uint8_t>, 0> pairs{};
+};
+
+template <>
+struct __MedianNetwork<3> {
+    static constexpr std::array<std::pair<std::uint8_t, std::uint8_t>, 3> pairs{{
+        {0, 1}, {1, 2}, {0, 1}
+    }};
+};
+
+template <>
+struct __MedianNetwork<5> {
+    static constexpr std::array<std::pair<std::uint8_t, std::uint8_t>, 7> pairs{{
+        {0, 1}, {3, 4}, {0, 3}, {1, 4}, {1, 2}, {2, 3}, {1, 2}
+    }};
+};
+
+template <>
+struct __MedianNetwork<7> {
+    static constexpr std::array<std::pair<std::uint8_t, std::uint8_t>, 13> pairs{{
+        {0, 5}, {0, 3}, {1, 6}, {2, 4}, {0, 1}, {3, 5}, {2, 6},
+        {2, 3}, {3, 6}, {4, 5}, {1, 4}, {1, 3}, {3, 4}
+    }};
+};
+
+template <>
+struct __MedianNetwork<9> {
+    static constexpr std::array<std::pair<std::uint8_t, std::uint8_t>, 19> pairs{{
+        {1, 2}, {4, 5}, {7, 8}, {0, 1}, {3, 4}, {6, 7}, {1, 2}, {4, 5}, {7, 8}, {0, 3},
+        {5, 8}, {4, 7}, {3, 6}, {1, 4}, {2, 5}, {4, 7}, {4, 2}, {6, 4}, {4, 2}
+    }};
+};
+
+/**
+ * @brief Checks if a median selection network exists for a window size.
+ */
+template <std::size_t SizeV>
+concept __HasMedianNetwork = requires {
+    __MedianNetwork<SizeV>::pairs;
+};
+
+/**
+ * @brief Branchless compare-exchange, the lower value ends up in low.
+ */
+constexpr void __CompareExchange(std::uint16_t& low, std::uint16_t& high) noexcept
+{
+    const auto minimum = std::min(low, high);
+    high = std::max(low, high);
+    low = minimum;
+}
+
+/**
+ * @brief Apply a median selection network, fully unrolled at compile time.
+ */
+template <std::size_t SizeV, std::size_t... IndexV>
+constexpr void __ApplyMedianNetwork(
+    std::array<std::uint16_t, SizeV>& values,
+    std::index_sequence<IndexV...>
+) noexcept
+{
+    constexpr auto& pairs = __MedianNetwork<SizeV>::pairs;
+    (__CompareExchange(values[pairs[IndexV].first], values[pairs[IndexV].second]), ...);
+}
+
+/**
+ * @brief Select the median of the first size values.
+ *
+ * @param values    Samples, reordered in place.
+ * @param size      Number of valid samples (1 to SizeV).
+ *
+ * @returns Median value (upper median for even sizes).
+ */
+template <std::size_t SizeV>
+constexpr std::uint16_t __Median(std::array<std::uint16_t, SizeV>& values, std::size_t size) noexcept
+{
+    if constexpr (__HasMedianNetwork<SizeV>) {
+        if (size == SizeV) {
+            __ApplyMedianNetwork(
+                values,
+                std::make_index_sequence<__MedianNetwork<SizeV>::pairs.size()>{}
+            );
+            return values[SizeV / 2];
+        }
+    }
+    const auto middle = values.begin() + static_cast<std::ptrdiff_t>(size / 2);
+    std::ranges::nth_element(values.begin(), middle, values.begin() + static_cast<std::ptrdiff_t>(size));
+    return *middle;
+}
+
+/**
+ * @class __RunningMedian, Sliding-window median with O(N) update.
+ *
+ * Keeps the window both in arrival order (to know the oldest sample) and in
+ * sorted order (to read the median). An update replaces the oldest sample in the
+ * sorted window and shifts it into place, instead of sorting the whole window.
+ *
+ * @tparam SizeV    Window size (odd).
+ *
+ * @note The window is primed with the first sample, so the first updates
+ *       already return a valid reading.
+ */
+template <std::size_t SizeV>
+class __RunningMedian {
+public:
+
+    /**
+     * @brief Insert a sample, dropping the oldest one.
+     *
+     * @param sample    New sample.
+     *
+     * @returns Median of the window.
+     */
+    constexpr std::uint16_t Update(std::uint16_t sample) noexcept
+    {
+        if (!m_is_primed) {
+            m_history.fill(sample);
+            m_sorted.fill(sample);
+            m_is_primed = true;
+            return sample;
+        }
+        const auto oldest = m_history[m_index];
+        m_history[m_index] = sample;
+        m_index = (m_index + 1 == SizeV) ? 0 : m_index + 1;
+
+        auto position = static_cast<std::size_t>(std::ranges::find(m_sorted, oldest) - m_sorted.begin());
+        for (; position > 0 && m_sorted[position - 1] > sample; --position) {
+            m_sorted[position] = m_sorted[position - 1];
+        }
+        for (; position + 1 < SizeV && m_sorted[position + 1] < sample; ++position) {
+            m_sorted[position] = m_sorted[position + 1];
+        }
+        m_sorted[position] = sample;
+        return m_sorted[SizeV / 2];
+    }
+
+    /**
+     * @brief Discard the window, the next sample primes it again.
+     */
+    constexpr void Reset() noexcept
+    {
+        m_is_primed = false;
+        m_index = 0;
+    }
+
+private:
+    std::array<std::uint16_t, SizeV> m_history{};
+    std::array<std::uint16_t, SizeV> m_sorted{};
+    std::size_t m_index{};
+    bool m_is_primed{};
+};
+
+/**
+ * @brief Empty filter state for stateless filter engines.
+ */
+struct __NoFilterState { };
+
+} /* namespace __Internal */
+
 /**
  * @struct AdcConfig, A utility struct to bundle all ADC configuration parameters.
  * 
@@ -208,6 +428,7 @@ concept IsAdcTimeout =
  * @tparam AdcResolutionT       Hardware resolution (8, 10, or 12 bit).
  * @tparam AdcMedianFilterSizeT Median filter sample count.
  * @tparam AdcTimeoutT          Conversion timeout in milliseconds.
+ * @tparam AdcFilterT           Filter engine (default is AdcFilter::Median).
  *
  * @example Usage:
  * @code {.cpp}
@@ -218,19 +439,30 @@ concept IsAdcTimeout =
  *     STM32::AdcMedianFilterSize<5>,
  *     STM32::AdcTimeout<1000>
  * >;
+ *
+ * // Same, but one sample per Get() with a 9-sample sliding window
+ * using MyRunningAdcConfig = STM32::AdcConfig<
+ *     STM32::AdcOutputMax<100>,
+ *     STM32::AdcResolution::Resolution12Bit,
+ *     STM32::AdcMedianFilterSize<9>,
+ *     STM32::AdcTimeout<1000>,
+ *     STM32::AdcFilter::RunningMedian
+ * >;
  * @endcode
  */
 template <
     IsAdcOutputMax AdcOutputMaxT,
     IsAdcResolution AdcResolutionT,
     IsAdcMedianFilterSize AdcMedianFilterSizeT,
-    IsAdcTimeout AdcTimeoutT
+    IsAdcTimeout AdcTimeoutT,
+    IsAdcFilter AdcFilterT = AdcFilter::Median
 >
 struct AdcConfig : AdcOutputMaxT, AdcResolutionT, AdcMedianFilterSizeT, AdcTimeoutT {
     using OutputRangeT = AdcOutputMaxT;
     using ResolutionT = AdcResolutionT;
     using MedianFilterSizeT = AdcMedianFilterSizeT;
     using TimeoutT = AdcTimeoutT;
+    using FilterT = AdcFilterT;
 };
 
 /**
@@ -257,11 +489,13 @@ concept IsAdcConfig =
     IsAdcResolution<typename T::ResolutionT> &&
     IsAdcMedianFilterSize<typename T::MedianFilterSizeT> &&
     IsAdcTimeout<typename T::TimeoutT> &&
+    IsAdcFilter<typename T::FilterT> &&
     requires {
         typename T::OutputRangeT;
         typename T::ResolutionT;
         typename T::MedianFilterSizeT;
         typename T::TimeoutT;
+        typename T::FilterT;
         T::OutputRangeT::max_value;
         T::ResolutionT::resolution;
     };
@@ -274,6 +508,9 @@ concept IsAdcConfig =
  *
  * @note Adc class is non-copyable and non-movable.
  * @note Uses blocking polling mode for ADC conversion.
+ * @note Scaling to the output range uses compile-time fixed-point arithmetic,
+ *       no floating-point operations are performed at runtime.
+ * @note For continuous multi-channel DMA sampling, use AdcStream (AdcStream.hpp).
  *
  * @example Usage:
  * @code {.cpp}
@@ -355,23 +592,15 @@ public:
     [[nodiscard]]
     std::uint32_t GetRaw() const noexcept
     {
-        if (HAL_ADC_Start(&m_handle) != HAL_OK){
-            return 0;
-        }
-        if (HAL_ADC_PollForConversion(&m_handle , AdcConfigT::TimeoutT::value) != HAL_OK){
-            HAL_ADC_Stop(&m_handle);
-            return 0;
-        }
-        const auto adc_value = HAL_ADC_GetValue(&m_handle);
-        HAL_ADC_Stop(&m_handle);
-        return adc_value;
+        std::uint16_t adc_value{};
+        return Sample(adc_value) ? adc_value : 0;
     }
 
     /**
      * @brief Get filtered and scaled ADC value.
      * 
-     * Takes multiple samples (defined by MedianFilterSizeT), sorts them,
-     * and returns the median value scaled to the configured output range.
+     * Takes multiple samples (defined by MedianFilterSizeT) and returns
+     * their median scaled to the configured output range.
      * 
      * @returns Scaled ADC value (0 to AdcOutputMax), or 0 on error.
      * 
@@ -381,44 +610,112 @@ public:
      */
     [[nodiscard]]
     std::uint32_t Get() const noexcept
+    requires (std::same_as<typename AdcConfigT::FilterT, AdcFilter::Median>)
     {
-        std::array<std::uint32_t, AdcConfigT::MedianFilterSizeT::value> adc_values{};
+        std::array<std::uint16_t, AdcConfigT::MedianFilterSizeT::value> adc_values{};
         std::size_t filled_size{};
         for (std::size_t i{}; i < adc_values.size(); ++i){
-            if (HAL_ADC_Start(&m_handle) != HAL_OK){
-                continue;
-            }
-            if (HAL_ADC_PollForConversion(&m_handle , AdcConfigT::TimeoutT::value) == HAL_OK){
-                adc_values[filled_size++] = ConvertToOutput(HAL_ADC_GetValue(&m_handle));
-            }
-            HAL_ADC_Stop(&m_handle);
+            filled_size += Sample(adc_values[filled_size]);
         }
         if (filled_size == 0){
             return 0;
         }
-        std::ranges::sort(adc_values.begin(), adc_values.begin() + filled_size);
-        return adc_values[filled_size / 2];
+        return ConvertToOutput(__Internal::__Median(adc_values, filled_size));
+    }
+
+    /**
+     * @brief Get filtered and scaled ADC value.
+     *
+     * Takes a single sample and returns the median of the last MedianFilterSizeT
+     * samples scaled to the configured output range.
+     *
+     * @returns Scaled ADC value (0 to AdcOutputMax), or 0 on error.
+     *
+     * @note Returns 0 if the ADC conversion fails; the window is left unchanged.
+     */
+    [[nodiscard]]
+    std::uint32_t Get() noexcept
+    requires (std::same_as<typename AdcConfigT::FilterT, AdcFilter::RunningMedian>)
+    {
+        std::uint16_t adc_value{};
+        if (!Sample(adc_value)){
+            return 0;
+        }
+        return ConvertToOutput(m_filter_state.Update(adc_value));
+    }
+
+    /**
+     * @brief Discard the sliding window, the next Get() starts a new one.
+     */
+    void Reset() noexcept
+    requires (std::same_as<typename AdcConfigT::FilterT, AdcFilter::RunningMedian>)
+    {
+        m_filter_state.Reset();
     }
 
 private:
+    using FilterStateT = std::conditional_t<
+        std::same_as<typename AdcConfigT::FilterT, AdcFilter::RunningMedian>,
+        __Internal::__RunningMedian<AdcConfigT::MedianFilterSizeT::value>,
+        __Internal::__NoFilterState
+    >;
+
     ADC_HandleTypeDef& m_handle;
+    [[no_unique_address]] FilterStateT m_filter_state{};
+
+    static constexpr std::uint32_t s_resolution{
+        static_cast<std::uint32_t>(AdcConfigT::ResolutionT::resolution)
+    };
+    static constexpr std::uint32_t s_output_range{
+        static_cast<std::uint32_t>(AdcConfigT::OutputRangeT::range_size)
+    };
+    static constexpr std::uint32_t s_output_min{
+        static_cast<std::uint32_t>(AdcConfigT::OutputRangeT::min_value)
+    };
+
+    static_assert(
+        s_resolution == AdcConfigT::ResolutionT::resolution &&
+        s_output_range == AdcConfigT::OutputRangeT::range_size &&
+        s_output_min == AdcConfigT::OutputRangeT::min_value,
+        "ADC resolution and output range must be non-negative integers!"
+    );
+
+    /**
+     * @brief Sample, Performs a single blocking ADC conversion.
+     *
+     * @param adc_value     Destination of the raw ADC value, written on success only.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Sample(std::uint16_t& adc_value) const noexcept
+    {
+        __Internal::__Probe<InstrumentationProbe::AdcConversion> probe{&m_handle};
+        if (probe.Finish(HAL_ADC_Start(&m_handle)) != HAL_OK){
+            return false;
+        }
+        const bool is_converted{
+            probe.Finish(
+                HAL_ADC_PollForConversion(&m_handle , AdcConfigT::TimeoutT::value),
+                sizeof(adc_value)
+            ) == HAL_OK
+        };
+        if (is_converted){
+            adc_value = static_cast<std::uint16_t>(HAL_ADC_GetValue(&m_handle));
+        }
+        HAL_ADC_Stop(&m_handle);
+        return is_converted;
+    }
 
     /**
      * @brief ConvertToOutput, Converts raw ADC value to configured output range.
      * 
      * @param adc_value     Raw ADC value.
      *
-     * @returns Converted ADC output value.
+     * @returns Converted ADC output value, rounded to nearest.
      */
-    constexpr auto ConvertToOutput(double adc_value) const noexcept
+    static constexpr std::uint32_t ConvertToOutput(std::uint32_t adc_value) noexcept
     {
-        const double scaled{
-            (adc_value * AdcConfigT::OutputRangeT::range_size) /
-            AdcConfigT::ResolutionT::resolution
-        };
-        return static_cast<std::uint32_t>(
-            std::round(scaled) + AdcConfigT::OutputRangeT::min_value
-        );
+        return __Internal::__LinearScale<s_resolution, s_output_range>::Apply(adc_value) + s_output_min;
     }
 };
 
@@ -0,0 +1,287 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_ADC_STREAM_HPP
+#define STM32_ADC_STREAM_HPP
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+#include "__Internal/__Utility.hpp"
+
+#include "main.h"
+
+#if !defined(HAL_ADC_MODULE_ENABLED) /* module check */
+#error "HAL ADC module is not enabled!"
+#endif /* module check */
+
+#if !defined(HAL_DMA_MODULE_ENABLED) /* module check */
+#error "HAL DMA module is not enabled!"
+#endif /* module check */
+
+#if (USE_HAL_ADC_REGISTER_CALLBACKS != 1) /* module check */
+#error "HAL ADC callbacks are not enabled!"
+#endif /* module check */
+
+namespace STM32 {
+
+/**
+ * @struct AdcChannelCount, A utility struct to configure the number of scanned ADC channels.
+ *
+ * @tparam CountV   Number of channels in the ADC regular sequence (ranks).
+ *
+ * @note Must match the "Number Of Conversion" setting of the ADC in CubeMX.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * using EightChannels = STM32::AdcChannelCount<8>;
+ * @endcode
+ */
+template <std::size_t CountV>
+struct AdcChannelCount : __Internal::__Constant<std::size_t, CountV> {
+    static_assert(
+        1 <= CountV && CountV <= 16,
+        "Channel count must be in the range [1, 16]!"
+    );
+};
+
+/**
+ * @brief IsAdcChannelCount, A concept to check if a type is a AdcChannelCount.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/AdcStream.hpp>
+ *
+ * static_assert(STM32::IsAdcChannelCount<STM32::AdcChannelCount<8>>);
+ * static_assert(!STM32::IsAdcChannelCount<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsAdcChannelCount =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t> &&
+    (1 <= T::value && T::value <= 16);
+
+/**
+ * @struct AdcScanCount, A utility struct to configure the number of scans per buffer half.
+ *
+ * @tparam CountV   Number of complete channel sequences collected before a half is handed over.
+ *
+ * Larger values reduce the callback rate at the cost of latency and RAM:
+ * the stream buffer holds 2 * CountV * ChannelCount samples.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * // 10 kHz scan rate, callback every 1 ms
+ * using TenScans = STM32::AdcScanCount<10>;
+ * @endcode
+ */
+template <std::size_t CountV>
+struct AdcScanCount : __Internal::__Constant<std::size_t, CountV> {
+    static_assert(
+        1 <= CountV,
+        "Scan count must be greater or equal to 1!"
+    );
+};
+
+/**
+ * @brief IsAdcScanCount, A concept to check if a type is a AdcScanCount.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/AdcStream.hpp>
+ *
+ * static_assert(STM32::IsAdcScanCount<STM32::AdcScanCount<10>>);
+ * static_assert(!STM32::IsAdcScanCount<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsAdcScanCount =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t> &&
+    (1 <= T::value);
+
+/**
+ * @class AdcStream, A class to stream multi-channel ADC scans through circular DMA.
+ *
+ * The ADC scans its regular sequence continuously, and DMA stores the conversions
+ * into an internal ping-pong buffer without CPU involvement. Each time one half
+ * of the buffer is filled, the callback receives it while DMA fills the other half.
+ *
+ * Samples in a half are interleaved by scan: `half[scan * ChannelCount + channel]`,
+ * where channel is the rank in the ADC regular sequence.
+ *
+ * @tparam AdcChannelCountT     Number of channels in the regular sequence.
+ * @tparam AdcScanCountT        Number of scans per buffer half.
+ * @tparam UniqueTagT           Unique tag type to differentiate multiple AdcStream instances.
+ *                              UniqueTagT must be STM32_UNIQUE_TAG.
+ *
+ * @note AdcStream class is non-copyable and non-movable.
+ * @note Required ADC configuration: scan mode with AdcChannelCountT ranks, continuous
+ *       conversion or timer trigger, DMA continuous requests, DMA in circular mode
+ *       with half-word data width.
+ * @note The stream is restarted automatically after an ADC error (e.g., overrun).
+ * @note The callback runs in interrupt context and must finish with the half before
+ *       DMA wraps around to it, i.e., within AdcScanCountT scan periods.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/AdcStream.hpp>
+ *
+ * ADC_HandleTypeDef hadc1; // 8 ranks, timer triggered at 10 kHz, circular DMA
+ *
+ * STM32::AdcStream<
+ *     STM32::AdcChannelCount<8>,
+ *     STM32::AdcScanCount<10>,
+ *     STM32_UNIQUE_TAG
+ * > stream{hadc1};
+ *
+ * stream.Start([](std::span<const std::uint16_t> samples){
+ *     // 10 scans x 8 channels, samples[scan * 8 + channel]
+ * });
+ *
+ * stream.Stop();
+ * @endcode
+ */
+template <
+    IsAdcChannelCount AdcChannelCountT,
+    IsAdcScanCount AdcScanCountT,
+    __Internal::__IsUniqueTag UniqueTagT
+>
+class AdcStream {
+    using HalfCompleteCallbackT = __Internal::__CallbackManager<
+        ADC_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_ADC_RegisterCallback, HAL_ADC_UnRegisterCallback, HAL_ADC_CONVERSION_HALF_CB_ID
+    >;
+    using CompleteCallbackT = __Internal::__CallbackManager<
+        ADC_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_ADC_RegisterCallback, HAL_ADC_UnRegisterCallback, HAL_ADC_CONVERSION_COMPLETE_CB_ID
+    >;
+    using ErrorCallbackT = __Internal::__CallbackManager<
+        ADC_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_ADC_RegisterCallback, HAL_ADC_UnRegisterCallback, HAL_ADC_ERROR_CB_ID
+    >;
+public:
+
+    /** @brief Number of channels in one scan. */
+    static constexpr std::size_t channel_count{AdcChannelCountT::value};
+
+    /** @brief Number of samples handed over per callback. */
+    static constexpr std::size_t half_size{AdcScanCountT::value * AdcChannelCountT::value};
+
+    /**
+     * @brief Construct AdcStream class.
+     *
+     * @param handle        Reference to the ADC handle.
+     *
+     * @note HAL callbacks are automatically registered via RAII.
+     */
+    explicit AdcStream(ADC_HandleTypeDef& handle) noexcept
+      : m_handle{handle},
+        m_half_complete_callback{handle},
+        m_complete_callback{handle},
+        m_error_callback{handle}
+    { }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    AdcStream(const AdcStream&) = delete;
+    AdcStream& operator=(const AdcStream&) = delete;
+    AdcStream(AdcStream&&) = delete;
+    AdcStream& operator=(AdcStream&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy AdcStream class, stops streaming.
+     *
+     * @note Callbacks are automatically unregistered via RAII.
+     */
+    ~AdcStream()
+    {
+        Stop();
+    }
+
+    /**
+     * @returns ADC handle reference.
+     */
+    [[nodiscard]]
+    auto&& GetHandle(this auto&& self) noexcept
+    {
+        return std::forward<decltype(self)>(self).m_handle;
+    }
+
+    /**
+     * @brief Start continuous streaming.
+     *
+     * @param half_callback     Callback function to be called with each filled buffer half.
+     *
+     * @returns True on success, false otherwise (including a rank count mismatch).
+     */
+    bool Start(EventCallbackT<std::span<const std::uint16_t>>&& half_callback) noexcept
+    {
+        if (m_handle.Init.NbrOfConversion != channel_count) {
+            return false;
+        }
+        m_half_callback = std::move(half_callback);
+        m_half_complete_callback.Set([this](){
+            m_half_callback(std::span<const std::uint16_t>{m_buffer}.first(half_size));
+        });
+        m_complete_callback.Set([this](){
+            m_half_callback(std::span<const std::uint16_t>{m_buffer}.last(half_size));
+        });
+        m_error_callback.Set([this](){
+            HAL_ADC_Stop_DMA(&m_handle);
+            StartDma();
+        });
+        return StartDma();
+    }
+
+    /**
+     * @brief Stop streaming.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Stop() noexcept
+    {
+        m_error_callback.Clear();
+        m_half_complete_callback.Clear();
+        m_complete_callback.Clear();
+        return (HAL_OK == HAL_ADC_Stop_DMA(&m_handle));
+    }
+
+private:
+    ADC_HandleTypeDef& m_handle;
+    HalfCompleteCallbackT m_half_complete_callback;
+    CompleteCallbackT m_complete_callback;
+    ErrorCallbackT m_error_callback;
+    EventCallbackT<std::span<const std::uint16_t>> m_half_callback{};
+    alignas(std::uint32_t) std::array<std::uint16_t, 2 * half_size> m_buffer{};
+
+    /**
+     * @brief Start circular DMA into the ping-pong buffer.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool StartDma() noexcept
+    {
+        return (HAL_OK == HAL_ADC_Start_DMA(
+            &m_handle,
+            reinterpret_cast<std::uint32_t*>(m_buffer.data()),
+            static_cast<std::uint32_t>(m_buffer.size())
+        ));
+    }
+};
+
+} /* namespace STM32 */
+
+#endif /* STM32_ADC_STREAM_HPP */
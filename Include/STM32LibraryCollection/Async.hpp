@@ -0,0 +1,1067 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_ASYNC_HPP
+#define STM32_ASYNC_HPP
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "Config.hpp"
+#include "__Internal/__Utility.hpp"
+
+#include "main.h"
+
+/**
+ * @def STM32_TASK_FRAME_SIZE
+ * @brief Size of one coroutine frame slot of the task frame pool in bytes.
+ *
+ * Define before including the library to fit larger coroutines (default is 256).
+ * A frame holds the locals, arguments and awaiters of one Task coroutine.
+ */
+#if !defined(STM32_TASK_FRAME_SIZE)
+#define STM32_TASK_FRAME_SIZE 256
+#endif
+
+/**
+ * @def STM32_TASK_FRAME_COUNT
+ * @brief Number of coroutine frame slots of the task frame pool (1 to 32).
+ *
+ * Define before including the library to run more or deeper nested tasks (default is 8).
+ */
+#if !defined(STM32_TASK_FRAME_COUNT)
+#define STM32_TASK_FRAME_COUNT 8
+#endif
+
+namespace STM32 {
+
+/**
+ * @struct TaskExecutorCapacity, A utility struct to hold the maximum number of root tasks.
+ *
+ * @tparam CapacityV    Maximum number of tasks spawned on a TaskExecutor at the same time.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Async.hpp>
+ *
+ * using FourTasks = STM32::TaskExecutorCapacity<4>;
+ * @endcode
+ */
+template <std::size_t CapacityV>
+struct TaskExecutorCapacity : __Internal::__Constant<std::size_t, CapacityV> {};
+
+/**
+ * @brief IsTaskExecutorCapacity, A concept to check if a type is a valid TaskExecutorCapacity.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Async.hpp>
+ *
+ * static_assert(STM32::IsTaskExecutorCapacity<STM32::TaskExecutorCapacity<4>>);
+ * static_assert(!STM32::IsTaskExecutorCapacity<STM32::TaskExecutorCapacity<0>>);
+ * static_assert(!STM32::IsTaskExecutorCapacity<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsTaskExecutorCapacity =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t> &&
+    (T::value > 0);
+
+template <typename T>
+class Task;
+
+template <IsTaskExecutorCapacity CapacityT>
+class TaskExecutor;
+
+namespace __Internal {
+
+/**
+ * @class __TaskFramePool, Static allocator of Task coroutine frames.
+ *
+ * Frames are taken from STM32_TASK_FRAME_COUNT fixed-size slots of
+ * STM32_TASK_FRAME_SIZE bytes, tracked by a bitmap, so coroutines never
+ * use the heap. Allocation fails by returning nullptr if the frame does
+ * not fit into a slot or all slots are in use.
+ *
+ * @note This is an internal class. Do not use directly in application code.
+ */
+class __TaskFramePool {
+    static constexpr std::size_t s_frame_size{STM32_TASK_FRAME_SIZE};
+    static constexpr std::size_t s_frame_count{STM32_TASK_FRAME_COUNT};
+
+    static_assert(s_frame_count > 0 && s_frame_count <= 32, "STM32_TASK_FRAME_COUNT must be in 1..32!");
+
+    /**
+     * @struct Frame, Storage of one coroutine frame.
+     */
+    struct Frame {
+        alignas(std::max_align_t) std::byte bytes[s_frame_size];
+    };
+public:
+
+    /**
+     * @brief Take a free frame slot.
+     *
+     * @param size      Size of the coroutine frame in bytes.
+     *
+     * @returns Pointer to the frame, nullptr if it does not fit or the pool is exhausted.
+     */
+    static void* Allocate(std::size_t size) noexcept
+    {
+        if (size > s_frame_size) {
+            return nullptr;
+        }
+        __CriticalSection critical_section{};
+        const auto index = static_cast<std::size_t>(std::countr_one(s_used));
+        if (index >= s_frame_count) {
+            return nullptr;
+        }
+        s_used |= (std::uint32_t{1} << index);
+        return s_frames[index].bytes;
+    }
+
+    /**
+     * @brief Return a frame slot to the pool.
+     *
+     * @param frame     Pointer returned by Allocate().
+     */
+    static void Free(void* frame) noexcept
+    {
+        const auto index = static_cast<std::size_t>(static_cast<Frame*>(frame) - s_frames.data());
+        __CriticalSection critical_section{};
+        s_used &= ~(std::uint32_t{1} << index);
+    }
+
+    /**
+     * @returns Number of frame slots in use.
+     */
+    [[nodiscard]]
+    static std::size_t Size() noexcept
+    {
+        __CriticalSection critical_section{};
+        return static_cast<std::size_t>(std::popcount(s_used));
+    }
+
+private:
+    static inline std::array<Frame, s_frame_count> s_frames{};
+    static inline std::uint32_t s_used{};
+};
+
+/**
+ * @class __TaskQueue, Ready queue and task count of a TaskExecutor.
+ *
+ * Completion callbacks push the awaiting coroutine from interrupt context,
+ * the executor resumes it from the main loop.
+ *
+ * @note This is an internal class. Do not use directly in application code.
+ */
+class __TaskQueue {
+public:
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    __TaskQueue(const __TaskQueue&) = delete;
+    __TaskQueue& operator=(const __TaskQueue&) = delete;
+    __TaskQueue(__TaskQueue&&) = delete;
+    __TaskQueue& operator=(__TaskQueue&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Queue a suspended coroutine to be resumed by the next Poll().
+     *
+     * @param handle    Coroutine to be resumed.
+     *
+     * @note May be called from interrupt context.
+     */
+    void Push(std::coroutine_handle<> handle) noexcept
+    {
+        __CriticalSection critical_section{};
+        if (m_ready_count < m_capacity) {
+            m_handles[(m_head + m_ready_count) % m_capacity] = handle;
+            ++m_ready_count;
+        }
+    }
+
+    /**
+     * @brief Account for a completed root task.
+     */
+    void OnTaskComplete() noexcept
+    {
+        --m_task_count;
+    }
+
+protected:
+    std::coroutine_handle<>* const m_handles;
+    const std::size_t m_capacity;
+    std::size_t m_head{};
+    std::size_t m_ready_count{};
+    std::size_t m_task_count{};
+
+    /**
+     * @brief Construct __TaskQueue class.
+     *
+     * @param handles   Storage of capacity coroutine handles.
+     * @param capacity  Maximum number of root tasks.
+     */
+    __TaskQueue(std::coroutine_handle<>* handles, std::size_t capacity) noexcept
+      : m_handles{handles},
+        m_capacity{capacity}
+    { }
+
+    ~__TaskQueue() = default;
+
+    /**
+     * @returns Next ready coroutine, a null handle if none.
+     */
+    std::coroutine_handle<> Pop() noexcept
+    {
+        __CriticalSection critical_section{};
+        if (m_ready_count == 0) {
+            return {};
+        }
+        const auto handle = m_handles[m_head];
+        m_head = (m_head + 1) % m_capacity;
+        --m_ready_count;
+        return handle;
+    }
+};
+
+/**
+ * @struct __TaskPromiseBase, Value-independent part of the Task promise.
+ *
+ * @note This is an internal class. Do not use directly in application code.
+ */
+struct __TaskPromiseBase {
+
+    /**
+     * @struct FinalAwaiter, Resumes the awaiting task, or releases a completed root task.
+     */
+    struct FinalAwaiter {
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+
+        template <std::derived_from<__TaskPromiseBase> PromiseT>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<PromiseT> handle) noexcept
+        {
+            auto& promise = handle.promise();
+            if (promise.continuation) {
+                return promise.continuation;
+            }
+            auto* executor = promise.executor;
+            handle.destroy();
+            if (executor != nullptr) {
+                executor->OnTaskComplete();
+            }
+            return std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept
+        { }
+    };
+
+    __TaskQueue* executor{};
+    std::coroutine_handle<> continuation{};
+
+    static void* operator new(std::size_t size) noexcept
+    {
+        return __TaskFramePool::Allocate(size);
+    }
+
+    static void operator delete(void* frame, [[maybe_unused]] std::size_t size) noexcept
+    {
+        __TaskFramePool::Free(frame);
+    }
+
+    std::suspend_always initial_suspend() const noexcept
+    {
+        return {};
+    }
+
+    FinalAwaiter final_suspend() const noexcept
+    {
+        return {};
+    }
+
+    void unhandled_exception() const noexcept
+    {
+        std::terminate();
+    }
+};
+
+/**
+ * @struct __TaskPromise, Promise of a Task returning a value.
+ *
+ * @tparam T    Result type of the task.
+ *
+ * @note This is an internal class. Do not use directly in application code.
+ */
+template <typename T>
+struct __TaskPromise : __TaskPromiseBase {
+    T value{};
+
+    Task<T> get_return_object() noexcept;
+
+    static Task<T> get_return_object_on_allocation_failure() noexcept;
+
+    void return_value(T result) noexcept
+    {
+        value = std::move(result);
+    }
+};
+
+/**
+ * @brief __TaskPromise specialization for tasks without a result.
+ */
+template <>
+struct __TaskPromise<void> : __TaskPromiseBase {
+
+    Task<void> get_return_object() noexcept;
+
+    static Task<void> get_return_object_on_allocation_failure() noexcept;
+
+    void return_void() const noexcept
+    { }
+};
+
+/**
+ * @struct __TaskAwaiter, Awaiter of a nested Task, runs it and returns its result.
+ *
+ * Results in std::nullopt (false for void T) if the frame of the task could not be allocated.
+ *
+ * @tparam T    Result type of the task.
+ *
+ * @note This is an internal class. Do not use directly in application code.
+ */
+template <typename T>
+struct __TaskAwaiter {
+    std::coroutine_handle<__TaskPromise<T>> handle;
+
+    bool await_ready() const noexcept
+    {
+        return !handle;
+    }
+
+    template <std::derived_from<__TaskPromiseBase> PromiseT>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<PromiseT> caller) noexcept
+    {
+        handle.promise().continuation = caller;
+        handle.promise().executor = caller.promise().executor;
+        return handle;
+    }
+
+    auto await_resume() noexcept
+    {
+        if constexpr (std::is_void_v<T>) {
+            return static_cast<bool>(handle);
+        } else {
+            return handle ? std::optional<T>{std::move(handle.promise().value)} : std::nullopt;
+        }
+    }
+};
+
+/**
+ * @struct __TaskQueueStorage, Coroutine handle storage of a TaskExecutor.
+ *
+ * Base class of TaskExecutor, so the storage exists before the __TaskQueue base refers to it.
+ *
+ * @tparam CapacityV    Number of coroutine handles.
+ *
+ * @note This is an internal class. Do not use directly in application code.
+ */
+template <std::size_t CapacityV>
+struct __TaskQueueStorage {
+    std::array<std::coroutine_handle<>, CapacityV> handles{};
+};
+
+} /* namespace __Internal */
+
+/**
+ * @class Task, A lazily started, allocation-free coroutine.
+ *
+ * A function returning Task is a coroutine that may co_await transfers (see
+ * AsyncCall()), delays (see AsyncDelay()) and other tasks. Tasks start
+ * suspended: a root task runs once spawned on a TaskExecutor, a nested task
+ * runs when it is co_awaited and resumes its caller on completion.
+ *
+ * Frames are allocated from a static pool (see STM32_TASK_FRAME_SIZE and
+ * STM32_TASK_FRAME_COUNT). If a frame cannot be allocated, the returned task is
+ * invalid: spawning it fails and awaiting it results in std::nullopt. Awaiting
+ * a Task<T> results in std::optional<T>, awaiting a Task<void> in a bool.
+ *
+ * @tparam T    Result type of the coroutine (default is void).
+ *
+ * @note Task class is move-only.
+ * @note Tasks run in the main loop from TaskExecutor::Poll(), never in interrupt context.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Async.hpp>
+ *
+ * STM32::Task<bool> ReadTemperature(std::uint16_t& temperature)
+ * {
+ *     std::array<std::uint8_t, 2> raw{};
+ *     const auto is_read = co_await STM32::AsyncCall<bool>([&](STM32::EventCallbackT<bool>&& done){
+ *         return i2c_queue.MemoryReadTo<SensorAddress, TemperatureRegister>(raw, std::move(done));
+ *     });
+ *     if (!is_read.value_or(false)) {
+ *         co_return false;
+ *     }
+ *     temperature = static_cast<std::uint16_t>((raw[0] << 8) | raw[1]);
+ *     co_return true;
+ * }
+ *
+ * STM32::Task<> Report()
+ * {
+ *     while (true) {
+ *         std::uint16_t temperature{};
+ *         if ((co_await ReadTemperature(temperature)).value_or(false)) {
+ *             std::array<char, 16> message{};
+ *             std::snprintf(message.data(), message.size(), "T=%u\n", temperature);
+ *             co_await STM32::AsyncTransfer(uart, [&](STM32::CallbackT&& done){
+ *                 return uart.Transmit(message, std::move(done));
+ *             });
+ *         }
+ *         co_await STM32::AsyncDelay(scheduler, 1'000'000);
+ *     }
+ * }
+ * @endcode
+ */
+template <typename T = void>
+class Task {
+    template <typename>
+    friend struct __Internal::__TaskPromise;
+
+    template <IsTaskExecutorCapacity>
+    friend class TaskExecutor;
+public:
+
+    /**
+     * @typedef promise_type, Coroutine promise type.
+     */
+    using promise_type = __Internal::__TaskPromise<T>;
+
+    /**
+     * @brief Construct an invalid Task.
+     */
+    Task() noexcept = default;
+
+    /**
+     * @brief Move constructor.
+     *
+     * @param other     Task to move from (becomes invalid after move).
+     */
+    Task(Task&& other) noexcept
+      : m_handle{std::exchange(other.m_handle, nullptr)}
+    { }
+
+    /**
+     * @brief Move assignment operator.
+     *
+     * @param other     Task to move from (becomes invalid after move).
+     *
+     * @returns         Reference to this.
+     */
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other) {
+            Destroy();
+            m_handle = std::exchange(other.m_handle, nullptr);
+        }
+        return *this;
+    }
+
+    /**
+     * @defgroup Deleted copy members.
+     * @{
+     */
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy Task class, destroys the coroutine frame if not spawned.
+     */
+    ~Task()
+    {
+        Destroy();
+    }
+
+    /**
+     * @returns True if the coroutine frame was allocated and the task is not spawned.
+     */
+    [[nodiscard]]
+    bool IsValid() const noexcept
+    {
+        return static_cast<bool>(m_handle);
+    }
+
+    /**
+     * @brief Await the task from another task, runs it and returns its result.
+     */
+    auto operator co_await() && noexcept
+    {
+        return __Internal::__TaskAwaiter<T>{m_handle};
+    }
+
+private:
+    std::coroutine_handle<promise_type> m_handle{};
+
+    /**
+     * @brief Construct Task class from its coroutine.
+     *
+     * @param handle    Coroutine of the task.
+     */
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept
+      : m_handle{handle}
+    { }
+
+    /**
+     * @brief Destroy the coroutine frame, if any.
+     */
+    void Destroy() noexcept
+    {
+        if (m_handle) {
+            m_handle.destroy();
+            m_handle = nullptr;
+        }
+    }
+
+    /**
+     * @returns Coroutine of the task, ownership is released.
+     */
+    std::coroutine_handle<promise_type> Release() noexcept
+    {
+        return std::exchange(m_handle, nullptr);
+    }
+};
+
+namespace __Internal {
+
+template <typename T>
+Task<T> __TaskPromise<T>::get_return_object() noexcept
+{
+    return Task<T>{std::coroutine_handle<__TaskPromise>::from_promise(*this)};
+}
+
+template <typename T>
+Task<T> __TaskPromise<T>::get_return_object_on_allocation_failure() noexcept
+{
+    return Task<T>{};
+}
+
+inline Task<void> __TaskPromise<void>::get_return_object() noexcept
+{
+    return Task<void>{std::coroutine_handle<__TaskPromise>::from_promise(*this)};
+}
+
+inline Task<void> __TaskPromise<void>::get_return_object_on_allocation_failure() noexcept
+{
+    return Task<void>{};
+}
+
+} /* namespace __Internal */
+
+/**
+ * @class TaskExecutor, A run-to-completion executor of Task coroutines driven from the main loop.
+ *
+ * Spawned tasks and tasks whose transfer completed are queued, Poll() resumes
+ * each of them until its next co_await. Completion callbacks only queue the
+ * awaiting task, so task code never runs in interrupt context and tasks need no
+ * locking between each other. Several tasks overlap their transfers on
+ * different buses while the main loop keeps running.
+ *
+ * @tparam CapacityT    Maximum number of root tasks (see TaskExecutorCapacity).
+ *
+ * @note TaskExecutor class is non-copyable and non-movable.
+ * @note Spawn() and Poll() must be called from the main loop only.
+ * @note The executor must outlive its tasks, frames of unfinished tasks are not released.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Async.hpp>
+ *
+ * STM32::TaskExecutor<STM32::TaskExecutorCapacity<4>> executor{};
+ *
+ * executor.Spawn(Report());
+ * executor.Spawn(BlinkLed());
+ *
+ * while (true) {
+ *     executor.Poll();
+ *     __disable_irq();
+ *     if (!executor.IsReady()) {
+ *         __WFI();                 // Wakes up on the next interrupt even with PRIMASK set
+ *     }
+ *     __enable_irq();
+ * }
+ * @endcode
+ */
+template <IsTaskExecutorCapacity CapacityT>
+class TaskExecutor :
+    private __Internal::__TaskQueueStorage<CapacityT::value>,
+    public __Internal::__TaskQueue {
+public:
+
+    /**
+     * @brief Construct TaskExecutor class.
+     */
+    TaskExecutor() noexcept
+      : __Internal::__TaskQueue{this->handles.data(), CapacityT::value}
+    { }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    TaskExecutor(const TaskExecutor&) = delete;
+    TaskExecutor& operator=(const TaskExecutor&) = delete;
+    TaskExecutor(TaskExecutor&&) = delete;
+    TaskExecutor& operator=(TaskExecutor&&) = delete;
+    /** @} */
+
+    /**
+     * @returns Maximum number of root tasks.
+     */
+    [[nodiscard]]
+    static constexpr std::size_t Capacity() noexcept
+    {
+        return CapacityT::value;
+    }
+
+    /**
+     * @returns Number of spawned, not yet completed tasks.
+     */
+    [[nodiscard]]
+    std::size_t Size() const noexcept
+    {
+        return m_task_count;
+    }
+
+    /**
+     * @returns True if no spawned task is left.
+     */
+    [[nodiscard]]
+    bool IsIdle() const noexcept
+    {
+        return m_task_count == 0;
+    }
+
+    /**
+     * @returns True if a task is queued to be resumed by the next Poll().
+     */
+    [[nodiscard]]
+    bool IsReady() const noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        return m_ready_count != 0;
+    }
+
+    /**
+     * @brief Spawn a task, it starts running on the next Poll().
+     *
+     * @param task      Task to be run, the executor takes ownership of it.
+     *
+     * @returns False if the task is invalid or the executor is full.
+     */
+    bool Spawn(Task<>&& task) noexcept
+    {
+        if (!task.IsValid() || m_task_count == CapacityT::value) {
+            return false;
+        }
+        auto handle = task.Release();
+        handle.promise().executor = this;
+        ++m_task_count;
+        Push(handle);
+        return true;
+    }
+
+    /**
+     * @brief Resume the tasks that are ready, each until its next co_await.
+     *
+     * @returns Number of resumed tasks.
+     *
+     * @note Tasks becoming ready while polling are resumed by the next Poll(),
+     *       so a task awaiting AsyncYield() cannot starve the main loop.
+     */
+    std::size_t Poll() noexcept
+    {
+        std::size_t count{};
+        {
+            __Internal::__CriticalSection critical_section{};
+            count = m_ready_count;
+        }
+        for (std::size_t index = 0; index < count; ++index) {
+            if (auto handle = Pop()) {
+                handle.resume();
+            }
+        }
+        return count;
+    }
+};
+
+namespace __Internal {
+
+/**
+ * @typedef __AsyncCallbackT, Completion callback type of an AsyncCall() starter.
+ *
+ * @tparam ResultT      Argument type of the completion callback, void for CallbackT.
+ */
+template <typename ResultT>
+using __AsyncCallbackT = std::conditional_t<std::is_void_v<ResultT>, CallbackT, EventCallbackT<ResultT>>;
+
+/**
+ * @class __AsyncCallAwaitable, Awaits a non-blocking operation completed by a callback.
+ *
+ * @tparam StarterT     Callable starting the operation with the completion callback.
+ * @tparam ResultT      Argument type of the completion callback, void for CallbackT.
+ *
+ * @note This is an internal class. Do not use directly in application code.
+ */
+template <typename StarterT, typename ResultT>
+class __AsyncCallAwaitable {
+    using CompleteCallbackT = __AsyncCallbackT<ResultT>;
+public:
+
+    /**
+     * @brief Construct __AsyncCallAwaitable class.
+     *
+     * @param starter   Callable starting the operation.
+     */
+    explicit __AsyncCallAwaitable(StarterT&& starter) noexcept
+      : m_starter{std::move(starter)}
+    { }
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    template <std::derived_from<__TaskPromiseBase> PromiseT>
+    bool await_suspend(std::coroutine_handle<PromiseT> handle) noexcept
+    {
+        m_handle = handle;
+        m_executor = handle.promise().executor;
+        if constexpr (std::is_void_v<ResultT>) {
+            m_is_started = m_starter(CompleteCallbackT{[this](){
+                m_executor->Push(m_handle);
+            }});
+        } else {
+            m_is_started = m_starter(CompleteCallbackT{[this](ResultT result){
+                m_result = std::move(result);
+                m_executor->Push(m_handle);
+            }});
+        }
+        return m_is_started;
+    }
+
+    auto await_resume() noexcept
+    {
+        if constexpr (std::is_void_v<ResultT>) {
+            return m_is_started;
+        } else {
+            return std::move(m_result);
+        }
+    }
+
+private:
+    StarterT m_starter;
+    std::coroutine_handle<> m_handle{};
+    __TaskQueue* m_executor{};
+    [[no_unique_address]] std::conditional_t<std::is_void_v<ResultT>, std::tuple<>, std::optional<ResultT>> m_result{};
+    bool m_is_started{};
+};
+
+/**
+ * @class __AsyncTransferAwaitable, Awaits a transfer completed by a callback or failed through the error callback.
+ *
+ * The directions the peripheral turns busy when the transfer starts are the awaited
+ * directions. An error leaving them busy (e.g., a UART receive error during a transmission)
+ * is ignored, an error ending them aborts them, clears their complete callbacks and
+ * resumes the task with false, so no late completion reaches the destroyed awaiter.
+ *
+ * @tparam PeripheralT  Peripheral providing SetErrorCallback(), ClearErrorCallback(),
+ *                      GetBusyDirection() and AbortTransfer().
+ * @tparam StarterT     Callable starting the transfer with the completion callback.
+ *
+ * @note This is an internal class. Do not use directly in application code.
+ */
+template <typename PeripheralT, typename StarterT>
+class __AsyncTransferAwaitable {
+public:
+
+    /**
+     * @brief Construct __AsyncTransferAwaitable class.
+     *
+     * @param peripheral    Peripheral running the transfer.
+     * @param starter       Callable starting the transfer.
+     */
+    __AsyncTransferAwaitable(PeripheralT& peripheral, StarterT&& starter) noexcept
+      : m_peripheral{peripheral},
+        m_starter{std::move(starter)}
+    { }
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    template <std::derived_from<__TaskPromiseBase> PromiseT>
+    bool await_suspend(std::coroutine_handle<PromiseT> handle) noexcept
+    {
+        m_handle = handle;
+        m_executor = handle.promise().executor;
+        const auto idle_direction = ~m_peripheral.GetBusyDirection();
+        m_direction = idle_direction;
+        m_is_error_callback_set = m_peripheral.SetErrorCallback([this]([[maybe_unused]] std::uint32_t error_code){
+            OnError();
+        });
+        if (!m_is_error_callback_set) {
+            return false;
+        }
+        if (!m_starter(CallbackT{[this](){
+                Complete(true);
+            }})) {
+            return false;
+        }
+        __CriticalSection critical_section{};
+        if (const auto direction = m_peripheral.GetBusyDirection() & idle_direction; direction != TransferDirection::None) {
+            m_direction = direction;
+        }
+        m_is_started = true;
+        if (m_is_error_pending) {
+            OnError();
+        }
+        return true;
+    }
+
+    bool await_resume() noexcept
+    {
+        if (m_is_error_callback_set) {
+            m_peripheral.ClearErrorCallback();
+        }
+        return m_is_successful;
+    }
+
+private:
+    PeripheralT& m_peripheral;
+    StarterT m_starter;
+    std::coroutine_handle<> m_handle{};
+    __TaskQueue* m_executor{};
+    TransferDirection m_direction{};
+    bool m_is_error_callback_set{};
+    bool m_is_started{};
+    bool m_is_error_pending{};
+    bool m_is_complete{};
+    bool m_is_successful{};
+
+    /**
+     * @brief Error callback, fails the transfer unless the error left the awaited directions running.
+     *
+     * An error reported while the transfer is being started is evaluated once the awaited directions are known.
+     */
+    void OnError() noexcept
+    {
+        if (!m_is_started) {
+            m_is_error_pending = true;
+            return;
+        }
+        if (m_is_complete || (m_peripheral.GetBusyDirection() & m_direction) != TransferDirection::None) {
+            return;
+        }
+        m_peripheral.AbortTransfer(m_direction);
+        Complete(false);
+    }
+
+    /**
+     * @brief Record the result and queue the awaiting task, only the first call counts.
+     *
+     * @param is_successful     True if the transfer completed, false on error.
+     */
+    void Complete(bool is_successful) noexcept
+    {
+        if (std::exchange(m_is_complete, true)) {
+            return;
+        }
+        m_is_successful = is_successful;
+        m_executor->Push(m_handle);
+    }
+};
+
+/**
+ * @struct __AsyncYieldAwaitable, Requeues the awaiting task behind the ready tasks.
+ *
+ * @note This is an internal class. Do not use directly in application code.
+ */
+struct __AsyncYieldAwaitable {
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    template <std::derived_from<__TaskPromiseBase> PromiseT>
+    void await_suspend(std::coroutine_handle<PromiseT> handle) const noexcept
+    {
+        handle.promise().executor->Push(handle);
+    }
+
+    void await_resume() const noexcept
+    { }
+};
+
+} /* namespace __Internal */
+
+/**
+ * @brief Await a non-blocking operation that reports completion through a callback.
+ *
+ * The starter receives the completion callback and starts the operation with it,
+ * e.g. an Interrupt or DMA Transmit(), ReceiveTo() or MemoryReadTo() overload.
+ * The task is resumed by the executor once the callback was called. The callback
+ * only captures the awaiter, so multi-step protocols need no nested lambdas.
+ *
+ * @tparam ResultT      Argument type of the completion callback (default is void, CallbackT).
+ *
+ * @param starter       Callable taking CallbackT&& (or EventCallbackT<ResultT>&&),
+ *                      returning true if the operation was started.
+ *
+ * @returns Awaitable resulting in false (void ResultT) or std::nullopt if the
+ *          operation was not started, true or the callback argument otherwise.
+ *
+ * @note Operations failing through an error callback never resume the task, use
+ *       AsyncTransfer() or the queues (e.g., SpiBus, I2cTransactionQueue) which report failures.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Async.hpp>
+ *
+ * STM32::Task<> Exchange()
+ * {
+ *     // I2C register read, then SPI write, then UART send, on three buses
+ *     if (!co_await STM32::AsyncTransfer(i2c, [&](STM32::CallbackT&& done){
+ *         return i2c.MemoryReadTo<SensorAddress, DataRegister>(sample, std::move(done));
+ *     })) {
+ *         co_return;
+ *     }
+ *     const auto is_written = co_await STM32::AsyncCall<bool>([&](STM32::EventCallbackT<bool>&& done){
+ *         return spi_bus.Transmit(flash, sample, std::move(done));
+ *     });
+ *     if (is_written.value_or(false)) {
+ *         co_await STM32::AsyncCall([&](STM32::CallbackT&& done){
+ *             return uart.Transmit(done_message, std::move(done));
+ *         });
+ *     }
+ * }
+ * @endcode
+ */
+template <typename ResultT = void, typename StarterT>
+requires std::is_invocable_r_v<bool, std::decay_t<StarterT>&, __Internal::__AsyncCallbackT<ResultT>&&>
+[[nodiscard]]
+auto AsyncCall(StarterT&& starter) noexcept
+{
+    return __Internal::__AsyncCallAwaitable<std::decay_t<StarterT>, ResultT>{
+        std::decay_t<StarterT>{std::forward<StarterT>(starter)}
+    };
+}
+
+/**
+ * @brief Await a non-blocking transfer of a peripheral, resumed on completion or on error.
+ *
+ * Like AsyncCall(), but the error callback of the peripheral is set while the
+ * transfer is in flight, so a transfer failing through HAL error handling also
+ * resumes the task. Errors leaving the awaited direction running (e.g., a UART
+ * receive error during a transmission) are ignored, a failed transfer is aborted
+ * and its complete callback cleared before the task resumes. The error callback
+ * is cleared when the task resumes.
+ *
+ * @param peripheral    Peripheral running the transfer (e.g., Uart, Spi, I2c).
+ * @param starter       Callable taking CallbackT&&, returning true if the transfer was started.
+ *
+ * @returns Awaitable resulting in true if the transfer completed, false if it
+ *          was not started, failed or the error callback of the peripheral is
+ *          already owned (e.g., by a SpiBus, an I2cTransactionQueue or another AsyncTransfer()).
+ *
+ * @note Await one AsyncTransfer() per peripheral at a time.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * const bool is_read = co_await STM32::AsyncTransfer(i2c, [&](STM32::CallbackT&& done){
+ *     return i2c.MemoryReadTo<SensorAddress, DataRegister>(sample, std::move(done));
+ * });
+ * @endcode
+ */
+template <typename PeripheralT, typename StarterT>
+requires requires (PeripheralT& peripheral, TransferDirection direction) {
+    { peripheral.SetErrorCallback(EventCallbackT<std::uint32_t>{}) } -> std::same_as<bool>;
+    peripheral.ClearErrorCallback();
+    { peripheral.GetBusyDirection() } -> std::same_as<TransferDirection>;
+    peripheral.AbortTransfer(direction);
+} && std::is_invocable_r_v<bool, std::decay_t<StarterT>&, CallbackT&&>
+[[nodiscard]]
+auto AsyncTransfer(PeripheralT& peripheral, StarterT&& starter) noexcept
+{
+    return __Internal::__AsyncTransferAwaitable<PeripheralT, std::decay_t<StarterT>>{
+        peripheral,
+        std::decay_t<StarterT>{std::forward<StarterT>(starter)}
+    };
+}
+
+/**
+ * @brief Await a delay on a TimerScheduler without blocking the main loop.
+ *
+ * @param scheduler     TimerScheduler providing the delay event.
+ * @param delay         Delay in scheduler ticks.
+ *
+ * @returns Awaitable resulting in false if the scheduler is full (no delay), true otherwise.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * co_await STM32::AsyncDelay(scheduler, 500'000); // 500 ms with a 1 MHz scheduler
+ * @endcode
+ */
+template <typename SchedulerT>
+requires requires (SchedulerT& scheduler, std::uint32_t delay) {
+    { scheduler.CallAfter(delay, CallbackT{}).has_value() } -> std::same_as<bool>;
+}
+[[nodiscard]]
+auto AsyncDelay(SchedulerT& scheduler, std::uint32_t delay) noexcept
+{
+    return AsyncCall([&scheduler, delay](CallbackT&& done){
+        return scheduler.CallAfter(delay, std::move(done)).has_value();
+    });
+}
+
+/**
+ * @brief Let the other ready tasks run, the task is resumed by the next Poll().
+ *
+ * @returns Awaitable resulting in void.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * while (!is_button_pressed) {
+ *     co_await STM32::AsyncYield();
+ * }
+ * @endcode
+ */
+[[nodiscard]]
+inline auto AsyncYield() noexcept
+{
+    return __Internal::__AsyncYieldAwaitable{};
+}
+
+} /* namespace STM32 */
+
+#endif /* STM32_ASYNC_HPP */
@@ -5,6 +5,7 @@
 #define STM32_CONFIG_HPP
 
 #include <concepts>
+#include <cstdint>
 
 namespace STM32 {
 
@@ -60,6 +61,50 @@ concept IsWorkingMode = std::same_as<T, WorkingMode::Blocking> ||
                         std::same_as<T, WorkingMode::Interrupt> ||
                         std::same_as<T, WorkingMode::DMA>;
 
+/**
+ * @enum TransferDirection, Set of the directions of a peripheral running a non-blocking transfer.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Config.hpp>
+ *
+ * static_assert((STM32::TransferDirection::Both & STM32::TransferDirection::Receive) != STM32::TransferDirection::None);
+ * @endcode
+ */
+enum class TransferDirection : std::uint8_t {
+    None = 0,       /**< No transfer is running */
+    Transmit = 1,   /**< A transmission is running */
+    Receive = 2,    /**< A reception is running */
+    Both = 3        /**< A transmission and a reception (or a full-duplex transfer) are running */
+};
+
+/**
+ * @returns Directions in lhs or rhs.
+ */
+[[nodiscard]]
+constexpr TransferDirection operator|(TransferDirection lhs, TransferDirection rhs) noexcept
+{
+    return static_cast<TransferDirection>(static_cast<std::uint8_t>(lhs) | static_cast<std::uint8_t>(rhs));
+}
+
+/**
+ * @returns Directions in both lhs and rhs.
+ */
+[[nodiscard]]
+constexpr TransferDirection operator&(TransferDirection lhs, TransferDirection rhs) noexcept
+{
+    return static_cast<TransferDirection>(static_cast<std::uint8_t>(lhs) & static_cast<std::uint8_t>(rhs));
+}
+
+/**
+ * @returns Directions not in direction.
+ */
+[[nodiscard]]
+constexpr TransferDirection operator~(TransferDirection direction) noexcept
+{
+    return static_cast<TransferDirection>(static_cast<std::uint8_t>(direction) ^ static_cast<std::uint8_t>(TransferDirection::Both));
+}
+
 } /* namespace STM32 */
 
 #endif /* STM32_CONFIG_HPP */
\ No newline at end of file
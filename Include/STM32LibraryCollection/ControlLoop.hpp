@@ -0,0 +1,448 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_CONTROL_LOOP_HPP
+#define STM32_CONTROL_LOOP_HPP
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+#include "AdcStream.hpp"
+#include "Pwm.hpp"
+#include "__Internal/__Utility.hpp"
+
+#include "main.h"
+
+#if defined(HAL_DAC_MODULE_ENABLED)
+#include "Dac.hpp"
+#endif /* HAL_DAC_MODULE_ENABLED */
+
+#if !defined(HAL_ADC_MODULE_ENABLED) /* module check */
+#error "HAL ADC module is not enabled!"
+#endif /* module check */
+
+#if !defined(HAL_TIM_MODULE_ENABLED) /* module check */
+#error "HAL TIM module is not enabled!"
+#endif /* module check */
+
+#if (USE_HAL_ADC_REGISTER_CALLBACKS != 1) /* module check */
+#error "HAL ADC callbacks are not enabled!"
+#endif /* module check */
+
+namespace STM32 {
+
+/**
+ * @namespace AdcSequence, Tag types for the ADC conversion group of a ControlLoop.
+ */
+namespace AdcSequence {
+
+/**
+ * @struct Regular, Tag for the regular group, collected by circular DMA.
+ *
+ * Up to 16 ranks. One interrupt (DMA transfer complete) per scan.
+ */
+struct Regular { };
+
+/**
+ * @struct Injected, Tag for the injected group, read from the injected data registers.
+ *
+ * Up to 4 ranks, no DMA. One interrupt (end of injected sequence) per scan.
+ * Preferred for motor control: the injected trigger is independent of the regular group.
+ */
+struct Injected { };
+
+} /* namespace AdcSequence */
+
+/**
+ * @brief IsAdcSequence, A concept to check if a type is a AdcSequence.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/ControlLoop.hpp>
+ *
+ * static_assert(STM32::IsAdcSequence<STM32::AdcSequence::Injected>);
+ * static_assert(!STM32::IsAdcSequence<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsAdcSequence =
+    std::same_as<T, AdcSequence::Regular> ||
+    std::same_as<T, AdcSequence::Injected>;
+
+/**
+ * @brief IsControlLoopOutput, A concept to check if a type is a ControlLoop output.
+ *
+ * An output writes a raw value (timer compare value, DAC code) straight to its
+ * hardware register, clamped to its range.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/ControlLoop.hpp>
+ *
+ * static_assert(STM32::IsControlLoopOutput<STM32::ControlLoopPwmOutput>);
+ * static_assert(!STM32::IsControlLoopOutput<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsControlLoopOutput = requires(T& output, std::uint32_t value) {
+    { output.Write(value) } noexcept;
+    { output.GetMax() } noexcept -> std::same_as<std::uint32_t>;
+};
+
+/**
+ * @class ControlLoopPwmOutput, A ControlLoop output writing the compare register of a Pwm channel.
+ *
+ * Values are timer compare values in [0, ARR + 1], the duty cycle range of the
+ * PwmConfig is not applied. With output compare preload enabled (CubeMX default),
+ * a new value takes effect at the next update event, phase-locked to the PWM period.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * STM32::Pwm<MyPwmConfig> pwm{htim1, TIM_CHANNEL_1};
+ * STM32::ControlLoopPwmOutput output{pwm};
+ * @endcode
+ */
+class ControlLoopPwmOutput {
+public:
+
+    /**
+     * @brief Construct ControlLoopPwmOutput class.
+     *
+     * @param pwm       Started Pwm channel to write, must outlive the output.
+     */
+    template <IsPwmConfig PwmConfigT>
+    explicit ControlLoopPwmOutput(Pwm<PwmConfigT>& pwm) noexcept
+      : m_timer_handle{pwm.GetTimerHandle()},
+        m_timer_channel{pwm.GetTimerChannel()}
+    { }
+
+    /**
+     * @brief Write a compare value.
+     *
+     * @param value     Compare value, clamped to [0, ARR + 1] (100% duty cycle).
+     */
+    void Write(std::uint32_t value) noexcept
+    {
+        __HAL_TIM_SET_COMPARE(&m_timer_handle, m_timer_channel, std::min(value, GetMax()));
+    }
+
+    /**
+     * @returns Compare value of 100% duty cycle (ARR + 1).
+     */
+    [[nodiscard]]
+    std::uint32_t GetMax() const noexcept
+    {
+        return __HAL_TIM_GET_AUTORELOAD(&m_timer_handle) + 1U;
+    }
+
+private:
+    TIM_HandleTypeDef& m_timer_handle;
+    const std::uint32_t m_timer_channel;
+};
+
+#if defined(HAL_DAC_MODULE_ENABLED)
+
+/**
+ * @class ControlLoopDacOutput, A ControlLoop output writing the data register of a Dac channel.
+ *
+ * Values are raw DAC codes in [0, resolution] of the DacAlignment, the input
+ * range of the DacConfig is not applied.
+ *
+ * @tparam DacChannelV  DAC channel of the Dac.
+ * @tparam DacConfigT   DAC configuration of the Dac.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * STM32::Dac<STM32::DacChannel::Channel1> dac{hdac};
+ * STM32::ControlLoopDacOutput output{dac};
+ * @endcode
+ */
+template <DacChannel DacChannelV, IsDacConfig DacConfigT>
+class ControlLoopDacOutput {
+public:
+
+    /**
+     * @brief Construct ControlLoopDacOutput class.
+     *
+     * @param dac       Started Dac channel to write, must outlive the output.
+     */
+    explicit ControlLoopDacOutput(Dac<DacChannelV, DacConfigT>& dac) noexcept
+      : m_handle{dac.GetHandle()}
+    { }
+
+    /**
+     * @brief Write a DAC code.
+     *
+     * @param value     DAC code, clamped to [0, GetMax()].
+     */
+    void Write(std::uint32_t value) noexcept
+    {
+        HAL_DAC_SetValue(
+            &m_handle,
+            std::to_underlying(DacChannelV),
+            DacConfigT::AlignmentT::alignment,
+            std::min(value, GetMax())
+        );
+    }
+
+    /**
+     * @returns Full scale DAC code.
+     */
+    [[nodiscard]]
+    constexpr std::uint32_t GetMax() const noexcept
+    {
+        return static_cast<std::uint32_t>(DacConfigT::AlignmentT::resolution);
+    }
+
+private:
+    DAC_HandleTypeDef& m_handle;
+};
+
+#endif /* HAL_DAC_MODULE_ENABLED */
+
+/**
+ * @typedef ControlLoopStepT, Step function type of a ControlLoop.
+ *
+ * Called with the samples of one scan (indexed by rank) and the output value,
+ * which holds the previous output on entry. The value left in it is clamped
+ * to the output range and written to the output.
+ *
+ * @tparam ChannelCountV    Number of samples per scan.
+ */
+template <std::size_t ChannelCountV>
+using ControlLoopStepT = EventCallbackT<std::span<const std::uint16_t, ChannelCountV>, std::uint32_t&>;
+
+/**
+ * @class ControlLoop, A class to run a timer-triggered ADC-to-output control loop in interrupt context.
+ *
+ * A timer trigger output (TRGO) starts each ADC scan in hardware. At the end of
+ * the scan, the step function runs in the ADC (or DMA) interrupt and its result
+ * is written straight to the output register. There are no blocking calls, no
+ * conversion start overhead and no main loop latency, so the sampling instant
+ * has a fixed phase relative to the PWM period, and loop rates of tens of kHz
+ * are reachable (e.g., 20 kHz current loops).
+ *
+ * @tparam AdcChannelCountT     Number of channels (ranks) in the converted group.
+ * @tparam AdcSequenceT         Converted group (see AdcSequence).
+ * @tparam OutputT              Output type (see IsControlLoopOutput).
+ * @tparam UniqueTagT           Unique tag type to differentiate multiple ControlLoop instances.
+ *                              UniqueTagT must be STM32_UNIQUE_TAG.
+ *
+ * @note ControlLoop class is non-copyable and non-movable.
+ * @note Required timer configuration: master mode with TRGO on the update event
+ *       (center-aligned PWM samples at the counter underflow, in the middle of the
+ *       low-side on-time) or on an output compare channel for a custom phase.
+ * @note Required ADC configuration for AdcSequence::Regular: scan mode with
+ *       AdcChannelCountT ranks, external trigger on the timer TRGO, no continuous
+ *       conversion, DMA continuous requests, DMA in circular mode with half-word
+ *       data width. Restarted automatically after an ADC error (e.g., overrun).
+ * @note Required ADC configuration for AdcSequence::Injected: AdcChannelCountT
+ *       injected ranks, injected external trigger on the timer TRGO.
+ * @note The step function runs in interrupt context and must finish within one
+ *       trigger period. Prefer integer (fixed-point) arithmetic on cores without an FPU.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/ControlLoop.hpp>
+ *
+ * // TIM1: 20 kHz center-aligned PWM, TRGO on update. ADC1: 2 injected ranks on TIM1 TRGO.
+ * STM32::Pwm<MyPwmConfig> pwm{htim1, TIM_CHANNEL_1};
+ * STM32::ControlLoopPwmOutput output{pwm};
+ *
+ * STM32::ControlLoop<
+ *     STM32::AdcChannelCount<2>,
+ *     STM32::AdcSequence::Injected,
+ *     STM32::ControlLoopPwmOutput,
+ *     STM32_UNIQUE_TAG
+ * > current_loop{hadc1, output};
+ *
+ * std::int32_t integral{};
+ * current_loop.Start([&](std::span<const std::uint16_t, 2> samples, std::uint32_t& compare){
+ *     // Fixed-point PI, gains in Q8
+ *     const std::int32_t error{std::int32_t{current_setpoint} - samples[0]};
+ *     integral = std::clamp(integral + error, -100'000, 100'000);
+ *     compare = static_cast<std::uint32_t>(std::max<std::int32_t>(0, (error * 40 + integral * 2) >> 8));
+ * });
+ * @endcode
+ */
+template <
+    IsAdcChannelCount AdcChannelCountT,
+    IsAdcSequence AdcSequenceT,
+    IsControlLoopOutput OutputT,
+    __Internal::__IsUniqueTag UniqueTagT
+>
+class ControlLoop {
+    static constexpr bool s_is_injected{std::same_as<AdcSequenceT, AdcSequence::Injected>};
+
+    static_assert(
+        !s_is_injected || AdcChannelCountT::value <= 4,
+        "Injected group has at most 4 ranks!"
+    );
+
+    using CompleteCallbackT = __Internal::__CallbackManager<
+        ADC_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_ADC_RegisterCallback, HAL_ADC_UnRegisterCallback,
+        s_is_injected ? HAL_ADC_INJ_CONVERSION_COMPLETE_CB_ID : HAL_ADC_CONVERSION_COMPLETE_CB_ID
+    >;
+    using ErrorCallbackT = __Internal::__CallbackManager<
+        ADC_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_ADC_RegisterCallback, HAL_ADC_UnRegisterCallback, HAL_ADC_ERROR_CB_ID
+    >;
+public:
+
+    /** @brief Number of samples per scan. */
+    static constexpr std::size_t channel_count{AdcChannelCountT::value};
+
+    /**
+     * @brief Construct ControlLoop class.
+     *
+     * @param handle        Reference to the ADC handle.
+     * @param output        Output written by the step function, must outlive the loop.
+     *
+     * @note HAL callbacks are automatically registered via RAII.
+     */
+    ControlLoop(ADC_HandleTypeDef& handle, OutputT& output) noexcept
+      : m_handle{handle},
+        m_output{output},
+        m_complete_callback{handle},
+        m_error_callback{handle}
+    { }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    ControlLoop(const ControlLoop&) = delete;
+    ControlLoop& operator=(const ControlLoop&) = delete;
+    ControlLoop(ControlLoop&&) = delete;
+    ControlLoop& operator=(ControlLoop&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy ControlLoop class, stops the loop.
+     *
+     * @note Callbacks are automatically unregistered via RAII.
+     */
+    ~ControlLoop()
+    {
+        Stop();
+    }
+
+    /**
+     * @returns ADC handle reference.
+     */
+    [[nodiscard]]
+    auto&& GetHandle(this auto&& self) noexcept
+    {
+        return std::forward<decltype(self)>(self).m_handle;
+    }
+
+    /**
+     * @brief Start the loop, the step function runs on each trigger from now on.
+     *
+     * @param step      Step function, see ControlLoopStepT.
+     *
+     * @returns True on success, false otherwise (including a regular rank count mismatch).
+     */
+    bool Start(ControlLoopStepT<channel_count>&& step) noexcept
+    {
+        if constexpr (!s_is_injected) {
+            if (m_handle.Init.NbrOfConversion != channel_count) {
+                return false;
+            }
+        }
+        m_step = std::move(step);
+        m_complete_callback.Set([this](){
+            if constexpr (s_is_injected) {
+                for (std::size_t rank{}; rank < channel_count; ++rank) {
+                    m_samples[rank] = static_cast<std::uint16_t>(
+                        HAL_ADCEx_InjectedGetValue(&m_handle, s_injected_ranks[rank])
+                    );
+                }
+            }
+            m_step(std::span<const std::uint16_t, channel_count>{m_samples}, m_output_value);
+            m_output_value = std::min(m_output_value, m_output.GetMax());
+            m_output.Write(m_output_value);
+        });
+        if constexpr (s_is_injected) {
+            return (HAL_OK == HAL_ADCEx_InjectedStart_IT(&m_handle));
+        } else {
+            m_error_callback.Set([this](){
+                HAL_ADC_Stop_DMA(&m_handle);
+                StartDma();
+            });
+            return StartDma();
+        }
+    }
+
+    /**
+     * @brief Stop the loop, the output holds its last value.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Stop() noexcept
+    {
+        m_error_callback.Clear();
+        m_complete_callback.Clear();
+        if constexpr (s_is_injected) {
+            return (HAL_OK == HAL_ADCEx_InjectedStop_IT(&m_handle));
+        } else {
+            return (HAL_OK == HAL_ADC_Stop_DMA(&m_handle));
+        }
+    }
+
+    /**
+     * @returns Last value written to the output.
+     */
+    [[nodiscard]]
+    std::uint32_t GetOutput() const noexcept
+    {
+        return m_output_value;
+    }
+
+private:
+    static constexpr std::array<std::uint32_t, 4> s_injected_ranks{
+        ADC_INJECTED_RANK_1, ADC_INJECTED_RANK_2, ADC_INJECTED_RANK_3, ADC_INJECTED_RANK_4
+    };
+
+    ADC_HandleTypeDef& m_handle;
+    OutputT& m_output;
+    CompleteCallbackT m_complete_callback;
+    ErrorCallbackT m_error_callback;
+    ControlLoopStepT<channel_count> m_step{};
+    std::uint32_t m_output_value{};
+    alignas(std::uint32_t) std::array<std::uint16_t, channel_count> m_samples{};
+
+    /**
+     * @brief Start circular DMA of one scan into the sample buffer.
+     *
+     * The half transfer interrupt is disabled, it would halve the time budget of the step function.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool StartDma() noexcept
+    {
+        if (HAL_OK != HAL_ADC_Start_DMA(
+            &m_handle,
+            reinterpret_cast<std::uint32_t*>(m_samples.data()),
+            static_cast<std::uint32_t>(m_samples.size())
+        )) {
+            return false;
+        }
+        __HAL_DMA_DISABLE_IT(m_handle.DMA_Handle, DMA_IT_HT);
+        return true;
+    }
+};
+
+} /* namespace STM32 */
+
+#endif /* STM32_CONTROL_LOOP_HPP */
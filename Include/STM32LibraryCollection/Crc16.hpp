@@ -5,11 +5,13 @@
 #define STM32_CRC16_HPP
 
 #include <array>
+#include <atomic>
 #include <concepts>
 #include <cstddef>
 #include <cstdint>
 #include <ranges>
 #include <span>
+#include <type_traits>
 
 namespace STM32 {
 
@@ -114,6 +116,67 @@ struct Crc16ReflectOutput {
     static constexpr bool value = ReflectV;
 };
 
+/**
+ * @namespace Crc16Engine, Tag types for CRC-16 software engine selection.
+ *
+ * The engine determines how many bytes are processed per step and how much
+ * lookup table storage is placed in flash. All engines produce identical results.
+ *
+ * | Engine   | Table storage | Work per byte          |
+ * |----------|---------------|------------------------|
+ * | Bitwise  | none          | 8 shift/XOR steps      |
+ * | Nibble   | 32 bytes      | 2 lookups              |
+ * | Table    | 512 bytes     | 1 lookup               |
+ * | SliceBy4 | 2 KB          | 1 lookup, 4 bytes/step |
+ * | SliceBy8 | 4 KB          | 1 lookup, 8 bytes/step |
+ */
+namespace Crc16Engine {
+
+/**
+ * @struct Bitwise, Tag for the table-free bit-at-a-time engine.
+ *
+ * Smallest footprint, intended for rarely used variants or very small parts.
+ */
+struct Bitwise {
+    static constexpr std::size_t slices{1};
+};
+
+/**
+ * @struct Nibble, Tag for the nibble-at-a-time engine with one 16-entry table (32 bytes).
+ *
+ * Good speed/space trade-off when several CRC-16 variants share one image.
+ */
+struct Nibble {
+    static constexpr std::size_t slices{1};
+};
+
+/**
+ * @struct Table, Tag for the byte-at-a-time engine with one 256-entry table (512 bytes).
+ */
+struct Table {
+    static constexpr std::size_t slices{1};
+};
+
+/**
+ * @struct SliceBy4, Tag for the slice-by-4 engine with four 256-entry tables (2 KB).
+ *
+ * Processes four bytes per step with independent table lookups.
+ */
+struct SliceBy4 {
+    static constexpr std::size_t slices{4};
+};
+
+/**
+ * @struct SliceBy8, Tag for the slice-by-8 engine with eight 256-entry tables (4 KB).
+ *
+ * Processes eight bytes per step with independent table lookups.
+ */
+struct SliceBy8 {
+    static constexpr std::size_t slices{8};
+};
+
+} /* namespace Crc16Engine */
+
 namespace __Internal {
 
 /**
@@ -180,6 +243,78 @@ consteval std::array<std::uint16_t, 256> __GenerateCrc16Table() noexcept
     return table;
 }
 
+/**
+ * @brief Generate CRC-16 nibble lookup table at compile time.
+ *
+ * @tparam PolynomialV      The CRC polynomial.
+ * @tparam ReflectInputV    Whether input reflection is enabled.
+ */
+template <std::uint16_t PolynomialV, bool ReflectInputV>
+[[nodiscard]]
+consteval std::array<std::uint16_t, 16> __GenerateCrc16NibbleTable() noexcept
+{
+    std::array<std::uint16_t, 16> table{};
+
+    for (std::size_t i = 0; i < 16; ++i) {
+        std::uint16_t crc{};
+
+        if constexpr (ReflectInputV) {
+            crc = static_cast<std::uint16_t>(i);
+            for (int j = 0; j < 4; ++j) {
+                if (crc & 0x0001) {
+                    crc = static_cast<std::uint16_t>((crc >> 1) ^ __Reflect16(PolynomialV));
+                } else {
+                    crc >>= 1;
+                }
+            }
+        } else {
+            crc = static_cast<std::uint16_t>(i << 12);
+            for (int j = 0; j < 4; ++j) {
+                if (crc & 0x8000) {
+                    crc = static_cast<std::uint16_t>((crc << 1) ^ PolynomialV);
+                } else {
+                    crc <<= 1;
+                }
+            }
+        }
+
+        table[i] = crc;
+    }
+
+    return table;
+}
+
+/**
+ * @brief Generate CRC-16 slicing lookup tables at compile time.
+ *
+ * Table k holds the CRC of a byte followed by k zero bytes, table 0 is
+ * identical to the one generated by __GenerateCrc16Table.
+ *
+ * @tparam PolynomialV      The CRC polynomial.
+ * @tparam ReflectInputV    Whether input reflection is enabled.
+ * @tparam SlicesV          Number of tables.
+ */
+template <std::uint16_t PolynomialV, bool ReflectInputV, std::size_t SlicesV>
+[[nodiscard]]
+consteval std::array<std::array<std::uint16_t, 256>, SlicesV> __GenerateCrc16SliceTables() noexcept
+{
+    std::array<std::array<std::uint16_t, 256>, SlicesV> tables{};
+    tables[0] = __GenerateCrc16Table<PolynomialV, ReflectInputV>();
+
+    for (std::size_t k = 1; k < SlicesV; ++k) {
+        for (std::size_t i = 0; i < 256; ++i) {
+            const std::uint16_t previous = tables[k - 1][i];
+            if constexpr (ReflectInputV) {
+                tables[k][i] = static_cast<std::uint16_t>((previous >> 8) ^ tables[0][previous & 0xFF]);
+            } else {
+                tables[k][i] = static_cast<std::uint16_t>((previous << 8) ^ tables[0][previous >> 8]);
+            }
+        }
+    }
+
+    return tables;
+}
+
 } /* namespace __Internal */
 
 /**
@@ -227,6 +362,18 @@ concept IsCrc16ReflectOutput = requires {
     { T::value } -> std::convertible_to<bool>;
 };
 
+/**
+ * @concept IsCrc16Engine
+ * @brief Checks if a type is a valid CRC-16 software engine tag.
+ */
+template <typename T>
+concept IsCrc16Engine =
+    std::same_as<T, Crc16Engine::Bitwise> ||
+    std::same_as<T, Crc16Engine::Nibble> ||
+    std::same_as<T, Crc16Engine::Table> ||
+    std::same_as<T, Crc16Engine::SliceBy4> ||
+    std::same_as<T, Crc16Engine::SliceBy8>;
+
 /**
  * @concept IsCrc16Data
  * @brief Checks if a type is a valid data source for CRC calculation.
@@ -241,16 +388,17 @@ concept IsCrc16Data =
  * @class Crc16, A compile-time configurable CRC-16 calculator.
  * 
  * All CRC parameters are template arguments for self-documentation and
- * compile-time validation. Uses an optimized lookup table generated at
- * compile time for fast byte-at-a-time processing.
+ * compile-time validation. Uses lookup tables generated at compile time,
+ * processed bit-, nibble-, byte- or several bytes at a time (see Crc16Engine).
  * 
  * @tparam PolynomialT      CRC polynomial (e.g., Crc16Polynomial<0x1021>).
  * @tparam InitialValueT    Initial CRC value (e.g., Crc16InitialValue<0xFFFF>).
  * @tparam FinalXorT        Final XOR value (e.g., Crc16FinalXor<0x0000>).
  * @tparam ReflectInputT    Input reflection flag (e.g., Crc16ReflectInput<false>).
  * @tparam ReflectOutputT   Output reflection flag (e.g., Crc16ReflectOutput<false>).
+ * @tparam EngineT          Software engine (default is Crc16Engine::Table).
  * 
- * @note The lookup table is generated at compile time (consteval).
+ * @note The lookup tables are generated at compile time (consteval).
  * @note All Calculate methods are constexpr and can be evaluated at compile time.
  * 
  * @example Usage:
@@ -275,6 +423,14 @@ concept IsCrc16Data =
  * // Compile-time calculation
  * constexpr std::array<std::uint8_t, 4> test_data{0x31, 0x32, 0x33, 0x34};
  * constexpr auto compile_time_crc = MyCrc::Calculate(test_data);
+ *
+ * // Faster engine for large blocks, same result
+ * using FastModbus = STM32::Crc16Modbus::WithEngine<STM32::Crc16Engine::SliceBy8>;
+ * auto fast_crc = FastModbus::Calculate(data);
+ *
+ * // Smaller engine for a rarely used variant, same result
+ * using SmallX25 = STM32::Crc16X25::WithEngine<STM32::Crc16Engine::Nibble>;
+ * auto small_crc = SmallX25::Calculate(data);
  * @endcode
  */
 template <
@@ -282,10 +438,20 @@ template <
     IsCrc16InitialValue InitialValueT,
     IsCrc16FinalXor FinalXorT,
     IsCrc16ReflectInput ReflectInputT,
-    IsCrc16ReflectOutput ReflectOutputT
+    IsCrc16ReflectOutput ReflectOutputT,
+    IsCrc16Engine EngineT = Crc16Engine::Table
 >
 class Crc16 {
 public:
+    /** @brief The same CRC-16 variant computed by another software engine. */
+    template <IsCrc16Engine OtherEngineT>
+    using WithEngine = Crc16<
+        PolynomialT, InitialValueT, FinalXorT, ReflectInputT, ReflectOutputT, OtherEngineT
+    >;
+
+    /** @brief The software engine used. */
+    using EngineTypeT = EngineT;
+
     /** @brief The CRC polynomial used. */
     static constexpr std::uint16_t polynomial = PolynomialT::value;
     
@@ -328,28 +494,7 @@ public:
         std::size_t length
     ) noexcept
     {
-        std::uint16_t crc = initial_value;
-        
-        if constexpr (reflect_input) {
-            // Reflected algorithm (LSB first)
-            for (std::size_t i = 0; i < length; ++i) {
-                std::uint8_t index = static_cast<std::uint8_t>(crc ^ data[i]);
-                crc = static_cast<std::uint16_t>((crc >> 8) ^ s_table[index]);
-            }
-        } else {
-            // Non-reflected algorithm (MSB first)
-            for (std::size_t i = 0; i < length; ++i) {
-                std::uint8_t index = static_cast<std::uint8_t>((crc >> 8) ^ data[i]);
-                crc = static_cast<std::uint16_t>((crc << 8) ^ s_table[index]);
-            }
-        }
-        
-        // Apply output reflection if different from input reflection
-        if constexpr (reflect_output != reflect_input) {
-            crc = __Internal::__Reflect16(crc);
-        }
-        
-        return crc ^ final_xor;
+        return Finalize(Process(initial_value, data, length));
     }
 
     /**
@@ -368,18 +513,7 @@ public:
         IsCrc16Data auto const& data
     ) noexcept
     {
-        if constexpr (reflect_input) {
-            for (const auto byte : data) {
-                std::uint8_t index = static_cast<std::uint8_t>(crc ^ byte);
-                crc = static_cast<std::uint16_t>((crc >> 8) ^ s_table[index]);
-            }
-        } else {
-            for (const auto byte : data) {
-                std::uint8_t index = static_cast<std::uint8_t>((crc >> 8) ^ byte);
-                crc = static_cast<std::uint16_t>((crc << 8) ^ s_table[index]);
-            }
-        }
-        return crc;
+        return Process(crc, std::ranges::data(data), std::ranges::size(data));
     }
 
     /**
@@ -413,17 +547,261 @@ public:
      * @brief Access the precomputed lookup table.
      * 
      * @returns Reference to the 256-entry lookup table.
+     *
+     * @note With the Bitwise and Nibble engines, the table is only placed in flash
+     *       if this function is used.
      */
     [[nodiscard]]
     static constexpr const std::array<std::uint16_t, 256>& Table() noexcept
     {
-        return s_table;
+        if constexpr (s_slices == 1) {
+            return s_table;
+        } else {
+            return s_slice_tables[0];
+        }
     }
 
 private:
+    static constexpr std::size_t s_slices{EngineT::slices};
+
+    static constexpr std::uint16_t s_reflected_polynomial{__Internal::__Reflect16(polynomial)};
+
     /** @brief Compile-time generated lookup table. */
     static constexpr std::array<std::uint16_t, 256> s_table = 
         __Internal::__GenerateCrc16Table<polynomial, reflect_input>();
+
+    /** @brief Compile-time generated nibble lookup table, only instantiated by the nibble engine. */
+    static constexpr std::array<std::uint16_t, 16> s_nibble_table =
+        __Internal::__GenerateCrc16NibbleTable<polynomial, reflect_input>();
+
+    /** @brief Compile-time generated slicing lookup tables, only instantiated by slicing engines. */
+    static constexpr std::array<std::array<std::uint16_t, 256>, s_slices> s_slice_tables =
+        __Internal::__GenerateCrc16SliceTables<polynomial, reflect_input, s_slices>();
+
+    /**
+     * @brief Process bytes one at a time.
+     */
+    [[nodiscard]]
+    static constexpr std::uint16_t ProcessBytes(
+        std::uint16_t crc,
+        const std::uint8_t* data,
+        std::size_t length
+    ) noexcept
+    {
+        const auto& table = Table();
+        if constexpr (reflect_input) {
+            // Reflected algorithm (LSB first)
+            for (std::size_t i = 0; i < length; ++i) {
+                std::uint8_t index = static_cast<std::uint8_t>(crc ^ data[i]);
+                crc = static_cast<std::uint16_t>((crc >> 8) ^ table[index]);
+            }
+        } else {
+            // Non-reflected algorithm (MSB first)
+            for (std::size_t i = 0; i < length; ++i) {
+                std::uint8_t index = static_cast<std::uint8_t>((crc >> 8) ^ data[i]);
+                crc = static_cast<std::uint16_t>((crc << 8) ^ table[index]);
+            }
+        }
+        return crc;
+    }
+
+    /**
+     * @brief Process bytes one bit at a time, without any table.
+     */
+    [[nodiscard]]
+    static constexpr std::uint16_t ProcessBits(
+        std::uint16_t crc,
+        const std::uint8_t* data,
+        std::size_t length
+    ) noexcept
+    {
+        for (std::size_t i = 0; i < length; ++i) {
+            if constexpr (reflect_input) {
+                crc = static_cast<std::uint16_t>(crc ^ data[i]);
+                for (int j = 0; j < 8; ++j) {
+                    const auto mask = static_cast<std::uint16_t>(-(crc & 0x0001));
+                    crc = static_cast<std::uint16_t>((crc >> 1) ^ (s_reflected_polynomial & mask));
+                }
+            } else {
+                crc = static_cast<std::uint16_t>(crc ^ (data[i] << 8));
+                for (int j = 0; j < 8; ++j) {
+                    const auto mask = static_cast<std::uint16_t>(-(crc >> 15));
+                    crc = static_cast<std::uint16_t>((crc << 1) ^ (polynomial & mask));
+                }
+            }
+        }
+        return crc;
+    }
+
+    /**
+     * @brief Process bytes one nibble at a time.
+     */
+    [[nodiscard]]
+    static constexpr std::uint16_t ProcessNibbles(
+        std::uint16_t crc,
+        const std::uint8_t* data,
+        std::size_t length
+    ) noexcept
+    {
+        for (std::size_t i = 0; i < length; ++i) {
+            if constexpr (reflect_input) {
+                // Low nibble first
+                crc = static_cast<std::uint16_t>((crc >> 4) ^ s_nibble_table[(crc ^ data[i]) & 0x0F]);
+                crc = static_cast<std::uint16_t>((crc >> 4) ^ s_nibble_table[(crc ^ (data[i] >> 4)) & 0x0F]);
+            } else {
+                // High nibble first
+                crc = static_cast<std::uint16_t>((crc << 4) ^ s_nibble_table[(crc >> 12) ^ (data[i] >> 4)]);
+                crc = static_cast<std::uint16_t>((crc << 4) ^ s_nibble_table[(crc >> 12) ^ (data[i] & 0x0F)]);
+            }
+        }
+        return crc;
+    }
+
+    /**
+     * @brief Process bytes with the configured engine, without finalization.
+     */
+    [[nodiscard]]
+    static constexpr std::uint16_t Process(
+        std::uint16_t crc,
+        const std::uint8_t* data,
+        std::size_t length
+    ) noexcept
+    {
+        if constexpr (std::same_as<EngineT, Crc16Engine::Bitwise>) {
+            return ProcessBits(crc, data, length);
+        } else if constexpr (std::same_as<EngineT, Crc16Engine::Nibble>) {
+            return ProcessNibbles(crc, data, length);
+        } else {
+            if constexpr (s_slices > 1) {
+                constexpr auto& tables = s_slice_tables;
+                for (; length >= s_slices; length -= s_slices, data += s_slices) {
+                    // The first two bytes are folded into the CRC register,
+                    // the remaining bytes only depend on their table.
+                    std::uint16_t next{};
+                    if constexpr (reflect_input) {
+                        crc = static_cast<std::uint16_t>(crc ^ (data[0] | (data[1] << 8)));
+                        next = static_cast<std::uint16_t>(
+                            tables[s_slices - 1][crc & 0xFF] ^ tables[s_slices - 2][crc >> 8]
+                        );
+                    } else {
+                        crc = static_cast<std::uint16_t>(crc ^ ((data[0] << 8) | data[1]));
+                        next = static_cast<std::uint16_t>(
+                            tables[s_slices - 1][crc >> 8] ^ tables[s_slices - 2][crc & 0xFF]
+                        );
+                    }
+                    for (std::size_t k = 2; k < s_slices; ++k) {
+                        next = static_cast<std::uint16_t>(next ^ tables[s_slices - 1 - k][data[k]]);
+                    }
+                    crc = next;
+                }
+            }
+            return ProcessBytes(crc, data, length);
+        }
+    }
+};
+
+/**
+ * @concept IsCrc16
+ * @brief Checks if a type is a Crc16 configuration.
+ */
+template <typename T>
+concept IsCrc16 =
+    std::same_as<std::remove_cv_t<decltype(T::polynomial)>, std::uint16_t> &&
+    std::same_as<std::remove_cv_t<decltype(T::initial_value)>, std::uint16_t> &&
+    std::same_as<std::remove_cv_t<decltype(T::final_xor)>, std::uint16_t> &&
+    std::same_as<std::remove_cv_t<decltype(T::reflect_input)>, bool> &&
+    std::same_as<std::remove_cv_t<decltype(T::reflect_output)>, bool> &&
+    requires (std::uint16_t crc, std::span<const std::uint8_t> data) {
+        { T::Init() } -> std::same_as<std::uint16_t>;
+        { T::Update(crc, data) } -> std::same_as<std::uint16_t>;
+        { T::Finalize(crc) } -> std::same_as<std::uint16_t>;
+    };
+
+/**
+ * @class Crc16Stream, An incremental CRC-16 accumulator for data arriving in chunks.
+ *
+ * Keeps the running CRC between Update() calls, so the checksum of a transfer is
+ * computed while it is received (e.g., from DMA half/complete or receive event
+ * callbacks) instead of in a second pass over the whole buffer.
+ *
+ * @tparam Crc16T       CRC-16 configuration (e.g., Crc16Modbus, Crc16CcittFalse).
+ *
+ * @note One context may call Update() (e.g., an ISR) while another reads Value() or Size().
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Crc16.hpp>
+ *
+ * STM32::Crc16Stream<STM32::Crc16CcittFalse::WithEngine<STM32::Crc16Engine::SliceBy8>> image_crc{};
+ *
+ * uart.CircularReceiveTo(rx_buffer, [&](std::span<const char> chunk){
+ *     image_crc.Update(chunk);
+ *     // ... store chunk
+ * });
+ *
+ * // After the last byte
+ * bool valid = (image_crc.Value() == expected_crc);
+ * @endcode
+ */
+template <IsCrc16 Crc16T>
+class Crc16Stream {
+public:
+    /** @brief The CRC-16 configuration accumulated. */
+    using Crc16TypeT = Crc16T;
+
+    /**
+     * @brief Restart the calculation from Crc16T::initial_value.
+     */
+    void Reset() noexcept
+    {
+        m_size.store(0, std::memory_order_relaxed);
+        m_crc.store(Crc16T::Init(), std::memory_order_release);
+    }
+
+    /**
+     * @brief Accumulate a chunk of bytes.
+     *
+     * @param data      A contiguous range of bytes.
+     */
+    void Update(IsCrc16Data auto const& data) noexcept
+    {
+        m_size.store(m_size.load(std::memory_order_relaxed) + std::ranges::size(data), std::memory_order_relaxed);
+        m_crc.store(Crc16T::Update(m_crc.load(std::memory_order_relaxed), data), std::memory_order_release);
+    }
+
+    /**
+     * @brief Accumulate a chunk of characters (e.g., from Uart receive callbacks).
+     *
+     * @param data      Characters to accumulate as bytes.
+     */
+    void Update(std::span<const char> data) noexcept
+    {
+        Update(std::span<const std::uint8_t>{
+            reinterpret_cast<const std::uint8_t*>(data.data()), data.size()
+        });
+    }
+
+    /**
+     * @returns The finalized CRC-16 of all accumulated bytes.
+     */
+    [[nodiscard]]
+    std::uint16_t Value() const noexcept
+    {
+        return Crc16T::Finalize(m_crc.load(std::memory_order_acquire));
+    }
+
+    /**
+     * @returns Number of accumulated bytes.
+     */
+    [[nodiscard]]
+    std::size_t Size() const noexcept
+    {
+        return m_size.load(std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic<std::uint16_t> m_crc{Crc16T::Init()};
+    std::atomic<std::size_t> m_size{};
 };
 
 /* ==================== Predefined CRC-16 Variants ==================== */
@@ -0,0 +1,216 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_CRC16_HARDWARE_HPP
+#define STM32_CRC16_HARDWARE_HPP
+
+#include <cstdint>
+#include <ranges>
+#include <utility>
+
+#include "Crc16.hpp"
+
+#include "main.h"
+
+#if !defined(HAL_CRC_MODULE_ENABLED) /* module check */
+#error "HAL CRC module is not enabled!"
+#endif /* module check */
+
+#if !defined(CRC_POLYLENGTH_16B) /* module check */
+#error "CRC unit does not support programmable 16-bit polynomials!"
+#endif /* module check */
+
+namespace STM32 {
+
+/**
+ * @class Crc16Hardware, A class to calculate CRC-16 with the STM32 hardware CRC unit.
+ *
+ * Programs the CRC unit with the polynomial, initial value and reflection settings
+ * of a Crc16 configuration, so results are bit-exact with the software Crc16 engines.
+ * The final XOR is applied in software.
+ *
+ * @tparam Crc16T       CRC-16 configuration (e.g., Crc16Modbus, Crc16CcittFalse).
+ *
+ * @note Crc16Hardware class is non-copyable and non-movable.
+ * @note Requires a CRC unit with programmable polynomial size (e.g., STM32F0x2, F3, F7,
+ *       G0, G4, L0, L4, H7). CubeMX settings of the CRC unit are overwritten by Configure().
+ * @note When several Crc16Hardware instances share one CRC unit, call Configure()
+ *       each time the unit is switched to another instance.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Crc16Hardware.hpp>
+ *
+ * CRC_HandleTypeDef hcrc; // Assume initialized by CubeMX
+ *
+ * STM32::Crc16Hardware<STM32::Crc16Modbus> crc{hcrc};
+ * crc.Configure();
+ *
+ * std::array<std::uint8_t, 6> frame{0x01, 0x03, 0x00, 0x00, 0x00, 0x0A};
+ * auto checksum = crc.Calculate(frame); // Same as Crc16Modbus::Calculate(frame)
+ *
+ * // Streaming
+ * crc.Reset();
+ * auto partial = crc.Update(first_chunk);
+ * partial = crc.Update(second_chunk);
+ * auto result = STM32::Crc16Modbus::Finalize(partial);
+ * @endcode
+ */
+template <IsCrc16 Crc16T>
+class Crc16Hardware {
+public:
+    /** @brief The CRC-16 configuration computed by the hardware. */
+    using Crc16TypeT = Crc16T;
+
+    /**
+     * @brief Construct Crc16Hardware class.
+     *
+     * @param handle        Reference to the CRC handle.
+     *
+     * @note Call Configure() before the first calculation.
+     */
+    explicit Crc16Hardware(CRC_HandleTypeDef& handle) noexcept
+      : m_handle{handle}
+    { }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    Crc16Hardware(const Crc16Hardware&) = delete;
+    Crc16Hardware& operator=(const Crc16Hardware&) = delete;
+    Crc16Hardware(Crc16Hardware&&) = delete;
+    Crc16Hardware& operator=(Crc16Hardware&&) = delete;
+    /** @} */
+
+    /**
+     * @returns CRC handle reference.
+     */
+    [[nodiscard]]
+    auto&& GetHandle(this auto&& self) noexcept
+    {
+        return std::forward<decltype(self)>(self).m_handle;
+    }
+
+    /**
+     * @brief Program the CRC unit for Crc16T.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Configure() noexcept
+    {
+        m_handle.Init.DefaultPolynomialUse = DEFAULT_POLYNOMIAL_DISABLE;
+        m_handle.Init.GeneratingPolynomial = Crc16T::polynomial;
+        m_handle.Init.CRCLength = CRC_POLYLENGTH_16B;
+        m_handle.Init.DefaultInitValueUse = DEFAULT_INIT_VALUE_DISABLE;
+        m_handle.Init.InitValue = s_hardware_initial_value;
+        m_handle.Init.InputDataInversionMode =
+            Crc16T::reflect_input ? CRC_INPUTDATA_INVERSION_BYTE : CRC_INPUTDATA_INVERSION_NONE;
+        m_handle.Init.OutputDataInversionMode =
+            Crc16T::reflect_output ? CRC_OUTPUTDATA_INVERSION_ENABLE : CRC_OUTPUTDATA_INVERSION_DISABLE;
+        m_handle.InputDataFormat = CRC_INPUTDATA_FORMAT_BYTES;
+        return (HAL_OK == HAL_CRC_Init(&m_handle));
+    }
+
+    /**
+     * @brief Calculate CRC-16 of a contiguous byte range.
+     *
+     * @param data      A contiguous range of bytes (std::array, std::vector, std::span, etc.).
+     *
+     * @returns The calculated CRC-16 value, equal to Crc16T::Calculate(data).
+     */
+    [[nodiscard]]
+    std::uint16_t Calculate(IsCrc16Data auto const& data) noexcept
+    {
+        return Crc16T::Finalize(ToSoftware(HAL_CRC_Calculate(
+            &m_handle, ToBuffer(data), static_cast<std::uint32_t>(std::ranges::size(data))
+        )));
+    }
+
+    /**
+     * @brief Restart a streaming calculation from Crc16T::initial_value.
+     */
+    void Reset() noexcept
+    {
+        __HAL_CRC_DR_RESET(&m_handle);
+    }
+
+    /**
+     * @brief Continue a streaming calculation with additional data.
+     *
+     * @param data      A contiguous range of bytes to process.
+     *
+     * @returns The intermediate CRC-16 value, equal to the value Crc16T::Update() returns.
+     *
+     * @note To finalize, call Crc16T::Finalize() with the returned value.
+     */
+    [[nodiscard]]
+    std::uint16_t Update(IsCrc16Data auto const& data) noexcept
+    {
+        return ToSoftware(HAL_CRC_Accumulate(
+            &m_handle, ToBuffer(data), static_cast<std::uint32_t>(std::ranges::size(data))
+        ));
+    }
+
+    /**
+     * @returns The intermediate CRC-16 value of the data written so far.
+     *
+     * @note Useful when the CRC unit is fed by DMA, see Crc16HardwareDma.
+     */
+    [[nodiscard]]
+    std::uint16_t Intermediate() const noexcept
+    {
+        return ToSoftware(m_handle.Instance->DR);
+    }
+
+    /**
+     * @returns Address of the CRC data register, the destination of DMA transfers.
+     */
+    [[nodiscard]]
+    std::uint32_t DataRegisterAddress() const noexcept
+    {
+        return static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&m_handle.Instance->DR));
+    }
+
+private:
+    CRC_HandleTypeDef& m_handle;
+
+    /** @brief The CRC unit shifts MSB first, so a reflected register starts reflected. */
+    static constexpr std::uint16_t s_hardware_initial_value{
+        Crc16T::reflect_input ?
+            __Internal::__Reflect16(Crc16T::initial_value) : Crc16T::initial_value
+    };
+
+    /**
+     * @returns HAL buffer pointer of a byte range.
+     *
+     * @note HAL reads the buffer byte by byte in CRC_INPUTDATA_FORMAT_BYTES mode.
+     */
+    static std::uint32_t* ToBuffer(IsCrc16Data auto const& data) noexcept
+    {
+        return reinterpret_cast<std::uint32_t*>(
+            const_cast<std::uint8_t*>(std::ranges::data(data))
+        );
+    }
+
+    /**
+     * @brief Convert the data register to the register value of the software engines.
+     *
+     * @param value     Data register value (output inversion applied).
+     *
+     * @returns Intermediate CRC-16 value accepted by Crc16T::Update() and Crc16T::Finalize().
+     */
+    static constexpr std::uint16_t ToSoftware(std::uint32_t value) noexcept
+    {
+        const auto crc = static_cast<std::uint16_t>(value);
+        if constexpr (Crc16T::reflect_input != Crc16T::reflect_output) {
+            return __Internal::__Reflect16(crc);
+        } else {
+            return crc;
+        }
+    }
+};
+
+} /* namespace STM32 */
+
+#endif /* STM32_CRC16_HARDWARE_HPP */
@@ -0,0 +1,378 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_CRC16_HARDWARE_DMA_HPP
+#define STM32_CRC16_HARDWARE_DMA_HPP
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <span>
+#include <utility>
+
+#include "__Internal/__Utility.hpp"
+#include "Crc16Hardware.hpp"
+
+#include "main.h"
+
+#if !defined(HAL_DMA_MODULE_ENABLED) /* module check */
+#error "HAL DMA module is not enabled!"
+#endif /* module check */
+
+namespace STM32 {
+
+/**
+ * @struct Crc16HardwareDmaCapacity, A utility struct to hold the Crc16HardwareDma chunk queue capacity.
+ *
+ * @tparam CapacityV    Maximum number of queued chunks (must be a power of two).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Crc16HardwareDma.hpp>
+ *
+ * using MyChunkCapacity = STM32::Crc16HardwareDmaCapacity<8>;
+ * @endcode
+ */
+template <std::size_t CapacityV>
+struct Crc16HardwareDmaCapacity : __Internal::__Constant<std::size_t, CapacityV> {
+    static_assert(
+        std::has_single_bit(CapacityV),
+        "Capacity must be a power of two"
+    );
+};
+
+/**
+ * @brief IsCrc16HardwareDmaCapacity, A concept to check if a type is a Crc16HardwareDmaCapacity.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Crc16HardwareDma.hpp>
+ *
+ * static_assert(STM32::IsCrc16HardwareDmaCapacity<STM32::Crc16HardwareDmaCapacity<4>>);
+ * static_assert(!STM32::IsCrc16HardwareDmaCapacity<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsCrc16HardwareDmaCapacity =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t> &&
+    std::has_single_bit(T::value);
+
+/**
+ * @class Crc16HardwareDma, A class to feed the hardware CRC unit with memory-to-memory DMA.
+ *
+ * Each Update() starts a DMA transfer from memory into the CRC data register and
+ * returns immediately, so the checksum of received chunks is computed in the
+ * background. Feeding each chunk from the receive callbacks of a peripheral
+ * (e.g., Uart::CircularReceiveTo) makes the result ready right after the last byte.
+ *
+ * @tparam Crc16T       CRC-16 configuration (e.g., Crc16Modbus, Crc16CcittFalse).
+ * @tparam UniqueTagT   Unique tag type to differentiate multiple Crc16HardwareDma instances.
+ *                      UniqueTagT must be STM32_UNIQUE_TAG.
+ * @tparam CapacityT    Maximum number of queued chunks (default is 4).
+ *
+ * @note Crc16HardwareDma class is non-copyable and non-movable.
+ * @note Required DMA configuration: memory-to-memory direction, source increment,
+ *       no destination increment, byte data width on both sides, normal mode.
+ * @note Chunks fed while a transfer is ongoing are queued and transferred in order,
+ *       the next one is started from the transfer complete interrupt. E.g.,
+ *       Uart::CircularReceiveTo reports data wrapping the ring as two chunks in a row.
+ * @note A chunk that cannot be queued (queue full, larger than 65535 bytes) or fails
+ *       to transfer latches IsFailed() until the next Reset().
+ * @note Chunks must not be overwritten until their transfer has completed.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Crc16HardwareDma.hpp>
+ *
+ * CRC_HandleTypeDef hcrc;              // Assume initialized by CubeMX
+ * DMA_HandleTypeDef hdma_memtomem;     // Memory-to-memory, byte width
+ *
+ * STM32::Crc16Hardware<STM32::Crc16CcittFalse> crc{hcrc};
+ * STM32::Crc16HardwareDma<STM32::Crc16CcittFalse, STM32_UNIQUE_TAG> crc_dma{crc, hdma_memtomem};
+ *
+ * crc.Configure();
+ * crc_dma.Reset();
+ * uart.CircularReceiveTo(rx_buffer, [&](std::span<const char> chunk){
+ *     crc_dma.Update(chunk);
+ * });
+ *
+ * // After the last chunk has been transferred
+ * bool valid = !crc_dma.IsBusy() && !crc_dma.IsFailed() && (crc_dma.Value() == expected_crc);
+ * @endcode
+ */
+template <
+    IsCrc16 Crc16T,
+    __Internal::__IsUniqueTag UniqueTagT,
+    IsCrc16HardwareDmaCapacity CapacityT = Crc16HardwareDmaCapacity<4>
+>
+class Crc16HardwareDma {
+    using TransferCompleteCallbackT = __Internal::__CallbackManager<
+        DMA_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_DMA_RegisterCallback, HAL_DMA_UnRegisterCallback, HAL_DMA_XFER_CPLT_CB_ID
+    >;
+    using TransferErrorCallbackT = __Internal::__CallbackManager<
+        DMA_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_DMA_RegisterCallback, HAL_DMA_UnRegisterCallback, HAL_DMA_XFER_ERROR_CB_ID
+    >;
+
+    /**
+     * @struct Chunk, Descriptor of a queued chunk.
+     */
+    struct Chunk {
+        const std::uint8_t* data;
+        std::uint16_t length;
+    };
+public:
+
+    /**
+     * @brief Construct Crc16HardwareDma class.
+     *
+     * @param crc           Reference to the configured hardware CRC unit.
+     * @param dma_handle    Reference to the memory-to-memory DMA handle.
+     *
+     * @note HAL callbacks are automatically registered via RAII.
+     */
+    Crc16HardwareDma(Crc16Hardware<Crc16T>& crc, DMA_HandleTypeDef& dma_handle) noexcept
+      : m_crc{crc},
+        m_dma_handle{dma_handle},
+        m_transfer_complete_callback{dma_handle},
+        m_transfer_error_callback{dma_handle}
+    {
+        m_transfer_complete_callback.Set([this](){
+            OnTransferComplete(true);
+        });
+        m_transfer_error_callback.Set([this](){
+            OnTransferComplete(false);
+        });
+    }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    Crc16HardwareDma(const Crc16HardwareDma&) = delete;
+    Crc16HardwareDma& operator=(const Crc16HardwareDma&) = delete;
+    Crc16HardwareDma(Crc16HardwareDma&&) = delete;
+    Crc16HardwareDma& operator=(Crc16HardwareDma&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy Crc16HardwareDma class, aborts an ongoing transfer and drops queued chunks.
+     *
+     * @note Callbacks are automatically unregistered via RAII.
+     */
+    ~Crc16HardwareDma()
+    {
+        if (IsBusy()) {
+            HAL_DMA_Abort(&m_dma_handle);
+        }
+    }
+
+    /**
+     * @returns Maximum number of queued chunks.
+     */
+    [[nodiscard]]
+    static constexpr std::size_t Capacity() noexcept
+    {
+        return CapacityT::value;
+    }
+
+    /**
+     * @returns DMA handle reference.
+     */
+    [[nodiscard]]
+    auto&& GetDmaHandle(this auto&& self) noexcept
+    {
+        return std::forward<decltype(self)>(self).m_dma_handle;
+    }
+
+    /**
+     * @brief Restart the calculation from Crc16T::initial_value.
+     *
+     * @returns True on success, false if a chunk is queued or being transferred.
+     */
+    bool Reset() noexcept
+    {
+        if (IsBusy()) {
+            return false;
+        }
+        m_crc.Reset();
+        m_is_failed.store(false, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * @brief Queue a chunk of bytes for transferring into the CRC unit.
+     *
+     * @param data      A contiguous range of bytes, kept alive until the transfer completes.
+     * @param callback  Callback function to be called when the chunk has been processed.
+     *
+     * @returns True if the chunk is queued, false if the queue is full, the chunk is larger
+     *          than a single DMA transfer (65535 bytes) or DMA failed to start,
+     *          IsFailed() is latched then.
+     */
+    bool Update(IsCrc16Data auto const& data, CallbackT&& callback = [](){}) noexcept
+    {
+        return Start(std::ranges::data(data), std::ranges::size(data), std::move(callback));
+    }
+
+    /**
+     * @brief Queue a chunk of characters (e.g., from Uart receive callbacks).
+     *
+     * @param data      Characters to process as bytes, kept alive until the transfer completes.
+     * @param callback  Callback function to be called when the chunk has been processed.
+     *
+     * @returns True if the chunk is queued, false otherwise (IsFailed() is latched then).
+     */
+    bool Update(std::span<const char> data, CallbackT&& callback = [](){}) noexcept
+    {
+        return Start(
+            reinterpret_cast<const std::uint8_t*>(data.data()), data.size(), std::move(callback)
+        );
+    }
+
+    /**
+     * @returns True while chunks are queued or being transferred.
+     */
+    [[nodiscard]]
+    bool IsBusy() const noexcept
+    {
+        return m_is_busy.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @returns True if a transfer has failed since the last Reset(), the value is invalid then.
+     */
+    [[nodiscard]]
+    bool IsFailed() const noexcept
+    {
+        return m_is_failed.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @returns The finalized CRC-16 of all transferred chunks.
+     *
+     * @note Only valid while not busy.
+     */
+    [[nodiscard]]
+    std::uint16_t Value() const noexcept
+    {
+        return Crc16T::Finalize(m_crc.Intermediate());
+    }
+
+private:
+    Crc16Hardware<Crc16T>& m_crc;
+    DMA_HandleTypeDef& m_dma_handle;
+    TransferCompleteCallbackT m_transfer_complete_callback;
+    TransferErrorCallbackT m_transfer_error_callback;
+    __Internal::__RingBuffer<Chunk, CapacityT::value> m_chunks{};
+    std::array<CallbackT, CapacityT::value> m_callbacks{};
+    std::size_t m_write_index{};
+    std::size_t m_read_index{};
+    std::atomic<bool> m_is_busy{};
+    std::atomic<bool> m_is_failed{};
+
+    static constexpr std::size_t s_index_mask{CapacityT::value - 1};
+
+    /**
+     * @brief Append a chunk and start it if no transfer is ongoing.
+     *
+     * An empty chunk completes without DMA, right away if no chunk is queued ahead of it.
+     *
+     * @returns True if the chunk is queued or completed, false otherwise.
+     */
+    bool Start(const std::uint8_t* data, std::size_t length, CallbackT&& callback) noexcept
+    {
+        {
+            __Internal::__CriticalSection critical_section{};
+            if ((length > std::numeric_limits<std::uint16_t>::max()) || m_chunks.IsFull()) {
+                m_is_failed.store(true, std::memory_order_relaxed);
+                return false;
+            }
+            if (length != 0 || m_is_busy.load(std::memory_order_relaxed)) {
+                m_callbacks[m_write_index++ & s_index_mask] = std::move(callback);
+                m_chunks.Push(Chunk{data, static_cast<std::uint16_t>(length)});
+                if (!m_is_busy.load(std::memory_order_relaxed)) {
+                    StartNext();
+                    return m_is_busy.load(std::memory_order_relaxed);
+                }
+                return true;
+            }
+        }
+        if (callback) {
+            callback();
+        }
+        return true;
+    }
+
+    /**
+     * @brief Start the oldest queued chunk, completing the empty ones and the ones that fail to start.
+     */
+    void StartNext() noexcept
+    {
+        while (!m_chunks.IsEmpty()) {
+            const auto& chunk = m_chunks.Front();
+            if (chunk.length == 0) {
+                Release();
+                continue;
+            }
+            if (HAL_OK == HAL_DMA_Start_IT(
+                &m_dma_handle,
+                static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(chunk.data)),
+                m_crc.DataRegisterAddress(),
+                chunk.length
+            )) {
+                m_is_busy.store(true, std::memory_order_release);
+                return;
+            }
+            m_is_failed.store(true, std::memory_order_relaxed);
+            Release();
+        }
+        m_is_busy.store(false, std::memory_order_release);
+    }
+
+    /**
+     * @brief Pop the oldest chunk and notify its callback.
+     */
+    void Release() noexcept
+    {
+        auto callback = std::move(m_callbacks[m_read_index++ & s_index_mask]);
+        m_chunks.CommitRead(1);
+        if (callback) {
+            callback();
+        }
+    }
+
+    /**
+     * @brief Finish the current chunk, chain the next one and notify its callback.
+     *
+     * @param is_successful     Whether the transfer completed without error.
+     */
+    void OnTransferComplete(bool is_successful) noexcept
+    {
+        if (!m_is_busy.load(std::memory_order_relaxed)) {
+            return;
+        }
+        if (!is_successful) {
+            m_is_failed.store(true, std::memory_order_relaxed);
+        }
+        auto callback = std::move(m_callbacks[m_read_index++ & s_index_mask]);
+        m_chunks.CommitRead(1);
+        StartNext();
+        if (callback) {
+            callback();
+        }
+    }
+};
+
+} /* namespace STM32 */
+
+#endif /* STM32_CRC16_HARDWARE_DMA_HPP */
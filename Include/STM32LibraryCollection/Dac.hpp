@@ -4,7 +4,6 @@
 #ifndef STM32_DAC_HPP
 #define STM32_DAC_HPP
 
-#include <algorithm>
 #include <cstdint>
 #include <utility>
 
@@ -282,7 +281,9 @@ public:
     /**
      * @brief Set DAC output value.
      * 
-     * @param output        Output value to be set.
+     * @param output        Output value to be set, clamped to the input range.
+     *
+     * @note Computed with integer arithmetic only.
      */
     void Set(std::uint32_t output) noexcept
     {
@@ -290,13 +291,7 @@ public:
             &m_handle,
             std::to_underlying(DacChannelV),
             DacConfigT::AlignmentT::alignment,
-            ConvertToDac(
-                std::clamp(
-                    static_cast<double>(output),
-                    DacConfigT::InputRangeT::min_value,
-                    DacConfigT::InputRangeT::max_value
-                )
-            )
+            ConvertToDac(output)
         );
     }
 
@@ -308,17 +303,15 @@ private:
      * 
      * @param output        Output value to convert.
      * 
-     * @returns Corresponding DAC value.
+     * @returns Corresponding DAC value, truncated toward zero.
      */
-    constexpr std::uint32_t ConvertToDac(double output) const noexcept
+    static constexpr std::uint32_t ConvertToDac(std::uint32_t output) noexcept
     {
-        auto normalized{
-            (output - DacConfigT::InputRangeT::min_value) /
-            DacConfigT::InputRangeT::range_size
-        };
-        return static_cast<std::uint32_t>(
-            normalized * DacConfigT::AlignmentT::resolution
-        );
+        return __Internal::__LinearScale<
+            static_cast<std::uint32_t>(DacConfigT::InputRangeT::range_size),
+            static_cast<std::uint32_t>(DacConfigT::AlignmentT::resolution),
+            __Internal::__ScaleRounding::Truncate
+        >::Apply(output);
     }
 };
 
@@ -0,0 +1,488 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_DAC_STREAM_HPP
+#define STM32_DAC_STREAM_HPP
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <utility>
+
+#include "Dac.hpp"
+#include "__Internal/__Utility.hpp"
+
+#include "main.h"
+
+#if !defined(HAL_DMA_MODULE_ENABLED) /* module check */
+#error "HAL DMA module is not enabled!"
+#endif /* module check */
+
+#if (USE_HAL_DAC_REGISTER_CALLBACKS != 1) /* module check */
+#error "HAL DAC callbacks are not enabled!"
+#endif /* module check */
+
+namespace STM32 {
+
+/**
+ * @struct DacSampleCount, A utility struct to configure the number of samples per buffer half.
+ *
+ * @tparam CountV   Number of samples DMA outputs from one half before the refill callback is called.
+ *
+ * Larger values reduce the callback rate at the cost of latency and RAM:
+ * the stream buffer holds 2 * CountV samples.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * // 100 kS/s output, refill every 1 ms
+ * using HundredSamples = STM32::DacSampleCount<100>;
+ * @endcode
+ */
+template <std::size_t CountV>
+struct DacSampleCount : __Internal::__Constant<std::size_t, CountV> {
+    static_assert(
+        1 <= CountV && CountV <= std::numeric_limits<std::uint16_t>::max() / 2,
+        "Sample count must be in the range [1, 32767]!"
+    );
+};
+
+/**
+ * @brief IsDacSampleCount, A concept to check if a type is a DacSampleCount.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/DacStream.hpp>
+ *
+ * static_assert(STM32::IsDacSampleCount<STM32::DacSampleCount<100>>);
+ * static_assert(!STM32::IsDacSampleCount<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsDacSampleCount =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t> &&
+    (1 <= T::value && T::value <= std::numeric_limits<std::uint16_t>::max() / 2);
+
+/**
+ * @class DacWaveform, Compile-time and integer conversions of input values to DAC samples.
+ *
+ * Samples are in the same units as the values written by Dac::Set(), so lookup
+ * tables generated here can be played by DacStream without any conversion at
+ * runtime. Table generators are consteval: the tables are computed by the
+ * compiler and can be placed in flash as constexpr objects.
+ *
+ * @tparam DacConfigT   DAC configuration type (defaults to 0-100 input, 12-bit right-aligned).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/DacStream.hpp>
+ *
+ * using Waveform = STM32::DacWaveform<>;
+ *
+ * // One full-scale sine period in 100 samples, computed at compile time
+ * static constexpr auto sine = Waveform::Sine<100>();
+ *
+ * // Sine between 25% and 75% of the output range
+ * static constexpr auto small_sine = Waveform::Sine<100>(25, 75);
+ *
+ * // Arbitrary waveform from a phase in [0, 1)
+ * static constexpr auto ramp_up = Waveform::Generate<64>([](double phase){
+ *     return 100 * phase * phase;
+ * });
+ *
+ * // Runtime conversion with integer arithmetic only (e.g., in a refill callback)
+ * std::uint16_t sample = Waveform::Convert(42);
+ * @endcode
+ */
+template <
+    IsDacConfig DacConfigT =
+        DacConfig<DacInputMax<100>, DacAlignment::Align12BRight>
+>
+class DacWaveform {
+    static constexpr double s_min{DacConfigT::InputRangeT::min_value};
+    static constexpr double s_max{DacConfigT::InputRangeT::max_value};
+
+    using ScaleT = __Internal::__LinearScale<
+        static_cast<std::uint32_t>(DacConfigT::InputRangeT::range_size),
+        static_cast<std::uint32_t>(DacConfigT::AlignmentT::resolution),
+        __Internal::__ScaleRounding::Truncate
+    >;
+public:
+
+    /**
+     * @brief Convert an input value to a DAC sample.
+     *
+     * @param value     Input value, clamped to the DacConfigT input range.
+     *
+     * @returns DAC sample, equal to the value Dac::Set() writes for the same input.
+     */
+    [[nodiscard]]
+    static constexpr std::uint16_t Convert(std::uint32_t value) noexcept
+    {
+        return static_cast<std::uint16_t>(ScaleT::Apply(value));
+    }
+
+    /**
+     * @brief Generate a lookup table from a waveform function.
+     *
+     * @tparam SizeV        Number of samples in one waveform period.
+     *
+     * @param generator     Function mapping a phase in [0, 1) to an input value,
+     *                      called with `index / SizeV` for each sample.
+     *
+     * @returns DAC samples, input values are clamped to the input range and rounded to nearest.
+     */
+    template <std::size_t SizeV>
+    [[nodiscard]]
+    static consteval std::array<std::uint16_t, SizeV> Generate(auto generator) noexcept
+    {
+        std::array<std::uint16_t, SizeV> table{};
+        for (std::size_t index{}; index < SizeV; ++index) {
+            const double value{std::clamp(
+                static_cast<double>(generator(static_cast<double>(index) / SizeV)), s_min, s_max
+            )};
+            table[index] = static_cast<std::uint16_t>(
+                (value - s_min) / (s_max - s_min) * DacConfigT::AlignmentT::resolution + 0.5
+            );
+        }
+        return table;
+    }
+
+    /**
+     * @brief Generate one sine period, starting at the midpoint and rising.
+     *
+     * @tparam SizeV    Number of samples in one waveform period.
+     *
+     * @param low       Lowest input value of the waveform.
+     * @param high      Highest input value of the waveform.
+     *
+     * @returns DAC samples of the sine.
+     */
+    template <std::size_t SizeV>
+    [[nodiscard]]
+    static consteval std::array<std::uint16_t, SizeV> Sine(double low = s_min, double high = s_max) noexcept
+    {
+        return Generate<SizeV>([low, high](double phase){
+            return low + (high - low) * (1. + Sin(2. * std::numbers::pi * phase)) / 2.;
+        });
+    }
+
+    /**
+     * @brief Generate one triangle period, starting at low and peaking at half period.
+     *
+     * @tparam SizeV    Number of samples in one waveform period.
+     *
+     * @param low       Lowest input value of the waveform.
+     * @param high      Highest input value of the waveform.
+     *
+     * @returns DAC samples of the triangle.
+     */
+    template <std::size_t SizeV>
+    [[nodiscard]]
+    static consteval std::array<std::uint16_t, SizeV> Triangle(double low = s_min, double high = s_max) noexcept
+    {
+        return Generate<SizeV>([low, high](double phase){
+            return low + (high - low) * (phase < .5 ? 2. * phase : 2. * (1. - phase));
+        });
+    }
+
+    /**
+     * @brief Generate one sawtooth period, rising from low towards high.
+     *
+     * @tparam SizeV    Number of samples in one waveform period.
+     *
+     * @param low       Lowest input value of the waveform.
+     * @param high      Highest input value of the waveform.
+     *
+     * @returns DAC samples of the sawtooth.
+     */
+    template <std::size_t SizeV>
+    [[nodiscard]]
+    static consteval std::array<std::uint16_t, SizeV> Sawtooth(double low = s_min, double high = s_max) noexcept
+    {
+        return Generate<SizeV>([low, high](double phase){
+            return low + (high - low) * phase;
+        });
+    }
+
+private:
+
+    /**
+     * @brief Compile-time sine, std::sin is not usable in constant expressions.
+     *
+     * @param x     Angle in radians.
+     *
+     * @returns Sine of x, accurate to double precision.
+     */
+    static constexpr double Sin(double x) noexcept
+    {
+        constexpr double two_pi{2. * std::numbers::pi};
+        x -= two_pi * static_cast<double>(static_cast<std::int64_t>(x / two_pi));
+        if (x > std::numbers::pi) {
+            x -= two_pi;
+        } else if (x < -std::numbers::pi) {
+            x += two_pi;
+        }
+        double term{x};
+        double sum{x};
+        for (int n{1}; n < 20; ++n) {
+            term *= -x * x / ((2. * n) * (2. * n + 1.));
+            sum += term;
+        }
+        return sum;
+    }
+};
+
+/**
+ * @class DacStream, A class to output timer-triggered DAC samples through circular DMA.
+ *
+ * DMA writes one sample to the DAC on each trigger event of a timer without CPU involvement,
+ * so the sample rate is limited by the DAC and the bus instead of the interrupt rate.
+ * Two modes are supported:
+ *
+ * - Play(): a constant lookup table (e.g., from DacWaveform) is repeated forever.
+ *   The output frequency is the trigger rate divided by the table size.
+ * - Start(): an internal ping-pong buffer is refilled by a callback, one half at a time
+ *   while DMA outputs the other half, for waveforms that are computed at runtime.
+ *
+ * @tparam DacChannelV          DAC channel to use (Channel1 or Channel2).
+ * @tparam DacSampleCountT      Number of samples per buffer half (used by Start()).
+ * @tparam UniqueTagT           Unique tag type to differentiate multiple DacStream instances.
+ *                              UniqueTagT must be STM32_UNIQUE_TAG.
+ * @tparam DacConfigT           DAC configuration type (defaults to 0-100 input, 12-bit right-aligned).
+ *
+ * @note DacStream class is non-copyable and non-movable.
+ * @note Do not use a Dac and a DacStream on the same channel at the same time.
+ * @note Required DAC configuration: trigger from a timer TRGO event (update event),
+ *       DMA in circular mode with memory increment and half-word data width.
+ *       The timer must be running (e.g., an STM32::Timer instance), its update rate is the sample rate.
+ * @note Samples are DAC values in the DacConfigT resolution, see DacWaveform.
+ * @note The stream is restarted automatically after a DMA underrun.
+ * @note The refill callback runs in interrupt context and must finish with the half before
+ *       DMA wraps around to it, i.e., within DacSampleCountT sample periods.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/DacStream.hpp>
+ *
+ * DAC_HandleTypeDef hdac;  // Channel 1 triggered by TIM6 TRGO, circular DMA
+ * TIM_HandleTypeDef htim6; // Update event at 100 kHz
+ *
+ * STM32::Timer sample_clock{htim6};
+ * STM32::DacStream<
+ *     STM32::DacChannel::Channel1,
+ *     STM32::DacSampleCount<100>,
+ *     STM32_UNIQUE_TAG
+ * > stream{hdac};
+ *
+ * // 1. 1 kHz sine from a compile-time table, no CPU load
+ * static constexpr auto sine = STM32::DacWaveform<>::Sine<100>();
+ * stream.Play(sine);
+ *
+ * // 2. Runtime generated waveform, refilled every 1 ms
+ * stream.Start([](std::span<std::uint16_t> half){
+ *     for (auto& sample : half) {
+ *         sample = STM32::DacWaveform<>::Convert(NextValue());
+ *     }
+ * });
+ *
+ * stream.Stop();
+ * @endcode
+ */
+template <
+    DacChannel DacChannelV,
+    IsDacSampleCount DacSampleCountT,
+    __Internal::__IsUniqueTag UniqueTagT,
+    IsDacConfig DacConfigT =
+        DacConfig<DacInputMax<100>, DacAlignment::Align12BRight>
+>
+class DacStream {
+    static constexpr bool s_is_channel1{DacChannelV == DacChannel::Channel1};
+
+#if defined(DAC_CHANNEL2_SUPPORT)
+    static constexpr auto s_half_complete_id{s_is_channel1 ? HAL_DAC_CH1_HALF_COMPLETE_CB_ID : HAL_DAC_CH2_HALF_COMPLETE_CB_ID};
+    static constexpr auto s_complete_id{s_is_channel1 ? HAL_DAC_CH1_COMPLETE_CB_ID : HAL_DAC_CH2_COMPLETE_CB_ID};
+    static constexpr auto s_underrun_id{s_is_channel1 ? HAL_DAC_CH1_UNDERRUN_CB_ID : HAL_DAC_CH2_UNDERRUN_CB_ID};
+#else
+    static constexpr auto s_half_complete_id{HAL_DAC_CH1_HALF_COMPLETE_CB_ID};
+    static constexpr auto s_complete_id{HAL_DAC_CH1_COMPLETE_CB_ID};
+    static constexpr auto s_underrun_id{HAL_DAC_CH1_UNDERRUN_CB_ID};
+#endif /* DAC_CHANNEL2_SUPPORT */
+
+    using HalfCompleteCallbackT = __Internal::__CallbackManager<
+        DAC_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_DAC_RegisterCallback, HAL_DAC_UnRegisterCallback, s_half_complete_id
+    >;
+    using CompleteCallbackT = __Internal::__CallbackManager<
+        DAC_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_DAC_RegisterCallback, HAL_DAC_UnRegisterCallback, s_complete_id
+    >;
+    using UnderrunCallbackT = __Internal::__CallbackManager<
+        DAC_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_DAC_RegisterCallback, HAL_DAC_UnRegisterCallback, s_underrun_id
+    >;
+public:
+
+    /** @brief Number of samples handed over per refill callback. */
+    static constexpr std::size_t half_size{DacSampleCountT::value};
+
+    /**
+     * @brief Construct DacStream class.
+     *
+     * @param handle        Reference to the DAC handle.
+     *
+     * @note HAL callbacks are automatically registered via RAII.
+     */
+    explicit DacStream(DAC_HandleTypeDef& handle) noexcept
+      : m_handle{handle},
+        m_half_complete_callback{handle},
+        m_complete_callback{handle},
+        m_underrun_callback{handle}
+    { }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    DacStream(const DacStream&) = delete;
+    DacStream& operator=(const DacStream&) = delete;
+    DacStream(DacStream&&) = delete;
+    DacStream& operator=(DacStream&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy DacStream class, stops streaming.
+     *
+     * @note Callbacks are automatically unregistered via RAII.
+     */
+    ~DacStream()
+    {
+        Stop();
+    }
+
+    /**
+     * @returns DAC handle reference.
+     */
+    [[nodiscard]]
+    auto&& GetHandle(this auto&& self) noexcept
+    {
+        return std::forward<decltype(self)>(self).m_handle;
+    }
+
+    /**
+     * @returns DAC channel.
+     */
+    [[nodiscard]]
+    constexpr auto GetChannel() const noexcept
+    {
+        return DacChannelV;
+    }
+
+    /**
+     * @brief Repeat a lookup table continuously.
+     *
+     * @param table             DAC samples of one period, kept alive while playing (e.g., constexpr table).
+     * @param period_callback   Callback function to be called after each output period of the table.
+     *
+     * @returns True on success, false if the table is empty, larger than 65535 samples or DMA failed to start.
+     */
+    bool Play(std::span<const std::uint16_t> table, CallbackT&& period_callback = [](){}) noexcept
+    {
+        if (table.empty() || table.size() > std::numeric_limits<std::uint16_t>::max()) {
+            return false;
+        }
+        Stop();
+        m_samples = table;
+        m_complete_callback.Set(std::move(period_callback));
+        m_underrun_callback.Set([this](){
+            Restart();
+        });
+        return StartDma();
+    }
+
+    /**
+     * @brief Start continuous output from the internal ping-pong buffer.
+     *
+     * @param refill_callback   Callback function to be called with each buffer half to be filled.
+     *
+     * @returns True on success, false otherwise.
+     *
+     * @note Both halves are filled by refill_callback before the output starts.
+     */
+    bool Start(EventCallbackT<std::span<std::uint16_t>>&& refill_callback) noexcept
+    {
+        Stop();
+        m_refill_callback = std::move(refill_callback);
+        m_refill_callback(std::span<std::uint16_t>{m_buffer}.first(half_size));
+        m_refill_callback(std::span<std::uint16_t>{m_buffer}.last(half_size));
+        m_samples = m_buffer;
+        m_half_complete_callback.Set([this](){
+            m_refill_callback(std::span<std::uint16_t>{m_buffer}.first(half_size));
+        });
+        m_complete_callback.Set([this](){
+            m_refill_callback(std::span<std::uint16_t>{m_buffer}.last(half_size));
+        });
+        m_underrun_callback.Set([this](){
+            Restart();
+        });
+        return StartDma();
+    }
+
+    /**
+     * @brief Stop streaming, the output keeps the last sample.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Stop() noexcept
+    {
+        m_underrun_callback.Clear();
+        m_half_complete_callback.Clear();
+        m_complete_callback.Clear();
+        return (HAL_OK == HAL_DAC_Stop_DMA(&m_handle, std::to_underlying(DacChannelV)));
+    }
+
+private:
+    DAC_HandleTypeDef& m_handle;
+    HalfCompleteCallbackT m_half_complete_callback;
+    CompleteCallbackT m_complete_callback;
+    UnderrunCallbackT m_underrun_callback;
+    EventCallbackT<std::span<std::uint16_t>> m_refill_callback{};
+    std::span<const std::uint16_t> m_samples{};
+    alignas(std::uint32_t) std::array<std::uint16_t, 2 * half_size> m_buffer{};
+
+    /**
+     * @brief Restart circular DMA after an underrun.
+     */
+    void Restart() noexcept
+    {
+        HAL_DAC_Stop_DMA(&m_handle, std::to_underlying(DacChannelV));
+        StartDma();
+    }
+
+    /**
+     * @brief Start circular DMA from the current samples.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool StartDma() noexcept
+    {
+        return (HAL_OK == HAL_DAC_Start_DMA(
+            &m_handle,
+            std::to_underlying(DacChannelV),
+            reinterpret_cast<std::uint32_t*>(const_cast<std::uint16_t*>(m_samples.data())),
+            static_cast<std::uint32_t>(m_samples.size()),
+            DacConfigT::AlignmentT::alignment
+        ));
+    }
+};
+
+} /* namespace STM32 */
+
+#endif /* STM32_DAC_STREAM_HPP */
@@ -0,0 +1,147 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_ENCODER_HPP
+#define STM32_ENCODER_HPP
+
+#include <cstdint>
+#include <utility>
+
+#include "__Internal/__Utility.hpp"
+
+#include "main.h"
+
+#if !defined(HAL_TIM_MODULE_ENABLED) /* module check */
+#error "HAL TIM module is not enabled!"
+#endif /* module check */
+
+namespace STM32 {
+
+/**
+ * @class Encoder, A class to read a quadrature encoder with the timer encoder mode.
+ *
+ * The timer counts encoder edges up or down in hardware, so edge rates far beyond
+ * software counting (e.g., 50 kHz and more) cost no CPU time. The hardware count
+ * is extended to a signed 64-bit position on each read.
+ *
+ * @note Encoder class is non-copyable and non-movable.
+ * @note Required timer configuration: combined channels in encoder mode (TI1, TI2 or both
+ *       for x2 or x4 counting), ARR typically at its maximum.
+ * @note GetPosition() must be called at least once per half counter range
+ *       ((ARR + 1) / 2 counts), e.g., from a periodic TimerScheduler event.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Encoder.hpp>
+ *
+ * TIM_HandleTypeDef htim4; // Encoder mode TI1 and TI2, ARR = 65535
+ *
+ * STM32::Encoder encoder{htim4};
+ *
+ * auto position = encoder.GetPosition();       // Counts since construction
+ * auto is_reversing = encoder.IsCountingDown();
+ * encoder.SetPosition(0);                      // Homing
+ * @endcode
+ */
+class Encoder {
+public:
+
+    /**
+     * @brief Construct Encoder class, starts counting from position 0.
+     *
+     * @param handle    Reference to the TIM handle.
+     */
+    explicit Encoder(TIM_HandleTypeDef& handle) noexcept
+      : m_handle{handle},
+        m_range{std::uint64_t{__HAL_TIM_GET_AUTORELOAD(&handle)} + 1},
+        m_last_count{__HAL_TIM_GET_COUNTER(&handle)}
+    {
+        HAL_TIM_Encoder_Start(&m_handle, TIM_CHANNEL_ALL);
+    }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    Encoder(const Encoder&) = delete;
+    Encoder& operator=(const Encoder&) = delete;
+    Encoder(Encoder&&) = delete;
+    Encoder& operator=(Encoder&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy Encoder class, stops counting.
+     */
+    ~Encoder()
+    {
+        HAL_TIM_Encoder_Stop(&m_handle, TIM_CHANNEL_ALL);
+    }
+
+    /**
+     * @returns TIM handle reference.
+     */
+    [[nodiscard]]
+    auto&& GetHandle(this auto&& self) noexcept
+    {
+        return std::forward<decltype(self)>(self).m_handle;
+    }
+
+    /**
+     * @brief Get the position, accumulating the counts since the previous call.
+     *
+     * @returns Position in encoder counts.
+     */
+    [[nodiscard]]
+    std::int64_t GetPosition() noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        const std::uint32_t count{__HAL_TIM_GET_COUNTER(&m_handle)};
+        auto delta = (std::uint64_t{count} + m_range - m_last_count) % m_range;
+        m_last_count = count;
+        m_position += (delta < m_range / 2) ?
+            static_cast<std::int64_t>(delta) :
+            -static_cast<std::int64_t>(m_range - delta);
+        return m_position;
+    }
+
+    /**
+     * @brief Set the position (e.g., at a homing switch), counting continues from it.
+     *
+     * @param position  New position in encoder counts.
+     */
+    void SetPosition(std::int64_t position) noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        m_last_count = __HAL_TIM_GET_COUNTER(&m_handle);
+        m_position = position;
+    }
+
+    /**
+     * @brief Reset the position to zero.
+     *
+     * Equivalent to SetPosition(0).
+     */
+    void Reset() noexcept
+    {
+        SetPosition(0);
+    }
+
+    /**
+     * @returns True if the encoder last moved in the counting down direction.
+     */
+    [[nodiscard]]
+    bool IsCountingDown() const noexcept
+    {
+        return __HAL_TIM_IS_TIM_COUNTING_DOWN(&m_handle);
+    }
+
+private:
+    TIM_HandleTypeDef& m_handle;
+    const std::uint64_t m_range;
+    std::uint32_t m_last_count;
+    std::int64_t m_position{};
+};
+
+} /* namespace STM32 */
+
+#endif /* STM32_ENCODER_HPP */
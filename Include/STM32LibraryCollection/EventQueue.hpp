@@ -0,0 +1,281 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_EVENT_QUEUE_HPP
+#define STM32_EVENT_QUEUE_HPP
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "__Internal/__Utility.hpp"
+
+#include "main.h"
+
+namespace STM32 {
+
+/**
+ * @enum EventPriority, Priority level of work posted to an EventQueue.
+ *
+ * Pending work of a higher level always runs first, work of the same level in posting order.
+ */
+enum class EventPriority : std::uint8_t {
+    High,
+    Normal,
+    Low
+};
+
+/**
+ * @struct EventQueueCapacity, A utility struct to hold the maximum number of pending work items.
+ *
+ * @tparam CapacityV    Maximum number of pending work items of all priorities (1 to 255).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/EventQueue.hpp>
+ *
+ * using SixteenItems = STM32::EventQueueCapacity<16>;
+ * @endcode
+ */
+template <std::size_t CapacityV>
+struct EventQueueCapacity : __Internal::__Constant<std::size_t, CapacityV> {};
+
+/**
+ * @brief IsEventQueueCapacity, A concept to check if a type is a valid EventQueueCapacity.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/EventQueue.hpp>
+ *
+ * static_assert(STM32::IsEventQueueCapacity<STM32::EventQueueCapacity<16>>);
+ * static_assert(!STM32::IsEventQueueCapacity<STM32::EventQueueCapacity<256>>);
+ * static_assert(!STM32::IsEventQueueCapacity<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsEventQueueCapacity =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t> &&
+    (T::value > 0) && (T::value <= 255);
+
+/**
+ * @brief IsEventQueue, A concept to check if a type is an EventQueue.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/EventQueue.hpp>
+ *
+ * static_assert(STM32::IsEventQueue<STM32::EventQueue<STM32::EventQueueCapacity<16>>>);
+ * static_assert(!STM32::IsEventQueue<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsEventQueue =
+    requires (T& queue, CallbackT&& work, EventPriority priority) {
+        { queue.Post(std::move(work), priority) } -> std::same_as<bool>;
+        { queue.RunUntilIdle() } -> std::same_as<std::size_t>;
+    };
+
+/**
+ * @class EventQueue, A fixed-capacity deferred-work queue for ISR-to-main-loop handoff.
+ *
+ * Interrupt handlers post CallbackT work items, and the main loop runs them with
+ * RunOne(), RunUntilIdle() or the Run() event loop. Heavy processing (e.g., CRC of
+ * a received frame, filtering ADC data) therefore does not extend interrupt time.
+ *
+ * Work items are stored in a pool of CapacityT slots shared by all priorities,
+ * each priority keeps a FIFO of slot indices. Posting and taking work are
+ * constant time under a short critical section, so any interrupt may post.
+ *
+ * Uart, Spi and I2c can post their completion callbacks to an EventQueue,
+ * see their SetCompletionQueue().
+ *
+ * @tparam CapacityT    Maximum number of pending work items (see EventQueueCapacity).
+ *
+ * @note EventQueue class is non-copyable and non-movable.
+ * @note Work runs in the context calling RunOne(), RunUntilIdle() or Run(), use
+ *       one context (e.g., the main loop) for all of them.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/EventQueue.hpp>
+ *
+ * STM32::EventQueue<STM32::EventQueueCapacity<16>> events{};
+ *
+ * stream.Start([&](std::span<const std::uint16_t> samples){
+ *     // Interrupt context: hand the half buffer over to the main loop
+ *     events.Post([&, samples](){ Filter(samples); }, STM32::EventPriority::High);
+ * });
+ *
+ * uart.SetCompletionQueue(events);     // Uart callbacks now run in the main loop
+ *
+ * events.Run();                        // Never returns, sleeps while idle
+ * @endcode
+ */
+template <IsEventQueueCapacity CapacityT>
+class EventQueue {
+    static constexpr std::size_t s_capacity{CapacityT::value};
+    static constexpr std::size_t s_priority_count{3};
+
+    /**
+     * @struct Fifo, Slot indices of pending work of one priority.
+     */
+    struct Fifo {
+        std::array<std::uint8_t, s_capacity> slots{};
+        std::uint8_t head{};
+        std::uint8_t count{};
+    };
+public:
+
+    /**
+     * @brief Construct EventQueue class.
+     */
+    EventQueue() noexcept
+    {
+        for (std::size_t slot = 0; slot < s_capacity; ++slot) {
+            m_free_slots[slot] = static_cast<std::uint8_t>(slot);
+        }
+    }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    EventQueue(const EventQueue&) = delete;
+    EventQueue& operator=(const EventQueue&) = delete;
+    EventQueue(EventQueue&&) = delete;
+    EventQueue& operator=(EventQueue&&) = delete;
+    /** @} */
+
+    /**
+     * @returns Maximum number of pending work items.
+     */
+    [[nodiscard]]
+    static constexpr std::size_t Capacity() noexcept
+    {
+        return s_capacity;
+    }
+
+    /**
+     * @returns Number of pending work items.
+     */
+    [[nodiscard]]
+    std::size_t Size() const noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        return s_capacity - m_free_count;
+    }
+
+    /**
+     * @returns True if no work is pending.
+     */
+    [[nodiscard]]
+    bool IsIdle() const noexcept
+    {
+        return Size() == 0;
+    }
+
+    /**
+     * @brief Post a work item.
+     *
+     * @param work      Callback function to be run from the queue.
+     * @param priority  Priority of the work (default is EventPriority::Normal).
+     *
+     * @returns False if work is empty or the queue is full, work is dropped then.
+     *
+     * @note May be called from interrupt context and from work items.
+     */
+    bool Post(CallbackT&& work, EventPriority priority = EventPriority::Normal) noexcept
+    {
+        if (!work) {
+            return false;
+        }
+        __Internal::__CriticalSection critical_section{};
+        if (m_free_count == 0) {
+            return false;
+        }
+        const auto slot = m_free_slots[--m_free_count];
+        m_work[slot] = std::move(work);
+        auto& fifo = m_fifos[static_cast<std::size_t>(priority)];
+        fifo.slots[(fifo.head + fifo.count) % s_capacity] = slot;
+        ++fifo.count;
+        return true;
+    }
+
+    /**
+     * @brief Run the oldest pending work item of the highest priority.
+     *
+     * @returns True if a work item was run, false if the queue was idle.
+     */
+    bool RunOne() noexcept
+    {
+        CallbackT work{};
+        {
+            __Internal::__CriticalSection critical_section{};
+            for (auto& fifo : m_fifos) {
+                if (fifo.count == 0) {
+                    continue;
+                }
+                const auto slot = fifo.slots[fifo.head];
+                fifo.head = static_cast<std::uint8_t>((fifo.head + 1) % s_capacity);
+                --fifo.count;
+                work = std::move(m_work[slot]);
+                m_free_slots[m_free_count++] = slot;
+                break;
+            }
+        }
+        if (!work) {
+            return false;
+        }
+        work();
+        return true;
+    }
+
+    /**
+     * @brief Run work items until the queue is idle, including work posted meanwhile.
+     *
+     * @returns Number of work items run.
+     */
+    std::size_t RunUntilIdle() noexcept
+    {
+        std::size_t count{};
+        while (RunOne()) {
+            ++count;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Event loop, runs work items forever and sleeps with WFI while idle.
+     *
+     * @note Idleness is checked with interrupts masked, so work posted right
+     *       before sleeping is not missed (a pending interrupt ends WFI).
+     */
+    [[noreturn]]
+    void Run() noexcept
+    {
+        while (true) {
+            RunUntilIdle();
+            __Internal::__CriticalSection critical_section{};
+            if (m_free_count == s_capacity) {
+                __WFI();
+            }
+        }
+    }
+
+private:
+    std::array<CallbackT, s_capacity> m_work{};
+    std::array<Fifo, s_priority_count> m_fifos{};
+    std::array<std::uint8_t, s_capacity> m_free_slots{};
+    std::size_t m_free_count{s_capacity};
+};
+
+} /* namespace STM32 */
+
+#endif /* STM32_EVENT_QUEUE_HPP */
@@ -0,0 +1,798 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_FRAMING_HPP
+#define STM32_FRAMING_HPP
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <ranges>
+#include <span>
+#include <utility>
+
+#include "Crc16.hpp"
+#include "Uart.hpp"
+#include "__Internal/__Utility.hpp"
+
+namespace STM32 {
+
+/**
+ * @namespace FrameEncoding, Tag types for the byte stuffing of a frame.
+ *
+ * Both encodings delimit frames with a reserved byte, so a receiver resynchronizes
+ * at the next frame after any corruption.
+ */
+namespace FrameEncoding {
+
+/**
+ * @struct Cobs, Tag for Consistent Overhead Byte Stuffing.
+ *
+ * Frames end with 0x00 and contain no other 0x00 byte.
+ * Overhead is one byte per 254 bytes, independent of the data.
+ */
+struct Cobs {
+    static constexpr char delimiter{'\x00'};
+};
+
+/**
+ * @struct Slip, Tag for Serial Line Internet Protocol framing (RFC 1055).
+ *
+ * Frames start and end with 0xC0, 0xC0 and 0xDB bytes are escaped.
+ * Overhead depends on the data, up to twice the frame size.
+ */
+struct Slip {
+    static constexpr char delimiter{'\xC0'};
+    static constexpr char escape{'\xDB'};
+    static constexpr char escaped_delimiter{'\xDC'};
+    static constexpr char escaped_escape{'\xDD'};
+};
+
+} /* namespace FrameEncoding */
+
+/**
+ * @brief IsFrameEncoding, A concept to check if a type is a FrameEncoding.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Framing.hpp>
+ *
+ * static_assert(STM32::IsFrameEncoding<STM32::FrameEncoding::Cobs>);
+ * static_assert(!STM32::IsFrameEncoding<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsFrameEncoding =
+    std::same_as<T, FrameEncoding::Cobs> ||
+    std::same_as<T, FrameEncoding::Slip>;
+
+/**
+ * @struct FrameLength, A utility struct to configure the maximum payload length of a frame.
+ *
+ * @tparam LengthV  Maximum number of payload bytes, excluding the CRC (1 to 65533).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * using TelemetryLength = STM32::FrameLength<128>;
+ * @endcode
+ */
+template <std::size_t LengthV>
+struct FrameLength : __Internal::__Constant<std::size_t, LengthV> {};
+
+/**
+ * @brief IsFrameLength, A concept to check if a type is a valid FrameLength.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Framing.hpp>
+ *
+ * static_assert(STM32::IsFrameLength<STM32::FrameLength<128>>);
+ * static_assert(!STM32::IsFrameLength<STM32::FrameLength<0>>);
+ * static_assert(!STM32::IsFrameLength<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsFrameLength =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t> &&
+    (1 <= T::value && T::value <= 65'533);
+
+/**
+ * @struct FrameBufferLength, A utility struct to configure the receive ring buffer length of a FrameReceiver.
+ *
+ * @tparam LengthV  Number of bytes in the circular DMA buffer (2 to 65535).
+ *
+ * @note Should hold at least two maximum size encoded frames, so that a frame
+ *       being decoded is not overwritten by DMA.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * using RxRing = STM32::FrameBufferLength<512>;
+ * @endcode
+ */
+template <std::size_t LengthV>
+struct FrameBufferLength : __Internal::__Constant<std::size_t, LengthV> {};
+
+/**
+ * @brief IsFrameBufferLength, A concept to check if a type is a valid FrameBufferLength.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Framing.hpp>
+ *
+ * static_assert(STM32::IsFrameBufferLength<STM32::FrameBufferLength<512>>);
+ * static_assert(!STM32::IsFrameBufferLength<STM32::FrameBufferLength<1>>);
+ * static_assert(!STM32::IsFrameBufferLength<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsFrameBufferLength =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t> &&
+    (2 <= T::value && T::value <= 65'535);
+
+/**
+ * @brief IsFramePayload, A concept to check if a type is a valid frame payload buffer.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Framing.hpp>
+ *
+ * static_assert(STM32::IsFramePayload<std::array<char, 16>>);
+ * static_assert(!STM32::IsFramePayload<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsFramePayload = __Internal::__IsMessage<T, char>;
+
+/**
+ * @struct FrameStatistics, Counters of a FrameDecoder.
+ */
+struct FrameStatistics {
+    std::uint32_t frame_count;          /**< Frames delivered with a valid CRC. */
+    std::uint32_t crc_error_count;      /**< Frames dropped for a CRC mismatch. */
+    std::uint32_t format_error_count;   /**< Frames dropped for invalid stuffing or a missing CRC. */
+    std::uint32_t overflow_count;       /**< Frames dropped for exceeding FrameLength. */
+};
+
+namespace __Internal {
+
+/** @brief Number of CRC bytes appended to each frame payload. */
+inline constexpr std::size_t __frame_crc_size{2};
+
+/**
+ * @brief Bytes of a finalized CRC in transmission order.
+ *
+ * Reflected CRCs (e.g., Modbus, X.25) are sent low byte first, others high byte
+ * first, so the CRC over the payload and the appended CRC has a constant residue.
+ *
+ * @tparam Crc16T   CRC-16 configuration.
+ *
+ * @param crc       Finalized CRC value.
+ *
+ * @returns The two CRC bytes.
+ */
+template <IsCrc16 Crc16T>
+[[nodiscard]]
+constexpr std::array<char, __frame_crc_size> __FrameCrcBytes(std::uint16_t crc) noexcept
+{
+    const auto low = static_cast<char>(crc & 0xFFU);
+    const auto high = static_cast<char>(crc >> 8);
+    if constexpr (Crc16T::reflect_output) {
+        return {low, high};
+    } else {
+        return {high, low};
+    }
+}
+
+/**
+ * @brief Update a CRC with characters.
+ *
+ * @tparam Crc16T   CRC-16 configuration.
+ *
+ * @param crc       Current (not finalized) CRC value.
+ * @param data      Pointer to the characters.
+ * @param length    Number of characters.
+ *
+ * @returns The updated CRC value.
+ */
+template <IsCrc16 Crc16T>
+[[nodiscard]]
+std::uint16_t __FrameCrcUpdate(std::uint16_t crc, const char* data, std::size_t length) noexcept
+{
+    return Crc16T::Update(crc, std::span<const std::uint8_t>{
+        reinterpret_cast<const std::uint8_t*>(data), length
+    });
+}
+
+/**
+ * @class __FrameWriter, Byte stuffing into an output buffer, one specialization per FrameEncoding.
+ *
+ * @note This is an internal class. Do not use directly in application code.
+ */
+template <IsFrameEncoding EncodingT>
+class __FrameWriter;
+
+/**
+ * @brief COBS writer: each block starts with a code byte, the distance to the next 0x00 (or 0xFF for 254 data bytes).
+ */
+template <>
+class __FrameWriter<FrameEncoding::Cobs> {
+public:
+    explicit __FrameWriter(char* output) noexcept
+      : m_output{output}
+    { }
+
+    void Put(std::span<const char> data) noexcept
+    {
+        for (const char byte : data) {
+            if (byte == FrameEncoding::Cobs::delimiter) {
+                CloseBlock();
+                continue;
+            }
+            m_output[m_size++] = byte;
+            if (++m_code == 0xFF) {
+                CloseBlock();
+            }
+        }
+    }
+
+    [[nodiscard]]
+    std::size_t Finish() noexcept
+    {
+        m_output[m_code_index] = static_cast<char>(m_code);
+        m_output[m_size++] = FrameEncoding::Cobs::delimiter;
+        return m_size;
+    }
+
+private:
+    char* m_output;
+    std::size_t m_code_index{};
+    std::size_t m_size{1};
+    std::uint8_t m_code{1};
+
+    void CloseBlock() noexcept
+    {
+        m_output[m_code_index] = static_cast<char>(m_code);
+        m_code_index = m_size++;
+        m_code = 1;
+    }
+};
+
+/**
+ * @brief SLIP writer: delimiter and escape bytes are replaced by two-byte escape sequences.
+ */
+template <>
+class __FrameWriter<FrameEncoding::Slip> {
+public:
+    explicit __FrameWriter(char* output) noexcept
+      : m_output{output}
+    {
+        m_output[m_size++] = FrameEncoding::Slip::delimiter;
+    }
+
+    void Put(std::span<const char> data) noexcept
+    {
+        for (const char byte : data) {
+            if (byte == FrameEncoding::Slip::delimiter) {
+                m_output[m_size++] = FrameEncoding::Slip::escape;
+                m_output[m_size++] = FrameEncoding::Slip::escaped_delimiter;
+            } else if (byte == FrameEncoding::Slip::escape) {
+                m_output[m_size++] = FrameEncoding::Slip::escape;
+                m_output[m_size++] = FrameEncoding::Slip::escaped_escape;
+            } else {
+                m_output[m_size++] = byte;
+            }
+        }
+    }
+
+    [[nodiscard]]
+    std::size_t Finish() noexcept
+    {
+        m_output[m_size++] = FrameEncoding::Slip::delimiter;
+        return m_size;
+    }
+
+private:
+    char* m_output;
+    std::size_t m_size{};
+};
+
+} /* namespace __Internal */
+
+/**
+ * @class FrameEncoder, A class to build byte-stuffed frames with a CRC-16 trailer.
+ *
+ * Gathers any number of payload parts (e.g., a header and a body) into one frame
+ * in a single pass: the CRC is updated per part and the parts are stuffed directly
+ * into the caller's transmit buffer, which can be queued as is (e.g., with
+ * UartTransmitQueue) without further copies.
+ *
+ * Frame format: stuffed(payload, CRC-16 of payload). The CRC is appended low byte
+ * first for reflected CRCs (e.g., Crc16Modbus), high byte first otherwise.
+ *
+ * @tparam EncodingT    Byte stuffing (see FrameEncoding).
+ * @tparam Crc16T       CRC-16 configuration (e.g., Crc16CcittFalse).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Framing.hpp>
+ *
+ * using Encoder = STM32::FrameEncoder<STM32::FrameEncoding::Cobs, STM32::Crc16CcittFalse>;
+ *
+ * std::array<char, Encoder::MaxEncodedSize(64)> tx_frame{};
+ * auto frame = Encoder::Encode(tx_frame, header, samples);    // header and samples gathered
+ * tx_queue.Transmit(frame);                                   // tx_frame transmitted in place
+ * @endcode
+ */
+template <IsFrameEncoding EncodingT, IsCrc16 Crc16T>
+class FrameEncoder {
+public:
+
+    /**
+     * @brief Get the worst-case encoded frame size, including the CRC and the delimiters.
+     *
+     * @param payload_size  Number of payload bytes.
+     *
+     * @returns Required output buffer size.
+     */
+    [[nodiscard]]
+    static constexpr std::size_t MaxEncodedSize(std::size_t payload_size) noexcept
+    {
+        const std::size_t size{payload_size + __Internal::__frame_crc_size};
+        if constexpr (std::same_as<EncodingT, FrameEncoding::Cobs>) {
+            return size + size / 254 + 2;
+        } else {
+            return 2 * size + 2;
+        }
+    }
+
+    /**
+     * @brief Encode the concatenation of the payload parts as one frame.
+     *
+     * @param output    Output buffer, at least MaxEncodedSize(total payload size) bytes.
+     * @param parts     Payload parts, concatenated in order.
+     *
+     * @returns The encoded frame within output, empty if output is too small.
+     */
+    [[nodiscard]]
+    static std::span<const char> Encode(std::span<char> output, const IsFramePayload auto&... parts) noexcept
+    {
+        const std::size_t payload_size{(std::size_t{} + ... + std::ranges::size(parts))};
+        if (output.size() < MaxEncodedSize(payload_size)) {
+            return {};
+        }
+        std::uint16_t crc{Crc16T::Init()};
+        __Internal::__FrameWriter<EncodingT> writer{output.data()};
+        ([&](const auto& part){
+            const std::span<const char> data{std::ranges::data(part), std::ranges::size(part)};
+            crc = __Internal::__FrameCrcUpdate<Crc16T>(crc, data.data(), data.size());
+            writer.Put(data);
+        }(parts), ...);
+        writer.Put(__Internal::__FrameCrcBytes<Crc16T>(Crc16T::Finalize(crc)));
+        return output.first(writer.Finish());
+    }
+};
+
+/**
+ * @class FrameDecoder, A class to decode byte-stuffed frames incrementally and in place.
+ *
+ * Chunks are decoded as they arrive: the decoded bytes are written back over the
+ * consumed encoded bytes (decoding never grows the data), and the CRC is updated
+ * over each run of decoded bytes. When a frame ends with a valid CRC, the callback
+ * receives a span over its payload in the chunk buffer itself. Only a frame that
+ * continues in a non-adjacent chunk (e.g., across a ring buffer wraparound) is
+ * moved into an internal FrameLength buffer.
+ *
+ * @tparam EncodingT        Byte stuffing (see FrameEncoding).
+ * @tparam Crc16T           CRC-16 configuration (e.g., Crc16CcittFalse).
+ * @tparam FrameLengthT     Maximum payload length (see FrameLength).
+ *
+ * @note FrameDecoder class is non-copyable and non-movable.
+ * @note Decode() modifies the chunks, the bytes of a frame in progress must stay
+ *       valid until the frame ends.
+ * @note Corrupted, truncated or oversized frames are dropped and counted, decoding
+ *       resynchronizes at the next delimiter.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Framing.hpp>
+ *
+ * STM32::FrameDecoder<STM32::FrameEncoding::Slip, STM32::Crc16Modbus, STM32::FrameLength<64>> decoder{};
+ *
+ * decoder.Decode(chunk, [](std::span<const char> payload){
+ *     // Valid payload, CRC removed, only valid during the callback
+ * });
+ *
+ * auto statistics = decoder.GetStatistics();
+ * @endcode
+ */
+template <IsFrameEncoding EncodingT, IsCrc16 Crc16T, IsFrameLength FrameLengthT>
+class FrameDecoder {
+    static constexpr bool s_is_cobs{std::same_as<EncodingT, FrameEncoding::Cobs>};
+    static constexpr std::size_t s_capacity{FrameLengthT::value + __Internal::__frame_crc_size};
+public:
+
+    /** @brief Maximum payload length of a delivered frame. */
+    static constexpr std::size_t max_payload_size{FrameLengthT::value};
+
+    /**
+     * @brief Construct FrameDecoder class.
+     */
+    FrameDecoder() noexcept = default;
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    FrameDecoder(const FrameDecoder&) = delete;
+    FrameDecoder& operator=(const FrameDecoder&) = delete;
+    FrameDecoder(FrameDecoder&&) = delete;
+    FrameDecoder& operator=(FrameDecoder&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Decode a chunk of encoded bytes.
+     *
+     * @param chunk             Encoded bytes, decoded in place.
+     * @param frame_callback    Callback function to be called with each valid payload.
+     */
+    void Decode(std::span<char> chunk, std::invocable<std::span<const char>> auto&& frame_callback) noexcept
+    {
+        char* position = chunk.data();
+        char* const end = position + chunk.size();
+        if (m_is_in_frame && m_frame != m_linear.data() && position != m_next) {
+            std::memcpy(m_linear.data(), m_frame, m_size);
+            m_frame = m_linear.data();
+        }
+        m_next = end;
+        while (position != end) {
+            if constexpr (s_is_cobs) {
+                position = DecodeCobs(position, end, frame_callback);
+            } else {
+                position = DecodeSlip(position, end, frame_callback);
+            }
+        }
+    }
+
+    /**
+     * @brief Drop the frame in progress and clear the statistics.
+     */
+    void Reset() noexcept
+    {
+        ResetFrame();
+        m_is_discarding = false;
+        m_next = nullptr;
+        m_statistics = {};
+    }
+
+    /**
+     * @returns Decoding counters since construction or the last Reset().
+     */
+    [[nodiscard]]
+    FrameStatistics GetStatistics() const noexcept
+    {
+        return m_statistics;
+    }
+
+private:
+    FrameStatistics m_statistics{};
+    char* m_frame{};
+    const char* m_next{};
+    std::size_t m_size{};
+    std::size_t m_crc_size{};
+    std::uint16_t m_crc{Crc16T::Init()};
+    std::uint8_t m_remaining{};
+    bool m_is_in_frame{};
+    bool m_is_discarding{};
+    bool m_is_zero_pending{};
+    bool m_is_escaped{};
+    std::array<char, s_capacity> m_linear{};
+
+    /**
+     * @brief Start a frame, decoded in place from its first encoded byte.
+     */
+    void BeginFrame(char* position) noexcept
+    {
+        m_is_in_frame = true;
+        m_frame = position;
+        m_size = 0;
+        m_crc_size = 0;
+        m_crc = Crc16T::Init();
+    }
+
+    /**
+     * @brief Forget the frame in progress.
+     */
+    void ResetFrame() noexcept
+    {
+        m_is_in_frame = false;
+        m_size = 0;
+        m_remaining = 0;
+        m_is_zero_pending = false;
+        m_is_escaped = false;
+    }
+
+    /**
+     * @brief Drop the frame in progress and skip to the next delimiter.
+     *
+     * @param counter   Statistics counter to increment.
+     */
+    void Discard(std::uint32_t FrameStatistics::* counter) noexcept
+    {
+        ++(m_statistics.*counter);
+        ResetFrame();
+        m_is_discarding = true;
+    }
+
+    /**
+     * @brief Append decoded bytes to the frame, the CRC trails the frame end by the CRC size.
+     *
+     * @returns True on success, false if the frame overflowed and is discarded.
+     */
+    bool Write(const char* data, std::size_t length) noexcept
+    {
+        if (m_size + length > s_capacity) {
+            Discard(&FrameStatistics::overflow_count);
+            return false;
+        }
+        std::memmove(m_frame + m_size, data, length);
+        m_size += length;
+        if (m_size > m_crc_size + __Internal::__frame_crc_size) {
+            const std::size_t crc_end{m_size - __Internal::__frame_crc_size};
+            m_crc = __Internal::__FrameCrcUpdate<Crc16T>(m_crc, m_frame + m_crc_size, crc_end - m_crc_size);
+            m_crc_size = crc_end;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Complete the frame at a delimiter, deliver it if its CRC is valid.
+     */
+    void EndFrame(auto& frame_callback) noexcept
+    {
+        if (m_size < __Internal::__frame_crc_size || m_remaining != 0 || m_is_escaped) {
+            ++m_statistics.format_error_count;
+        } else {
+            const std::size_t payload_size{m_size - __Internal::__frame_crc_size};
+            const auto expected = __Internal::__FrameCrcBytes<Crc16T>(Crc16T::Finalize(m_crc));
+            if (std::equal(expected.begin(), expected.end(), m_frame + payload_size)) {
+                ++m_statistics.frame_count;
+                std::invoke(frame_callback, std::span<const char>{m_frame, payload_size});
+            } else {
+                ++m_statistics.crc_error_count;
+            }
+        }
+        ResetFrame();
+    }
+
+    /**
+     * @brief Decode COBS bytes from position, at most one code byte or one block run.
+     *
+     * @returns Position of the next undecoded byte.
+     */
+    char* DecodeCobs(char* position, char* end, auto& frame_callback) noexcept
+    {
+        if (m_is_discarding) {
+            position = std::find(position, end, FrameEncoding::Cobs::delimiter);
+            if (position == end) {
+                return end;
+            }
+            m_is_discarding = false;
+            return position + 1;
+        }
+        if (m_remaining == 0) {
+            const auto code = static_cast<std::uint8_t>(*position);
+            if (code == 0) {
+                if (m_is_in_frame) {
+                    EndFrame(frame_callback);
+                }
+                return position + 1;
+            }
+            if (!m_is_in_frame) {
+                BeginFrame(position);
+            }
+            if (m_is_zero_pending && !Write(&FrameEncoding::Cobs::delimiter, 1)) {
+                return position + 1;
+            }
+            m_remaining = static_cast<std::uint8_t>(code - 1);
+            m_is_zero_pending = (code != 0xFF);
+            return position + 1;
+        }
+        char* const run_end = position + std::min<std::size_t>(m_remaining, end - position);
+        char* const delimiter = std::find(position, run_end, FrameEncoding::Cobs::delimiter);
+        if (!Write(position, delimiter - position)) {
+            return delimiter;
+        }
+        m_remaining = static_cast<std::uint8_t>(m_remaining - (delimiter - position));
+        if (delimiter != run_end) {
+            EndFrame(frame_callback);
+            return delimiter + 1;
+        }
+        return delimiter;
+    }
+
+    /**
+     * @brief Decode SLIP bytes from position, at most one escape sequence or one literal run.
+     *
+     * @returns Position of the next undecoded byte.
+     */
+    char* DecodeSlip(char* position, char* end, auto& frame_callback) noexcept
+    {
+        if (m_is_discarding) {
+            position = std::find(position, end, FrameEncoding::Slip::delimiter);
+            if (position == end) {
+                return end;
+            }
+            m_is_discarding = false;
+            return position + 1;
+        }
+        const char byte{*position};
+        if (byte == FrameEncoding::Slip::delimiter) {
+            if (m_is_in_frame) {
+                EndFrame(frame_callback);
+            }
+            return position + 1;
+        }
+        if (m_is_escaped) {
+            m_is_escaped = false;
+            if (byte == FrameEncoding::Slip::escaped_delimiter) {
+                Write(&FrameEncoding::Slip::delimiter, 1);
+            } else if (byte == FrameEncoding::Slip::escaped_escape) {
+                Write(&FrameEncoding::Slip::escape, 1);
+            } else {
+                Discard(&FrameStatistics::format_error_count);
+            }
+            return position + 1;
+        }
+        if (!m_is_in_frame) {
+            BeginFrame(position);
+        }
+        if (byte == FrameEncoding::Slip::escape) {
+            m_is_escaped = true;
+            return position + 1;
+        }
+        char* const run_end = std::find_if(position, end, [](char value){
+            return value == FrameEncoding::Slip::delimiter || value == FrameEncoding::Slip::escape;
+        });
+        Write(position, run_end - position);
+        return run_end;
+    }
+};
+
+/**
+ * @class FrameReceiver, A class to receive byte-stuffed frames from a Uart with zero-copy delivery.
+ *
+ * Owns the ring buffer of a circular DMA reception (see Uart::CircularReceiveTo())
+ * and decodes every received chunk in place with a FrameDecoder from the receive
+ * event interrupt. Valid payloads are delivered as spans into the ring buffer.
+ *
+ * @tparam UartT                Uart type to receive from.
+ * @tparam EncodingT            Byte stuffing (see FrameEncoding).
+ * @tparam Crc16T               CRC-16 configuration (e.g., Crc16CcittFalse).
+ * @tparam FrameLengthT         Maximum payload length (see FrameLength).
+ * @tparam FrameBufferLengthT   Receive ring buffer length (see FrameBufferLength).
+ *
+ * @note FrameReceiver class is non-copyable and non-movable.
+ * @note The UART RX DMA stream must be configured in circular mode (DMA_CIRCULAR).
+ * @note The frame callback runs in interrupt context, the payload span is only
+ *       valid during the callback.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Framing.hpp>
+ *
+ * STM32::Uart<STM32::WorkingMode::DMA, STM32_UNIQUE_TAG> uart{huart2};
+ *
+ * STM32::FrameReceiver<
+ *     decltype(uart),
+ *     STM32::FrameEncoding::Cobs,
+ *     STM32::Crc16CcittFalse,
+ *     STM32::FrameLength<128>,
+ *     STM32::FrameBufferLength<512>
+ * > receiver{uart};
+ *
+ * receiver.Start([](std::span<const char> payload){
+ *     // Valid payload in the ring buffer
+ * });
+ *
+ * auto crc_errors = receiver.GetStatistics().crc_error_count;
+ * @endcode
+ */
+template <
+    IsUart UartT,
+    IsFrameEncoding EncodingT,
+    IsCrc16 Crc16T,
+    IsFrameLength FrameLengthT,
+    IsFrameBufferLength FrameBufferLengthT
+>
+class FrameReceiver {
+public:
+
+    /**
+     * @brief Construct FrameReceiver class.
+     *
+     * @param uart      Reference to the Uart to receive from.
+     */
+    explicit FrameReceiver(UartT& uart) noexcept
+      : m_uart{uart}
+    { }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    FrameReceiver(const FrameReceiver&) = delete;
+    FrameReceiver& operator=(const FrameReceiver&) = delete;
+    FrameReceiver(FrameReceiver&&) = delete;
+    FrameReceiver& operator=(FrameReceiver&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy FrameReceiver class, stops receiving.
+     */
+    ~FrameReceiver()
+    {
+        Stop();
+    }
+
+    /**
+     * @brief Start continuous reception, the decoder state and statistics are reset.
+     *
+     * @param frame_callback    Callback function to be called with each valid payload.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Start(EventCallbackT<std::span<const char>>&& frame_callback) noexcept
+    {
+        m_decoder.Reset();
+        m_frame_callback = std::move(frame_callback);
+        return m_uart.template CircularReceiveTo<WorkingMode::DMA>(m_buffer, [this](std::span<const char> chunk){
+            m_decoder.Decode(
+                std::span<char>{m_buffer.data() + (chunk.data() - m_buffer.data()), chunk.size()},
+                m_frame_callback
+            );
+        });
+    }
+
+    /**
+     * @brief Stop reception.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Stop() noexcept
+    {
+        return m_uart.AbortCircularReceive();
+    }
+
+    /**
+     * @returns Decoding counters since the last Start().
+     */
+    [[nodiscard]]
+    FrameStatistics GetStatistics() const noexcept
+    {
+        return m_decoder.GetStatistics();
+    }
+
+private:
+    UartT& m_uart;
+    EventCallbackT<std::span<const char>> m_frame_callback{};
+    FrameDecoder<EncodingT, Crc16T, FrameLengthT> m_decoder{};
+    std::array<char, FrameBufferLengthT::value> m_buffer{};
+};
+
+} /* namespace STM32 */
+
+#endif /* STM32_FRAMING_HPP */
@@ -4,6 +4,7 @@
 #ifndef STM32_GPIO_HPP
 #define STM32_GPIO_HPP
 
+#include <bit>
 #include <concepts>
 #include <cstdint>
 #include <utility>
@@ -74,6 +75,7 @@ concept IsGpioType =
  *
  * @note Gpio class is non-copyable and non-movable.
  * @note Use the type aliases GpioInput and GpioOutput for convenience.
+ * @note For pins known at compile time and timing-critical toggling, see StaticGpio.
  *
  * @example Usage:
  * @code{.cpp}
@@ -267,6 +269,333 @@ using GpioInput = Gpio<GpioType::Input>;
  */ 
 using GpioOutput = Gpio<GpioType::Output>;
 
+/**
+ * @class StaticGpio, GPIO pin abstraction bound to its port and pin at compile time.
+ * 
+ * Same interface as Gpio, but port and pin are template parameters, so every
+ * operation lowers to a single register access without HAL calls:
+ * - Write()/High()/Low() are one store to BSRR (atomic, no read-modify-write).
+ * - Read()/IsHigh()/IsLow() are one load from IDR.
+ * - Toggle() is one load from ODR and one store to BSRR.
+ * 
+ * @tparam GpioTypeT            Type of the GPIO pin (GpioType::Input or GpioType::Output).
+ * @tparam PortAddressV         Base address of the GPIO port (e.g., GPIOA_BASE).
+ * @tparam PinV                 GPIO pin mask (e.g., GPIO_PIN_5), exactly one pin.
+ *
+ * @note StaticGpio class is non-copyable and non-movable.
+ * @note All operations are also available as static member functions.
+ * @note Use the type aliases StaticGpioInput and StaticGpioOutput for convenience.
+ *
+ * @example Usage:
+ * @code{.cpp}
+ * #include <STM32LibraryCollection/Gpio.hpp>
+ *
+ * using StepPin = STM32::StaticGpioOutput<GPIOA_BASE, GPIO_PIN_8>;
+ *
+ * StepPin step{};
+ * step.High();                                 // Single BSRR store
+ * step.Low();
+ * StepPin::Toggle();                           // Static call, no object needed
+ *
+ * STM32::StaticGpioInput<GPIOC_BASE, GPIO_PIN_13> button{};
+ * if (button.IsLow()) {
+ *      // pressed
+ * }
+ * @endcode
+ */
+template <IsGpioType GpioTypeT, std::uintptr_t PortAddressV, std::uint16_t PinV>
+class StaticGpio {
+    static_assert(
+        std::has_single_bit(PinV),
+        "Pin must be a single GPIO pin mask (GPIO_PIN_0 ... GPIO_PIN_15)"
+    );
+public:
+
+    /**
+     * @brief Construct a new StaticGpio object.
+     */
+    StaticGpio() noexcept = default;
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    StaticGpio(const StaticGpio &) = delete;
+    StaticGpio &operator=(const StaticGpio &) = delete;
+    StaticGpio(StaticGpio &&) = delete;
+    StaticGpio &operator=(StaticGpio &&) = delete;
+    /** @} */
+
+    /**
+     * @returns HAL GPIO handle.
+     */
+    [[nodiscard]]
+    static GPIO_TypeDef* GetHandle() noexcept
+    {
+        return reinterpret_cast<GPIO_TypeDef*>(PortAddressV);
+    }
+
+    /**
+     * @returns GPIO pin number.
+     */
+    [[nodiscard]]
+    static constexpr std::uint16_t GetPin() noexcept
+    {
+        return PinV;
+    }
+
+    /**
+     * @returns State of the GPIO pin.
+     */
+    [[nodiscard]]
+    static GpioPinState Read() noexcept
+    requires std::same_as<GpioTypeT, GpioType::Input>
+    {
+        return (GetHandle()->IDR & PinV) ? GpioPinState::High : GpioPinState::Low;
+    }
+
+    /**
+     * @brief Implicit conversion operator to GpioPinState.
+     * 
+     * @returns State of the GPIO pin.
+     */
+    operator GpioPinState() const noexcept
+    requires std::same_as<GpioTypeT, GpioType::Input>
+    {
+        return Read();
+    }
+
+    /**
+     * @brief Toggle the GPIO pin state.
+     */
+    static void Toggle() noexcept
+    requires std::same_as<GpioTypeT, GpioType::Output>
+    {
+        const std::uint32_t output = GetHandle()->ODR;
+        GetHandle()->BSRR = ((output & PinV) << 16U) | (~output & PinV);
+    }
+
+    /**
+     * @brief Write the GPIO pin state.
+     * 
+     * @param pin_state     State to write to the GPIO pin.
+     */
+    static void Write(GpioPinState pin_state) noexcept
+    requires std::same_as<GpioTypeT, GpioType::Output>
+    {
+        GetHandle()->BSRR = (pin_state == GpioPinState::High) ?
+            std::uint32_t{PinV} : (std::uint32_t{PinV} << 16U);
+    }
+
+    /**
+     * @brief Assignment operator to write the GPIO pin state.
+     * 
+     * @param state     State to write to the GPIO pin.
+     * 
+     * @returns Reference to the current StaticGpio object.
+     */
+    StaticGpio& operator=(GpioPinState state) noexcept
+    requires std::same_as<GpioTypeT, GpioType::Output>
+    {
+        Write(state);
+        return *this;
+    }
+
+    /**
+     * @brief Set the GPIO pin to High state.
+     */
+    static void High() noexcept
+    requires std::same_as<GpioTypeT, GpioType::Output>
+    {
+        GetHandle()->BSRR = PinV;
+    }
+
+    /**
+     * @brief Set the GPIO pin to Low state.
+     */
+    static void Low() noexcept
+    requires std::same_as<GpioTypeT, GpioType::Output>
+    {
+        GetHandle()->BSRR = std::uint32_t{PinV} << 16U;
+    }
+
+    /**
+     * @returns True if the GPIO pin is in High state.
+     */
+    [[nodiscard]]
+    static bool IsHigh() noexcept
+    requires std::same_as<GpioTypeT, GpioType::Input>
+    {
+        return (GetHandle()->IDR & PinV) != 0U;
+    }
+
+    /**
+     * @returns True if the GPIO pin is in Low state.
+     */
+    [[nodiscard]]
+    static bool IsLow() noexcept
+    requires std::same_as<GpioTypeT, GpioType::Input>
+    {
+        return (GetHandle()->IDR & PinV) == 0U;
+    }
+};
+
+/**
+ * @typedef StaticGpioInput, Convenience alias for compile-time bound GPIO pin in input mode.
+ * 
+ * @example Usage:
+ * @code{.cpp}
+ * STM32::StaticGpioInput<GPIOC_BASE, GPIO_PIN_13> button{};
+ * @endcode
+ */
+template <std::uintptr_t PortAddressV, std::uint16_t PinV>
+using StaticGpioInput = StaticGpio<GpioType::Input, PortAddressV, PinV>;
+
+/**
+ * @typedef StaticGpioOutput, Convenience alias for compile-time bound GPIO pin in output mode.
+ * 
+ * @example Usage:
+ * @code{.cpp}
+ * STM32::StaticGpioOutput<GPIOA_BASE, GPIO_PIN_5> led{};
+ * @endcode
+ */
+template <std::uintptr_t PortAddressV, std::uint16_t PinV>
+using StaticGpioOutput = StaticGpio<GpioType::Output, PortAddressV, PinV>;
+
+/**
+ * @class GpioPort, A group of pins on one GPIO port, updated with a single BSRR write.
+ * 
+ * All pins selected by the mask change in the same bus cycle, which makes the
+ * class suitable for parallel buses and multi-channel pulse generation. Pins of
+ * the port outside the mask are never modified.
+ * 
+ * @tparam PortAddressV         Base address of the GPIO port (e.g., GPIOB_BASE).
+ * @tparam PinMaskV             Mask of the pins owned by the group (default is all 16 pins).
+ *
+ * @note GpioPort class is non-copyable and non-movable.
+ * @note Pins must be configured as outputs (for writes) or inputs (for Read()) in CubeMX.
+ * @note Pin bits of arguments outside PinMaskV are ignored.
+ *
+ * @example Usage:
+ * @code{.cpp}
+ * #include <STM32LibraryCollection/Gpio.hpp>
+ *
+ * // 8-bit parallel bus on PB0..PB7
+ * STM32::GpioPort<GPIOB_BASE, 0x00FF> data_bus{};
+ * data_bus.Write(0xA5);                            // PB0..PB7 = 0xA5, PB8..PB15 untouched
+ *
+ * // Step pulses of three motors at once
+ * STM32::GpioPort<GPIOA_BASE, GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2> steps{};
+ * steps.Set(GPIO_PIN_0 | GPIO_PIN_2);
+ * steps.Reset(GPIO_PIN_0 | GPIO_PIN_2);
+ * steps.Modify(GPIO_PIN_1, GPIO_PIN_0);            // PA1 high and PA0 low in one write
+ * @endcode
+ */
+template <std::uintptr_t PortAddressV, std::uint16_t PinMaskV = 0xFFFF>
+class GpioPort {
+    static_assert(
+        PinMaskV != 0,
+        "Pin mask must select at least one pin"
+    );
+public:
+
+    /**
+     * @brief Construct a new GpioPort object.
+     */
+    GpioPort() noexcept = default;
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    GpioPort(const GpioPort &) = delete;
+    GpioPort &operator=(const GpioPort &) = delete;
+    GpioPort(GpioPort &&) = delete;
+    GpioPort &operator=(GpioPort &&) = delete;
+    /** @} */
+
+    /**
+     * @returns HAL GPIO handle.
+     */
+    [[nodiscard]]
+    static GPIO_TypeDef* GetHandle() noexcept
+    {
+        return reinterpret_cast<GPIO_TypeDef*>(PortAddressV);
+    }
+
+    /**
+     * @returns Mask of the pins owned by the group.
+     */
+    [[nodiscard]]
+    static constexpr std::uint16_t GetPins() noexcept
+    {
+        return PinMaskV;
+    }
+
+    /**
+     * @returns Input states of the owned pins, other bits are zero.
+     */
+    [[nodiscard]]
+    static std::uint16_t Read() noexcept
+    {
+        return static_cast<std::uint16_t>(GetHandle()->IDR & PinMaskV);
+    }
+
+    /**
+     * @brief Drive all owned pins to the corresponding bits of a value.
+     * 
+     * @param value     Pin states, bit n drives pin n of the port.
+     */
+    static void Write(std::uint16_t value) noexcept
+    {
+        Modify(value, static_cast<std::uint16_t>(~value));
+    }
+
+    /**
+     * @brief Set and reset pins in a single write.
+     * 
+     * @param set_pins      Pins to set to High state.
+     * @param reset_pins    Pins to set to Low state, set_pins take precedence.
+     */
+    static void Modify(std::uint16_t set_pins, std::uint16_t reset_pins) noexcept
+    {
+        GetHandle()->BSRR =
+            (std::uint32_t{static_cast<std::uint16_t>(reset_pins & PinMaskV)} << 16U) |
+            (set_pins & PinMaskV);
+    }
+
+    /**
+     * @brief Set pins to High state.
+     * 
+     * @param pins      Pins to set (default is all owned pins).
+     */
+    static void Set(std::uint16_t pins = PinMaskV) noexcept
+    {
+        GetHandle()->BSRR = pins & PinMaskV;
+    }
+
+    /**
+     * @brief Set pins to Low state.
+     * 
+     * @param pins      Pins to reset (default is all owned pins).
+     */
+    static void Reset(std::uint16_t pins = PinMaskV) noexcept
+    {
+        GetHandle()->BSRR = std::uint32_t{static_cast<std::uint16_t>(pins & PinMaskV)} << 16U;
+    }
+
+    /**
+     * @brief Toggle pins.
+     * 
+     * @param pins      Pins to toggle (default is all owned pins).
+     */
+    static void Toggle(std::uint16_t pins = PinMaskV) noexcept
+    {
+        const auto output = static_cast<std::uint16_t>(GetHandle()->ODR);
+        Modify(static_cast<std::uint16_t>(~output & pins), static_cast<std::uint16_t>(output & pins));
+    }
+};
+
 } /* namespace STM32 */
 
 #endif /* STM32_GPIO_HPP */
@@ -0,0 +1,416 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_GPIO_INTERRUPT_HPP
+#define STM32_GPIO_INTERRUPT_HPP
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <utility>
+
+#include "Gpio.hpp"
+#include "Timer.hpp"
+#include "__Internal/__Utility.hpp"
+
+#include "main.h"
+
+namespace STM32 {
+
+/**
+ * @namespace GpioEdge, Tag types for the EXTI trigger edge of a GPIO pin.
+ *
+ * The tag must match the "GPIO mode" setting of the pin in CubeMX
+ * (External Interrupt Mode with Rising/Falling/Rising-Falling edge trigger detection).
+ */
+namespace GpioEdge {
+
+/**
+ * @struct Rising, Tag for rising edge trigger detection.
+ */
+struct Rising {};
+
+/**
+ * @struct Falling, Tag for falling edge trigger detection.
+ */
+struct Falling {};
+
+/**
+ * @struct Both, Tag for rising and falling edge trigger detection.
+ */
+struct Both {};
+
+} /* namespace GpioEdge */
+
+/**
+ * @brief IsGpioEdge, A concept to check if a type is a GpioEdge.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/GpioInterrupt.hpp>
+ *
+ * static_assert(STM32::IsGpioEdge<STM32::GpioEdge::Both>);
+ * static_assert(!STM32::IsGpioEdge<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsGpioEdge =
+    std::same_as<T, GpioEdge::Rising> ||
+    std::same_as<T, GpioEdge::Falling> ||
+    std::same_as<T, GpioEdge::Both>;
+
+/**
+ * @struct GpioDebounceTime, A utility struct to hold the debounce time of a GpioInterrupt.
+ *
+ * @tparam TimeV    Debounce time in timer ticks, 0 disables debouncing.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/GpioInterrupt.hpp>
+ *
+ * using ButtonDebounce = STM32::GpioDebounceTime<20'000>; // 20 ms with a 1 MHz timer
+ * @endcode
+ */
+template <std::uint32_t TimeV>
+struct GpioDebounceTime : __Internal::__Constant<std::uint32_t, TimeV> {};
+
+/**
+ * @brief IsGpioDebounceTime, A concept to check if a type is a GpioDebounceTime.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/GpioInterrupt.hpp>
+ *
+ * static_assert(STM32::IsGpioDebounceTime<STM32::GpioDebounceTime<1000>>);
+ * static_assert(!STM32::IsGpioDebounceTime<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsGpioDebounceTime =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::uint32_t>;
+
+template <IsGpioEdge GpioEdgeT, IsGpioDebounceTime DebounceTimeT>
+class GpioInterrupt;
+
+/**
+ * @class GpioInterruptDispatcher, Routes EXTI line interrupts to GpioInterrupt instances.
+ *
+ * HAL reports GPIO EXTI events through a single weak callback for all lines,
+ * so each GpioInterrupt registers itself in a table indexed by its EXTI line
+ * and Dispatch() forwards the event in constant time.
+ *
+ * @note Call Dispatch() from the HAL GPIO EXTI callback(s), see the example.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/GpioInterrupt.hpp>
+ *
+ * extern "C" void HAL_GPIO_EXTI_Callback(std::uint16_t GPIO_Pin)
+ * {
+ *     STM32::GpioInterruptDispatcher::Dispatch(GPIO_Pin);
+ * }
+ *
+ * // Families with separate edge callbacks (e.g., STM32G0, STM32L5, STM32U5)
+ * extern "C" void HAL_GPIO_EXTI_Rising_Callback(std::uint16_t GPIO_Pin)
+ * {
+ *     STM32::GpioInterruptDispatcher::Dispatch(GPIO_Pin);
+ * }
+ * extern "C" void HAL_GPIO_EXTI_Falling_Callback(std::uint16_t GPIO_Pin)
+ * {
+ *     STM32::GpioInterruptDispatcher::Dispatch(GPIO_Pin);
+ * }
+ * @endcode
+ */
+class GpioInterruptDispatcher {
+    template <IsGpioEdge, IsGpioDebounceTime>
+    friend class GpioInterrupt;
+public:
+
+    /** @brief Number of EXTI lines of GPIO pins. */
+    static constexpr std::size_t line_count{16};
+
+    /**
+     * @brief Forward an EXTI event to the GpioInterrupt of its line.
+     *
+     * @param pin       GPIO pin mask reported by HAL (e.g., GPIO_PIN_13).
+     */
+    static void Dispatch(std::uint16_t pin) noexcept
+    {
+        if (pin == 0) {
+            return;
+        }
+        auto& handler = s_handlers[static_cast<std::size_t>(std::countr_zero(pin))];
+        if (handler) {
+            handler();
+        }
+    }
+
+private:
+    static inline std::array<CallbackT, line_count> s_handlers{};
+
+    /**
+     * @returns EXTI line of a GPIO pin mask.
+     */
+    static std::size_t Line(std::uint16_t pin) noexcept
+    {
+        return static_cast<std::size_t>(std::countr_zero(pin)) & (line_count - 1);
+    }
+};
+
+/**
+ * @class GpioInterrupt, An EXTI-driven GPIO input with edge callbacks and optional debounce.
+ *
+ * Edge callbacks run directly from the EXTI interrupt, so the input does not
+ * need to be polled. With a non-zero DebounceTimeT, an edge is accepted only if
+ * at least DebounceTimeT ticks of the given Timer have elapsed since the previously
+ * accepted edge; bounces within that window are dropped without any waiting.
+ *
+ * With GpioEdge::Both, the edge direction is taken from the pin state in the
+ * interrupt, and repeated edges that do not change the state are dropped. An
+ * edge dropped by the debounce window may be the last one of a bounce, call
+ * Poll() periodically so the pin is sampled again once the window expired.
+ * Poll() also expires the window, so an edge after a long idle gap is not
+ * taken for a bounce once the timer counter wrapped around.
+ *
+ * @tparam GpioEdgeT        Trigger edge configured for the pin in CubeMX.
+ * @tparam DebounceTimeT    Debounce time in timer ticks (default is 0, no debouncing).
+ *
+ * @note GpioInterrupt class is non-copyable and non-movable.
+ * @note EXTI lines are shared by all ports (e.g., PA0 and PB0 are both line 0),
+ *       use at most one GpioInterrupt per line.
+ * @note Callbacks run in interrupt context, see GpioInterruptDispatcher for the
+ *       required HAL callback forwarding.
+ * @note Debounce time must be shorter than the timer period, and the counter must
+ *       not be reset (e.g., by Timer::SleepFor()) while debouncing.
+ * @note With debouncing, call Poll() at least once per timer period (e.g., 65536 ticks
+ *       of a 16-bit timer), or use a 32-bit timer when edges are rare: an idle gap
+ *       longer than the period without Poll() may drop the next genuine edge.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/GpioInterrupt.hpp>
+ *
+ * TIM_HandleTypeDef htim2; // 1 MHz, 32-bit free running
+ * STM32::Timer timer{htim2};
+ *
+ * STM32::GpioInput button_pin{GPIOC, GPIO_PIN_13};
+ * STM32::GpioInterrupt<STM32::GpioEdge::Both, STM32::GpioDebounceTime<20'000>> button{button_pin, timer};
+ *
+ * button.SetFallingCallback([](){ // pressed
+ * });
+ * button.SetRisingCallback([](){ // released
+ * });
+ *
+ * while (true) {
+ *     button.Poll();               // Catches a release that ended within the debounce window
+ * }
+ *
+ * // Limit switch without debouncing
+ * STM32::GpioInput limit_pin{GPIOA, GPIO_PIN_4};
+ * STM32::GpioInterrupt<STM32::GpioEdge::Rising> limit{limit_pin};
+ * limit.SetRisingCallback([](){ // stop the axis
+ * });
+ * @endcode
+ */
+template <IsGpioEdge GpioEdgeT, IsGpioDebounceTime DebounceTimeT = GpioDebounceTime<0>>
+class GpioInterrupt {
+    static constexpr bool s_is_debounced{DebounceTimeT::value > 0};
+public:
+
+    /**
+     * @brief Construct GpioInterrupt class without debouncing.
+     *
+     * @param pin       GPIO input configured in external interrupt mode.
+     *
+     * @note Registers the instance for the EXTI line of pin.
+     */
+    explicit GpioInterrupt(GpioInput& pin) noexcept
+    requires (!s_is_debounced)
+      : m_pin{pin}
+    {
+        Register();
+    }
+
+    /**
+     * @brief Construct GpioInterrupt class with debouncing.
+     *
+     * @param pin       GPIO input configured in external interrupt mode.
+     * @param timer     Free-running timer used to timestamp edges.
+     *
+     * @note Registers the instance for the EXTI line of pin.
+     */
+    GpioInterrupt(GpioInput& pin, Timer& timer) noexcept
+    requires s_is_debounced
+      : m_pin{pin},
+        m_timer{&timer}
+    {
+        Register();
+    }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    GpioInterrupt(const GpioInterrupt&) = delete;
+    GpioInterrupt& operator=(const GpioInterrupt&) = delete;
+    GpioInterrupt(GpioInterrupt&&) = delete;
+    GpioInterrupt& operator=(GpioInterrupt&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy GpioInterrupt class, unregisters the EXTI line.
+     */
+    ~GpioInterrupt()
+    {
+        __Internal::__CriticalSection critical_section{};
+        GpioInterruptDispatcher::s_handlers[GpioInterruptDispatcher::Line(m_pin.GetPin())] = nullptr;
+    }
+
+    /**
+     * @returns State of the pin after the last accepted edge.
+     */
+    [[nodiscard]]
+    GpioPinState Read() const noexcept
+    {
+        return m_state;
+    }
+
+    /**
+     * @brief Set the callback of rising edges.
+     *
+     * @param callback  Callback function to be called, in interrupt context, on each accepted rising edge.
+     *
+     * @note Must not be called from the edge callbacks.
+     */
+    void SetRisingCallback(CallbackT&& callback) noexcept
+    requires (!std::same_as<GpioEdgeT, GpioEdge::Falling>)
+    {
+        __Internal::__CriticalSection critical_section{};
+        m_rising_callback = std::move(callback);
+    }
+
+    /**
+     * @brief Set the callback of falling edges.
+     *
+     * @param callback  Callback function to be called, in interrupt context, on each accepted falling edge.
+     *
+     * @note Must not be called from the edge callbacks.
+     */
+    void SetFallingCallback(CallbackT&& callback) noexcept
+    requires (!std::same_as<GpioEdgeT, GpioEdge::Rising>)
+    {
+        __Internal::__CriticalSection critical_section{};
+        m_falling_callback = std::move(callback);
+    }
+
+    /**
+     * @brief Expire the debounce window and, with GpioEdge::Both, sample the pin again if an edge was dropped.
+     *
+     * Once the window of the last accepted edge expired, the edge is forgotten, so the
+     * next edge is accepted even after the timer counter wrapped around. With GpioEdge::Both,
+     * the callback of the new state is called if it changed since the last accepted edge,
+     * so the state does not stay stale when the last edge of a bounce was dropped.
+     *
+     * @note Call periodically from the main loop or a timer callback (e.g.,
+     *       TimerScheduler::CallEvery() with the debounce time as period), at least
+     *       once per timer period.
+     * @note The callback then runs in the calling context with interrupts masked.
+     */
+    void Poll() noexcept
+    requires s_is_debounced
+    {
+        __Internal::__CriticalSection critical_section{};
+        if (IsWithinDebounce()) {
+            return;
+        }
+        m_has_edge = false;
+        if constexpr (std::same_as<GpioEdgeT, GpioEdge::Both>) {
+            if (m_is_pending) {
+                m_is_pending = false;
+                Accept();
+            }
+        }
+    }
+
+private:
+    GpioInput& m_pin;
+    Timer* m_timer{};
+    CallbackT m_rising_callback{};
+    CallbackT m_falling_callback{};
+    std::uint32_t m_last_edge{};
+    bool m_has_edge{};
+    bool m_is_pending{};
+    GpioPinState m_state{};
+
+    /**
+     * @brief Register the edge handler for the EXTI line of the pin.
+     */
+    void Register() noexcept
+    {
+        m_state = m_pin.Read();
+        __Internal::__CriticalSection critical_section{};
+        GpioInterruptDispatcher::s_handlers[GpioInterruptDispatcher::Line(m_pin.GetPin())] = [this](){
+            OnEdge();
+        };
+    }
+
+    /**
+     * @returns True if the debounce window of the last accepted edge has not expired.
+     */
+    bool IsWithinDebounce() const noexcept
+    {
+        return m_has_edge && m_timer->ElapsedSince(m_last_edge) < DebounceTimeT::value;
+    }
+
+    /**
+     * @brief EXTI handler, debounces the edge and calls the matching callback.
+     */
+    void OnEdge() noexcept
+    {
+        if constexpr (s_is_debounced) {
+            if (IsWithinDebounce()) {
+                m_is_pending = true;
+                return;
+            }
+            m_is_pending = false;
+        }
+        Accept();
+    }
+
+    /**
+     * @brief Take the state of an accepted edge, stamp it and call the matching callback.
+     */
+    void Accept() noexcept
+    {
+        GpioPinState state{};
+        if constexpr (std::same_as<GpioEdgeT, GpioEdge::Rising>) {
+            state = GpioPinState::High;
+        } else if constexpr (std::same_as<GpioEdgeT, GpioEdge::Falling>) {
+            state = GpioPinState::Low;
+        } else {
+            state = m_pin.Read();
+            if (state == m_state) {
+                return;
+            }
+        }
+        if constexpr (s_is_debounced) {
+            m_last_edge = m_timer->Get();
+            m_has_edge = true;
+        }
+        m_state = state;
+        auto& callback = (state == GpioPinState::High) ? m_rising_callback : m_falling_callback;
+        if (callback) {
+            callback();
+        }
+    }
+};
+
+} /* namespace STM32 */
+
+#endif /* STM32_GPIO_INTERRUPT_HPP */
@@ -4,8 +4,18 @@
 #ifndef STM32_HCSR04_HPP
 #define STM32_HCSR04_HPP
 
-#include <Gpio.hpp>
-#include <Timer.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "Gpio.hpp"
+#include "GpioInterrupt.hpp"
+#include "Timer.hpp"
+#include "__Internal/__Utility.hpp"
 
 #if !defined(HCSR04_OUTPUT_VOLTAGE_REDUCED)
 static_assert(false,
@@ -72,6 +82,340 @@ private:
 	static constexpr int new_measurement_delay = 100'000;	/* us */
 };
 
+/**
+ * @struct Hcsr04Interval, A utility struct to hold the minimum time between two triggers of a Hcsr04Scanner.
+ *
+ * @tparam IntervalV    Minimum time between consecutive triggers in microseconds.
+ *
+ * @note The datasheet recommends at least 60 ms, so that the echo of a measurement
+ *       does not reach the next one. Sensors facing different directions may use less.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * using FastInterval = STM32::Hcsr04Interval<40'000>;
+ * @endcode
+ */
+template <std::uint32_t IntervalV>
+struct Hcsr04Interval : __Internal::__Constant<std::uint32_t, IntervalV> {};
+
+/**
+ * @brief IsHcsr04Interval, A concept to check if a type is a Hcsr04Interval.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Hcsr04.hpp>
+ *
+ * static_assert(STM32::IsHcsr04Interval<STM32::Hcsr04Interval<60'000>>);
+ * static_assert(!STM32::IsHcsr04Interval<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsHcsr04Interval =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::uint32_t>;
+
+template <
+    std::size_t SensorCountV,
+    IsHcsr04Interval IntervalT = Hcsr04Interval<60'000>
+>
+class Hcsr04Scanner;
+
+/**
+ * @class Hcsr04Sensor, An interrupt-driven HC-SR04 ultrasonic distance sensor.
+ *
+ * The echo pulse is timestamped from the EXTI interrupts of the echo pin with a
+ * shared free-running Timer, so no CPU time is spent waiting for the echo.
+ * Measurements are started by a Hcsr04Scanner, which may drive several sensors.
+ *
+ * @note Hcsr04Sensor class is non-copyable and non-movable.
+ * @note The echo pin must be configured in external interrupt mode with
+ *       rising and falling edge detection, see GpioInterrupt and GpioInterruptDispatcher.
+ * @note The timer of the scanner must count microseconds.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Hcsr04.hpp>
+ *
+ * STM32::GpioOutput trigger_pin{GPIOA, GPIO_PIN_0};
+ * STM32::GpioInput echo_pin{GPIOA, GPIO_PIN_1};
+ *
+ * STM32::Hcsr04Sensor sensor{trigger_pin, echo_pin};
+ * sensor.SetCallback([](std::uint16_t distance){
+ *     // New distance in cm, called from interrupt context
+ * });
+ * auto latest = sensor.GetDistance();
+ * @endcode
+ */
+class Hcsr04Sensor {
+    template <std::size_t, IsHcsr04Interval>
+    friend class Hcsr04Scanner;
+
+    /**
+     * @enum State, Measurement state of the sensor.
+     */
+    enum class State : std::uint8_t {
+        Idle,
+        Triggered,
+        Echo
+    };
+public:
+
+    /** @brief Distance reported when no echo is received, in cm. */
+    static constexpr std::uint16_t max_distance{400};
+
+    /**
+     * @brief Construct Hcsr04Sensor class.
+     *
+     * @param trigger_pin   Output connected to the TRIG pin of the sensor.
+     * @param echo_pin      EXTI input connected to the ECHO pin of the sensor.
+     */
+    Hcsr04Sensor(GpioOutput& trigger_pin, GpioInput& echo_pin) noexcept
+      : m_trigger_pin{trigger_pin},
+        m_echo_interrupt{echo_pin}
+    {
+        m_trigger_pin.Low();
+        m_echo_interrupt.SetRisingCallback([this](){
+            OnEchoStart();
+        });
+        m_echo_interrupt.SetFallingCallback([this](){
+            OnEchoEnd();
+        });
+    }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    Hcsr04Sensor(const Hcsr04Sensor&) = delete;
+    Hcsr04Sensor& operator=(const Hcsr04Sensor&) = delete;
+    Hcsr04Sensor(Hcsr04Sensor&&) = delete;
+    Hcsr04Sensor& operator=(Hcsr04Sensor&&) = delete;
+    /** @} */
+
+    /**
+     * @returns Latest measured distance in cm, max_distance if out of range or not measured yet.
+     */
+    [[nodiscard]]
+    std::uint16_t GetDistance() const noexcept
+    {
+        return m_distance.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @returns True while a measurement is ongoing.
+     */
+    [[nodiscard]]
+    bool IsBusy() const noexcept
+    {
+        return m_state.load(std::memory_order_acquire) != State::Idle;
+    }
+
+    /**
+     * @brief Set the callback of completed measurements.
+     *
+     * @param callback  Callback function to be called with each new distance in cm,
+     *                  from the echo interrupt, or from Hcsr04Scanner::Update() on timeout.
+     *
+     * @note Must not be called from the callback.
+     */
+    void SetCallback(EventCallbackT<std::uint16_t>&& callback) noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        m_callback = std::move(callback);
+    }
+
+private:
+    GpioOutput& m_trigger_pin;
+    GpioInterrupt<GpioEdge::Both> m_echo_interrupt;
+    EventCallbackT<std::uint16_t> m_callback{};
+    Timer* m_timer{};
+    std::uint32_t m_trigger_time{};
+    std::uint32_t m_echo_start{};
+    std::atomic<std::uint16_t> m_distance{max_distance};
+    std::atomic<State> m_state{State::Idle};
+
+    static constexpr std::uint32_t s_trigger_pulse_width{10};   /* us */
+    static constexpr std::uint32_t s_echo_timeout{30'000};      /* us */
+    static constexpr std::uint32_t s_round_trip_per_cm{58};     /* us */
+
+    /**
+     * @brief Emit the 10 us trigger pulse and wait for the echo.
+     *
+     * @param timer     Free-running microsecond timer.
+     */
+    void Trigger(Timer& timer) noexcept
+    {
+        m_timer = &timer;
+        m_state.store(State::Triggered, std::memory_order_release);
+        m_trigger_pin.High();
+        m_trigger_time = timer.Get();
+        while (timer.ElapsedSince(m_trigger_time) < s_trigger_pulse_width);
+        m_trigger_pin.Low();
+    }
+
+    /**
+     * @brief Finish the measurement with max_distance if the echo does not end in time.
+     */
+    void CheckTimeout() noexcept
+    {
+        {
+            __Internal::__CriticalSection critical_section{};
+            if (m_state.load(std::memory_order_relaxed) == State::Idle ||
+                m_timer->ElapsedSince(m_trigger_time) < s_trigger_pulse_width + s_echo_timeout) {
+                return;
+            }
+            m_state.store(State::Idle, std::memory_order_relaxed);
+        }
+        Complete(max_distance);
+    }
+
+    /**
+     * @brief Rising edge handler of the echo pin.
+     */
+    void OnEchoStart() noexcept
+    {
+        if (m_state.load(std::memory_order_relaxed) != State::Triggered) {
+            return;
+        }
+        m_echo_start = m_timer->Get();
+        m_state.store(State::Echo, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Falling edge handler of the echo pin.
+     */
+    void OnEchoEnd() noexcept
+    {
+        if (m_state.load(std::memory_order_relaxed) != State::Echo) {
+            return;
+        }
+        const auto width = m_timer->ElapsedSince(m_echo_start);
+        m_state.store(State::Idle, std::memory_order_release);
+        Complete(static_cast<std::uint16_t>(
+            std::min<std::uint32_t>(width / s_round_trip_per_cm, max_distance)
+        ));
+    }
+
+    /**
+     * @brief Publish a distance and notify the callback.
+     */
+    void Complete(std::uint16_t distance) noexcept
+    {
+        m_distance.store(distance, std::memory_order_relaxed);
+        if (m_callback) {
+            m_callback(distance);
+        }
+    }
+};
+
+/**
+ * @class Hcsr04Scanner, A non-blocking round-robin trigger scheduler for Hcsr04Sensor instances.
+ *
+ * Triggers one sensor at a time, in order, so that sensors on the same robot do
+ * not receive each other's echoes. Update() never waits: it returns immediately
+ * unless the next trigger is due, and all sensors share one timer without
+ * resetting its counter.
+ *
+ * @tparam SensorCountV     Number of sensors.
+ * @tparam IntervalT        Minimum time between consecutive triggers (default is 60 ms).
+ *
+ * @note Hcsr04Scanner class is non-copyable and non-movable.
+ * @note The timer must count microseconds, and its period must exceed IntervalT.
+ *       A 32-bit timer (e.g., TIM2 or TIM5) is recommended.
+ * @note Only the 10 us trigger pulse is generated by busy-waiting.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Hcsr04.hpp>
+ *
+ * TIM_HandleTypeDef htim2; // 1 MHz, 32-bit free running
+ * STM32::Timer timer{htim2};
+ *
+ * STM32::Hcsr04Sensor front{front_trigger, front_echo};
+ * STM32::Hcsr04Sensor left{left_trigger, left_echo};
+ * STM32::Hcsr04Sensor right{right_trigger, right_echo};
+ * STM32::Hcsr04Sensor back{back_trigger, back_echo};
+ *
+ * STM32::Hcsr04Scanner scanner{timer, front, left, right, back};
+ *
+ * while (true) {
+ *     scanner.Update();                    // Returns immediately
+ *     auto obstacle = front.GetDistance(); // Latest value
+ *     // ... control loop ...
+ * }
+ * @endcode
+ */
+template <std::size_t SensorCountV, IsHcsr04Interval IntervalT>
+class Hcsr04Scanner {
+    static_assert(
+        SensorCountV > 0,
+        "Sensor count must be greater than zero"
+    );
+public:
+
+    /**
+     * @brief Construct Hcsr04Scanner class.
+     *
+     * @param timer     Free-running microsecond timer.
+     * @param sensors   Sensors to trigger, in round-robin order.
+     */
+    template <std::same_as<Hcsr04Sensor>... SensorsT>
+    requires (sizeof...(SensorsT) == SensorCountV)
+    Hcsr04Scanner(Timer& timer, SensorsT&... sensors) noexcept
+      : m_timer{timer},
+        m_sensors{&sensors...}
+    { }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    Hcsr04Scanner(const Hcsr04Scanner&) = delete;
+    Hcsr04Scanner& operator=(const Hcsr04Scanner&) = delete;
+    Hcsr04Scanner(Hcsr04Scanner&&) = delete;
+    Hcsr04Scanner& operator=(Hcsr04Scanner&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Advance the scan, call periodically from the main loop.
+     *
+     * Completes a measurement that has timed out, and triggers the next sensor
+     * once the current one has finished and IntervalT has elapsed.
+     */
+    void Update() noexcept
+    {
+        auto& current = *m_sensors[m_index];
+        if (m_has_triggered) {
+            if (current.IsBusy()) {
+                current.CheckTimeout();
+                return;
+            }
+            if (m_timer.ElapsedSince(m_last_trigger) < IntervalT::value) {
+                return;
+            }
+            m_index = (m_index + 1) % SensorCountV;
+        }
+        m_last_trigger = m_timer.Get();
+        m_has_triggered = true;
+        m_sensors[m_index]->Trigger(m_timer);
+    }
+
+private:
+    Timer& m_timer;
+    std::array<Hcsr04Sensor*, SensorCountV> m_sensors;
+    std::size_t m_index{};
+    std::uint32_t m_last_trigger{};
+    bool m_has_triggered{};
+};
+
+/**
+ * @brief Deduction guide, deduces the sensor count from the constructor arguments.
+ */
+template <typename... SensorsT>
+Hcsr04Scanner(Timer&, SensorsT&...) -> Hcsr04Scanner<sizeof...(SensorsT)>;
+
 } /* namespace STM32 */
 
 #endif /* STM32_HCSR04_HPP */
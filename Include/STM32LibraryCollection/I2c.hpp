@@ -5,13 +5,18 @@
 #define STM32_I2C_HPP
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
 #include <concepts>
+#include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <ranges>
 #include <utility>
 
 #include "Config.hpp"
+#include "EventQueue.hpp"
 #include "__Internal/__Utility.hpp"
 
 #include "main.h"
@@ -252,6 +257,71 @@ concept IsI2cMaxAttempts =
 template <typename T>
 concept IsI2cMessage = __Internal::__IsMessage<T, std::uint8_t>;
 
+/**
+ * @brief IsI2c, A concept to check if a type is a I2c.
+ * 
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/I2c.hpp>
+ * 
+ * static_assert(STM32::IsI2c<STM32::I2c<STM32::WorkingMode::DMA, STM32_UNIQUE_TAG>>);
+ * static_assert(!STM32::IsI2c<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsI2c =
+    IsWorkingMode<typename T::DefaultWorkingModeT> &&
+    requires (T& i2c) {
+        { i2c.GetHandle() } -> std::same_as<I2C_HandleTypeDef&>;
+    };
+
+/**
+ * @struct I2cTransactionQueueCapacity, A utility struct to hold the I2C transaction queue capacity.
+ * 
+ * @tparam CapacityV    Maximum number of queued transactions (must be a power of two).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/I2c.hpp>
+ *
+ * using MyQueueCapacity = STM32::I2cTransactionQueueCapacity<16>;
+ * @endcode
+ */
+template <std::size_t CapacityV>
+struct I2cTransactionQueueCapacity : __Internal::__Constant<std::size_t, CapacityV> {
+    static_assert(
+        std::has_single_bit(CapacityV),
+        "Capacity must be a power of two"
+    );
+};
+
+/**
+ * @brief IsI2cTransactionQueueCapacity, A concept to check if a type is a I2cTransactionQueueCapacity.
+ * 
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/I2c.hpp>
+ * 
+ * static_assert(STM32::IsI2cTransactionQueueCapacity<STM32::I2cTransactionQueueCapacity<8>>);
+ * static_assert(!STM32::IsI2cTransactionQueueCapacity<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsI2cTransactionQueueCapacity =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t> &&
+    std::has_single_bit(T::value);
+
+template <
+    IsI2c I2cT,
+    IsI2cTransactionQueueCapacity CapacityT = I2cTransactionQueueCapacity<8>
+>
+class I2cTransactionQueue;
+
 /**
  * @class I2c, A class to manage I2C functionality on STM32 microcontrollers.
  * 
@@ -268,6 +338,8 @@ concept IsI2cMessage = __Internal::__IsMessage<T, std::uint8_t>;
  *                              UniqueTagT must be STM32_UNIQUE_TAG.
  *
  * @note I2c class is non-copyable and non-movable.
+ * @note At most STM32_CALLBACK_INSTANCE_CAPACITY (default is 4) I2c instances may exist at the same time,
+ *       constructing one more calls STM32_CALLBACK_INSTANCE_OVERFLOW() (default is Error_Handler()).
  * @note This class operates in master mode only.
  * @note Device addresses should be 7-bit left-shifted (or 8-bit with R/W bit cleared).
  *
@@ -325,23 +397,36 @@ concept IsI2cMessage = __Internal::__IsMessage<T, std::uint8_t>;
  */
 template <IsWorkingMode WorkingModeT, __Internal::__IsUniqueTag UniqueTagT>
 class I2c {
-    using MasterTransmitCompleteCallbackT = __Internal::__CallbackManager<
-        I2C_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
-        HAL_I2C_RegisterCallback, HAL_I2C_UnRegisterCallback, HAL_I2C_MASTER_TX_COMPLETE_CB_ID
+    using MasterTransmitCompleteCallbackT = __Internal::__InstanceCallbackManager<
+        I2C_HandleTypeDef,
+        HAL_I2C_RegisterCallback, HAL_I2C_UnRegisterCallback, HAL_I2C_MASTER_TX_COMPLETE_CB_ID,
+        __Internal::__ProbeComplete<InstrumentationProbe::I2cTransmit>
     >;
-    using MasterReceiveCompleteCallbackT = __Internal::__CallbackManager<
-        I2C_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
-        HAL_I2C_RegisterCallback, HAL_I2C_UnRegisterCallback, HAL_I2C_MASTER_RX_COMPLETE_CB_ID
+    using MasterReceiveCompleteCallbackT = __Internal::__InstanceCallbackManager<
+        I2C_HandleTypeDef,
+        HAL_I2C_RegisterCallback, HAL_I2C_UnRegisterCallback, HAL_I2C_MASTER_RX_COMPLETE_CB_ID,
+        __Internal::__ProbeComplete<InstrumentationProbe::I2cReceive>
     >;
-    using MemoryTransmitCompleteCallbackT = __Internal::__CallbackManager<
-        I2C_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
-        HAL_I2C_RegisterCallback, HAL_I2C_UnRegisterCallback, HAL_I2C_MEM_TX_COMPLETE_CB_ID
+    using MemoryTransmitCompleteCallbackT = __Internal::__InstanceCallbackManager<
+        I2C_HandleTypeDef,
+        HAL_I2C_RegisterCallback, HAL_I2C_UnRegisterCallback, HAL_I2C_MEM_TX_COMPLETE_CB_ID,
+        __Internal::__ProbeComplete<InstrumentationProbe::I2cMemoryWrite>
     >;
-    using MemoryReceiveCompleteCallbackT = __Internal::__CallbackManager<
-        I2C_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
-        HAL_I2C_RegisterCallback, HAL_I2C_UnRegisterCallback, HAL_I2C_MEM_RX_COMPLETE_CB_ID
+    using MemoryReceiveCompleteCallbackT = __Internal::__InstanceCallbackManager<
+        I2C_HandleTypeDef,
+        HAL_I2C_RegisterCallback, HAL_I2C_UnRegisterCallback, HAL_I2C_MEM_RX_COMPLETE_CB_ID,
+        __Internal::__ProbeComplete<InstrumentationProbe::I2cMemoryRead>
     >;
+    using ErrorCallbackT = __Internal::__InstanceCallbackManager<
+        I2C_HandleTypeDef,
+        HAL_I2C_RegisterCallback, HAL_I2C_UnRegisterCallback, HAL_I2C_ERROR_CB_ID,
+        nullptr, __Internal::__HalErrorCode<I2C_HandleTypeDef>
+    >;
+
+    template <IsI2c, IsI2cTransactionQueueCapacity>
+    friend class I2cTransactionQueue;
 public:
+    using DefaultWorkingModeT = WorkingModeT;
 
     /**
      * @brief Construct I2c class.
@@ -355,7 +440,8 @@ public:
         m_master_transmit_complete_callback{handle},
         m_master_receive_complete_callback{handle},
         m_memory_transmit_complete_callback{handle},
-        m_memory_receive_complete_callback{handle}
+        m_memory_receive_complete_callback{handle},
+        m_error_callback{handle}
     { }
 
     /**
@@ -409,13 +495,14 @@ public:
     ) noexcept
     requires std::same_as<RxWorkingModeT, WorkingMode::Blocking>
     {
-        return (HAL_OK == HAL_I2C_Master_Receive(
-            &m_handle,
+        const auto size = __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message));
+        return __Internal::__Measure<InstrumentationProbe::I2cReceive>(
+            m_handle, size, HAL_I2C_Master_Receive,
             DeviceAddressT::value,
             std::ranges::data(rx_message),
-            __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message)),
+            size,
             TimeoutV::value
-        ));
+        );
     }
 
     /**
@@ -445,19 +532,21 @@ public:
             std::move(complete_callback)
         );
         if constexpr (std::same_as<RxWorkingModeT, WorkingMode::Interrupt>) {
-            return (HAL_OK == HAL_I2C_Master_Receive_IT(
-                &m_handle,
+            const auto size = __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message));
+            return __Internal::__Measure<InstrumentationProbe::I2cReceive, __Internal::__ProbeBytes::OnComplete>(
+                m_handle, size, HAL_I2C_Master_Receive_IT,
                 DeviceAddressT::value,
                 std::ranges::data(rx_message),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message))
-            ));
+                size
+            );
         } else if constexpr (std::same_as<RxWorkingModeT, WorkingMode::DMA>) {
-            return (HAL_OK == HAL_I2C_Master_Receive_DMA(
-                &m_handle,
+            const auto size = __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message));
+            return __Internal::__Measure<InstrumentationProbe::I2cReceive, __Internal::__ProbeBytes::OnComplete>(
+                m_handle, size, HAL_I2C_Master_Receive_DMA,
                 DeviceAddressT::value,
                 std::ranges::data(rx_message),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message))
-            ));
+                size
+            );
         }
     }
 
@@ -486,13 +575,14 @@ public:
     ) noexcept
     requires std::same_as<TxWorkingModeT, WorkingMode::Blocking>
     {
-        return (HAL_OK == HAL_I2C_Master_Transmit(
-            &m_handle,
+        const auto size = __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message));
+        return __Internal::__Measure<InstrumentationProbe::I2cTransmit>(
+            m_handle, size, HAL_I2C_Master_Transmit,
             DeviceAddressT::value,
             const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
-            __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message)),
+            size,
             TimeoutV::value
-        ));
+        );
     }
 
     /**
@@ -522,19 +612,21 @@ public:
             std::move(complete_callback)
         );
         if constexpr (std::same_as<TxWorkingModeT, WorkingMode::Interrupt>) {
-            return (HAL_OK == HAL_I2C_Master_Transmit_IT(
-                &m_handle,
+            const auto size = __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message));
+            return __Internal::__Measure<InstrumentationProbe::I2cTransmit, __Internal::__ProbeBytes::OnComplete>(
+                m_handle, size, HAL_I2C_Master_Transmit_IT,
                 DeviceAddressT::value,
                 const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message))
-            ));
+                size
+            );
         } else if constexpr (std::same_as<TxWorkingModeT, WorkingMode::DMA>) {
-            return (HAL_OK == HAL_I2C_Master_Transmit_DMA(
-                &m_handle,
+            const auto size = __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message));
+            return __Internal::__Measure<InstrumentationProbe::I2cTransmit, __Internal::__ProbeBytes::OnComplete>(
+                m_handle, size, HAL_I2C_Master_Transmit_DMA,
                 DeviceAddressT::value,
                 const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message))
-            ));
+                size
+            );
         }
     }
 
@@ -565,15 +657,16 @@ public:
     ) noexcept
     requires std::same_as<RxWorkingModeT, WorkingMode::Blocking>
     {
-        return (HAL_OK == HAL_I2C_Mem_Read(
-            &m_handle,
+        const auto size = __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message));
+        return __Internal::__Measure<InstrumentationProbe::I2cMemoryRead>(
+            m_handle, size, HAL_I2C_Mem_Read,
             DeviceAddressT::value,
             MemoryAddressT::address,
             std::to_underlying(MemoryAddressT::address_size),
             std::ranges::data(rx_message),
-            __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message)),
+            size,
             TimeoutV::value
-        ));
+        );
     }
 
     /**
@@ -605,23 +698,25 @@ public:
             std::move(complete_callback)
         );
         if constexpr (std::same_as<RxWorkingModeT, WorkingMode::Interrupt>) {
-            return (HAL_OK == HAL_I2C_Mem_Read_IT(
-                &m_handle,
+            const auto size = __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message));
+            return __Internal::__Measure<InstrumentationProbe::I2cMemoryRead, __Internal::__ProbeBytes::OnComplete>(
+                m_handle, size, HAL_I2C_Mem_Read_IT,
                 DeviceAddressT::value,
                 MemoryAddressT::address,
                 std::to_underlying(MemoryAddressT::address_size),
                 std::ranges::data(rx_message),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message))
-            ));
+                size
+            );
         } else if constexpr (std::same_as<RxWorkingModeT, WorkingMode::DMA>) {
-            return (HAL_OK == HAL_I2C_Mem_Read_DMA(
-                &m_handle,
+            const auto size = __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message));
+            return __Internal::__Measure<InstrumentationProbe::I2cMemoryRead, __Internal::__ProbeBytes::OnComplete>(
+                m_handle, size, HAL_I2C_Mem_Read_DMA,
                 DeviceAddressT::value,
                 MemoryAddressT::address,
                 std::to_underlying(MemoryAddressT::address_size),
                 std::ranges::data(rx_message),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message))
-            ));
+                size
+            );
         }
     }
 
@@ -652,15 +747,16 @@ public:
     ) noexcept
     requires std::same_as<TxWorkingModeT, WorkingMode::Blocking>
     {
-        return (HAL_OK == HAL_I2C_Mem_Write(
-            &m_handle,
+        const auto size = __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message));
+        return __Internal::__Measure<InstrumentationProbe::I2cMemoryWrite>(
+            m_handle, size, HAL_I2C_Mem_Write,
             DeviceAddressT::value,
             MemoryAddressT::address,
             std::to_underlying(MemoryAddressT::address_size),
             const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
-            __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message)),
+            size,
             TimeoutV::value
-        ));
+        );
     }
 
     /**
@@ -692,23 +788,25 @@ public:
             std::move(complete_callback)
         );
         if constexpr (std::same_as<TxWorkingModeT, WorkingMode::Interrupt>) {
-            return (HAL_OK == HAL_I2C_Mem_Write_IT(
-                &m_handle,
+            const auto size = __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message));
+            return __Internal::__Measure<InstrumentationProbe::I2cMemoryWrite, __Internal::__ProbeBytes::OnComplete>(
+                m_handle, size, HAL_I2C_Mem_Write_IT,
                 DeviceAddressT::value,
                 MemoryAddressT::address,
                 std::to_underlying(MemoryAddressT::address_size),
                 const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message))
-            ));
+                size
+            );
         } else if constexpr (std::same_as<TxWorkingModeT, WorkingMode::DMA>) {
-            return (HAL_OK == HAL_I2C_Mem_Write_DMA(
-                &m_handle,
+            const auto size = __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message));
+            return __Internal::__Measure<InstrumentationProbe::I2cMemoryWrite, __Internal::__ProbeBytes::OnComplete>(
+                m_handle, size, HAL_I2C_Mem_Write_DMA,
                 DeviceAddressT::value,
                 MemoryAddressT::address,
                 std::to_underlying(MemoryAddressT::address_size),
                 const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message))
-            ));
+                size
+            );
         }
     }
 
@@ -741,12 +839,495 @@ public:
         ));
     }
 
+    /**
+     * @brief Set the callback invoked when a non-blocking operation fails.
+     * 
+     * @param error_callback    Callback function receiving the HAL error code.
+     * 
+     * @returns True on success, false if the error callback is already owned
+     *          (e.g., by an I2cTransactionQueue or an AsyncTransfer()).
+     */
+    bool SetErrorCallback(EventCallbackT<std::uint32_t>&& error_callback) noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        if (m_error_callback.IsSet()) {
+            return false;
+        }
+        m_error_callback.Set([error_callback = std::move(error_callback)](std::uint32_t error_code) {
+            error_callback(error_code);
+        });
+        return true;
+    }
+
+    /**
+     * @brief Clear the callback set by SetErrorCallback().
+     */
+    void ClearErrorCallback() noexcept
+    {
+        m_error_callback.Clear();
+    }
+
+    /**
+     * @returns Directions of the non-blocking transfer running, read from the HAL state.
+     */
+    [[nodiscard]]
+    TransferDirection GetBusyDirection() const noexcept
+    {
+        if (m_handle.State == HAL_I2C_STATE_BUSY_TX) {
+            return TransferDirection::Transmit;
+        }
+        if (m_handle.State == HAL_I2C_STATE_BUSY_RX) {
+            return TransferDirection::Receive;
+        }
+        return TransferDirection::None;
+    }
+
+    /**
+     * @brief Abort the non-blocking transfer and clear the complete callbacks.
+     * 
+     * The transfer is stopped with HAL_DMA_Abort() on the DMA stream of the direction
+     * (WorkingMode::DMA) and a reset of the I2C peripheral with HAL_I2C_Init(), which
+     * also stops memory transfers and keeps the registered callbacks.
+     * 
+     * @param direction     Directions to abort, I2C runs one transfer so any direction aborts it.
+     * 
+     * @returns True on success, false otherwise.
+     */
+    bool AbortTransfer(TransferDirection direction) noexcept
+    {
+        if (direction == TransferDirection::None) {
+            return true;
+        }
+        bool is_aborted{true};
+        if constexpr (std::same_as<WorkingModeT, WorkingMode::DMA>) {
+            auto* dma = (direction == TransferDirection::Receive) ? m_handle.hdmarx : m_handle.hdmatx;
+            if (dma != nullptr && HAL_DMA_GetState(dma) == HAL_DMA_STATE_BUSY) {
+                is_aborted = (HAL_OK == HAL_DMA_Abort(dma));
+            }
+        }
+        is_aborted = (HAL_OK == HAL_I2C_Init(&m_handle)) && is_aborted;
+        m_master_transmit_complete_callback.Clear();
+        m_master_receive_complete_callback.Clear();
+        m_memory_transmit_complete_callback.Clear();
+        m_memory_receive_complete_callback.Clear();
+        return is_aborted;
+    }
+
+    /**
+     * @brief Run the completion and error callbacks from an event queue instead of interrupt context.
+     *
+     * @tparam PriorityV    Priority of the posted callbacks (default is EventPriority::Normal).
+     *
+     * @param queue         Event queue to post the callbacks to (see EventQueue).
+     *
+     * @note If the queue is full or STM32_CALLBACK_DEFER_CAPACITY replaced callbacks are pending,
+     *       a callback runs in interrupt context.
+     * @note An I2cTransactionQueue on this I2c then starts its next transaction from the queue.
+     */
+    template <EventPriority PriorityV = EventPriority::Normal, IsEventQueue QueueT>
+    void SetCompletionQueue(QueueT& queue) noexcept
+    {
+        m_master_transmit_complete_callback.Defer<PriorityV>(queue);
+        m_master_receive_complete_callback.Defer<PriorityV>(queue);
+        m_memory_transmit_complete_callback.Defer<PriorityV>(queue);
+        m_memory_receive_complete_callback.Defer<PriorityV>(queue);
+        m_error_callback.Defer<PriorityV>(queue);
+    }
+
+    /**
+     * @brief Run the completion and error callbacks in interrupt context again.
+     */
+    void ClearCompletionQueue() noexcept
+    {
+        m_master_transmit_complete_callback.ClearDefer();
+        m_master_receive_complete_callback.ClearDefer();
+        m_memory_transmit_complete_callback.ClearDefer();
+        m_memory_receive_complete_callback.ClearDefer();
+        m_error_callback.ClearDefer();
+    }
+
 private:
     I2C_HandleTypeDef& m_handle;
     MasterTransmitCompleteCallbackT m_master_transmit_complete_callback;
     MasterReceiveCompleteCallbackT m_master_receive_complete_callback;
     MemoryTransmitCompleteCallbackT m_memory_transmit_complete_callback;
     MemoryReceiveCompleteCallbackT m_memory_receive_complete_callback;
+    ErrorCallbackT m_error_callback;
+};
+
+/**
+ * @class I2cTransactionQueue, A bounded, allocation-free memory transaction queue for a non-blocking I2c.
+ * 
+ * Queues register/memory reads and writes to any number of devices on one bus.
+ * Each transaction is started directly from the MEM_RX/MEM_TX complete (or error)
+ * interrupt of the previous one, so the bus does not wait for the main loop
+ * between transfers. Buffers are never copied, each transfer runs in place.
+ * 
+ * @tparam I2cT         I2c type to operate on (WorkingMode::Interrupt or WorkingMode::DMA).
+ * @tparam CapacityT    Maximum number of queued transactions (default is 8).
+ * 
+ * @note I2cTransactionQueue class is non-copyable and non-movable.
+ * @note Queued buffers must stay valid until their completion callback is called.
+ * @note MemoryReadTo()/MemoryWrite() must be called from a single context: either the
+ *       main loop, or completion callbacks (e.g., to re-arm periodic polls), with lower
+ *       priority than the I2C interrupt.
+ * @note Do not call I2c memory operations in non-blocking mode directly while the
+ *       queue exists, the queue owns their completion callbacks.
+ * 
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/I2c.hpp>
+ *
+ * I2C_HandleTypeDef hi2c1; // Assume this is properly initialized elsewhere.
+ *
+ * using Mpu6050Address = STM32::I2cDeviceAddress<0x68>;
+ * using Bmp280Address = STM32::I2cDeviceAddress<0x76>;
+ * using AccelReg = STM32::I2cMemoryAddress<0x3B, STM32::I2cMemoryAddressSize::Bits8>;
+ * using PressureReg = STM32::I2cMemoryAddress<0xF7, STM32::I2cMemoryAddressSize::Bits8>;
+ *
+ * STM32::I2c<STM32::WorkingMode::DMA, STM32_UNIQUE_TAG> i2c{hi2c1};
+ * STM32::I2cTransactionQueue queue{i2c};
+ *
+ * std::array<std::uint8_t, 6> accel{};
+ * std::array<std::uint8_t, 6> pressure{};
+ *
+ * // Both reads run back-to-back, the second one is started from the first one's ISR
+ * queue.MemoryReadTo<Mpu6050Address, AccelReg>(accel, [](bool is_successful){ });
+ * queue.MemoryReadTo<Bmp280Address, PressureReg>(pressure, [](bool is_successful){ });
+ * @endcode
+ */
+template <IsI2c I2cT, IsI2cTransactionQueueCapacity CapacityT>
+class I2cTransactionQueue {
+    using WorkingModeT = typename I2cT::DefaultWorkingModeT;
+    static_assert(
+        !std::same_as<WorkingModeT, WorkingMode::Blocking>,
+        "I2cTransactionQueue requires an I2c in WorkingMode::Interrupt or WorkingMode::DMA"
+    );
+
+    /**
+     * @struct Transaction, Descriptor of a queued memory transaction.
+     */
+    struct Transaction {
+        std::uint8_t* data;
+        std::uint16_t size;
+        std::uint16_t device_address;
+        std::uint16_t memory_address;
+        std::uint16_t memory_address_size;
+        bool is_read;
+    };
+public:
+
+    /**
+     * @brief Construct I2cTransactionQueue class.
+     * 
+     * @param i2c       Reference to the I2c to operate on.
+     * 
+     * @note Takes over the memory and error callbacks of i2c.
+     */
+    explicit I2cTransactionQueue(I2cT& i2c) noexcept
+      : m_i2c{i2c}
+    {
+        m_i2c.m_memory_transmit_complete_callback.Set([this](){
+            OnTransactionComplete(true);
+        });
+        m_i2c.m_memory_receive_complete_callback.Set([this](){
+            OnTransactionComplete(true);
+        });
+        m_i2c.m_error_callback.Set([this]([[maybe_unused]] std::uint32_t error_code){
+            OnTransactionComplete(false);
+        });
+    }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    I2cTransactionQueue(const I2cTransactionQueue&) = delete;
+    I2cTransactionQueue& operator=(const I2cTransactionQueue&) = delete;
+    I2cTransactionQueue(I2cTransactionQueue&&) = delete;
+    I2cTransactionQueue& operator=(I2cTransactionQueue&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy I2cTransactionQueue class, aborts pending transactions.
+     * 
+     * @note Waits for the transaction in flight to complete if it cannot be stopped.
+     */
+    ~I2cTransactionQueue()
+    {
+        if (!Clear()) {
+            while (m_busy.load(std::memory_order_relaxed)) { }
+        }
+        m_i2c.m_memory_transmit_complete_callback.Clear();
+        m_i2c.m_memory_receive_complete_callback.Clear();
+        m_i2c.m_error_callback.Clear();
+    }
+
+    /**
+     * @returns Maximum number of queued transactions.
+     */
+    [[nodiscard]]
+    static constexpr std::size_t Capacity() noexcept
+    {
+        return CapacityT::value;
+    }
+
+    /**
+     * @returns Number of queued transactions, including the one in flight.
+     */
+    [[nodiscard]]
+    std::size_t Size() const noexcept
+    {
+        return m_entries.Size();
+    }
+
+    /**
+     * @returns True if no transaction is queued.
+     */
+    [[nodiscard]]
+    bool IsEmpty() const noexcept
+    {
+        return m_entries.IsEmpty();
+    }
+
+    /**
+     * @returns True if no more transactions can be queued.
+     */
+    [[nodiscard]]
+    bool IsFull() const noexcept
+    {
+        return m_entries.IsFull();
+    }
+
+    /**
+     * @brief Queue a read from a memory/register address on a slave device.
+     * 
+     * @tparam DeviceAddressT       I2C device address (must satisfy IsI2cDeviceAddress).
+     * @tparam MemoryAddressT       Memory/register address (must satisfy IsI2cMemoryAddress).
+     * 
+     * @param rx_message            A contiguous range to store the received data.
+     * @param complete_callback     Callback function to be called, in interrupt context,
+     *                              with the result of the transaction.
+     * 
+     * @returns True if the transaction is queued, false if the queue is full or
+     *          rx_message is empty.
+     * 
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     */
+    template <IsI2cDeviceAddress DeviceAddressT, IsI2cMemoryAddress MemoryAddressT>
+    bool MemoryReadTo(
+        IsI2cMessage auto& rx_message,
+        EventCallbackT<bool>&& complete_callback = [](bool){}
+    ) noexcept
+    {
+        return Enqueue<DeviceAddressT, MemoryAddressT>(
+            std::ranges::data(rx_message),
+            std::ranges::size(rx_message),
+            true,
+            std::move(complete_callback)
+        );
+    }
+
+    /**
+     * @brief Queue a write to a memory/register address on a slave device.
+     * 
+     * @tparam DeviceAddressT       I2C device address (must satisfy IsI2cDeviceAddress).
+     * @tparam MemoryAddressT       Memory/register address (must satisfy IsI2cMemoryAddress).
+     * 
+     * @param tx_message            A contiguous range containing the data to write.
+     * @param complete_callback     Callback function to be called, in interrupt context,
+     *                              with the result of the transaction.
+     * 
+     * @returns True if the transaction is queued, false if the queue is full or
+     *          tx_message is empty.
+     * 
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     */
+    template <IsI2cDeviceAddress DeviceAddressT, IsI2cMemoryAddress MemoryAddressT>
+    bool MemoryWrite(
+        const IsI2cMessage auto& tx_message,
+        EventCallbackT<bool>&& complete_callback = [](bool){}
+    ) noexcept
+    {
+        return Enqueue<DeviceAddressT, MemoryAddressT>(
+            const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
+            std::ranges::size(tx_message),
+            false,
+            std::move(complete_callback)
+        );
+    }
+
+    /**
+     * @brief Abort the transaction in flight and drop all queued transactions.
+     * 
+     * The transaction in flight is stopped with HAL_DMA_Abort() on its DMA stream
+     * (WorkingMode::DMA) and a reset of the I2C peripheral with HAL_I2C_Init(), which
+     * also stops memory transfers (HAL_I2C_Master_Abort_IT() rejects them on most families)
+     * and keeps the registered callbacks. The completion callback of every dropped
+     * transaction is called with false.
+     * 
+     * @returns True if the bus is idle, false if the transaction in flight could not be
+     *          stopped. It then completes through its own callback, the transactions
+     *          queued behind it are dropped when it completes.
+     */
+    bool Clear() noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        if (m_busy.load(std::memory_order_relaxed)) {
+            if (!Abort(m_entries.Front())) {
+                m_drop_count = m_entries.Size() - 1;
+                return false;
+            }
+            m_busy.store(false, std::memory_order_relaxed);
+        }
+        while (!IsEmpty()) {
+            Release(false);
+        }
+        return true;
+    }
+
+private:
+    I2cT& m_i2c;
+    __Internal::__RingBuffer<Transaction, CapacityT::value> m_entries{};
+    std::array<EventCallbackT<bool>, CapacityT::value> m_callbacks{};
+    std::size_t m_write_index{};
+    std::size_t m_read_index{};
+    std::atomic<bool> m_busy{};
+    std::size_t m_drop_count{};
+
+    static constexpr std::size_t s_index_mask{CapacityT::value - 1};
+
+    /**
+     * @brief Append a transaction and start it if the bus is idle.
+     * 
+     * @returns True if the transaction is queued, false otherwise.
+     */
+    template <IsI2cDeviceAddress DeviceAddressT, IsI2cMemoryAddress MemoryAddressT>
+    bool Enqueue(
+        std::uint8_t* data,
+        std::size_t size,
+        bool is_read,
+        EventCallbackT<bool>&& complete_callback
+    ) noexcept
+    {
+        const Transaction transaction{
+            data,
+            __Internal::__ClampMessageLength<std::uint16_t>(size),
+            DeviceAddressT::value,
+            MemoryAddressT::address,
+            static_cast<std::uint16_t>(std::to_underlying(MemoryAddressT::address_size)),
+            is_read
+        };
+        if (transaction.size == 0 || IsFull()) {
+            return false;
+        }
+        m_callbacks[m_write_index++ & s_index_mask] = std::move(complete_callback);
+        m_entries.Push(transaction);
+        __Internal::__CriticalSection critical_section{};
+        if (!m_busy.load(std::memory_order_relaxed)) {
+            StartNext();
+        }
+        return true;
+    }
+
+    /**
+     * @brief Start the oldest queued transaction, completing the ones that fail to start.
+     */
+    void StartNext() noexcept
+    {
+        while (!IsEmpty()) {
+            if (Start(m_entries.Front())) {
+                m_busy.store(true, std::memory_order_relaxed);
+                return;
+            }
+            Release(false);
+        }
+        m_busy.store(false, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Start a memory transaction on the bus.
+     * 
+     * @returns True on success, false otherwise.
+     */
+    bool Start(const Transaction& transaction) noexcept
+    {
+        using __Internal::__Measure;
+        constexpr auto on_complete = __Internal::__ProbeBytes::OnComplete;
+        auto& handle = m_i2c.GetHandle();
+        const auto& [data, size, device_address, memory_address, memory_address_size, is_read] = transaction;
+        if constexpr (std::same_as<WorkingModeT, WorkingMode::Interrupt>) {
+            return is_read ?
+                __Measure<InstrumentationProbe::I2cMemoryRead, on_complete>(
+                    handle, size, HAL_I2C_Mem_Read_IT,
+                    device_address, memory_address, memory_address_size, data, size
+                ) :
+                __Measure<InstrumentationProbe::I2cMemoryWrite, on_complete>(
+                    handle, size, HAL_I2C_Mem_Write_IT,
+                    device_address, memory_address, memory_address_size, data, size
+                );
+        } else if constexpr (std::same_as<WorkingModeT, WorkingMode::DMA>) {
+            return is_read ?
+                __Measure<InstrumentationProbe::I2cMemoryRead, on_complete>(
+                    handle, size, HAL_I2C_Mem_Read_DMA,
+                    device_address, memory_address, memory_address_size, data, size
+                ) :
+                __Measure<InstrumentationProbe::I2cMemoryWrite, on_complete>(
+                    handle, size, HAL_I2C_Mem_Write_DMA,
+                    device_address, memory_address, memory_address_size, data, size
+                );
+        }
+    }
+
+    /**
+     * @brief Stop the transaction in flight.
+     * 
+     * @param transaction   Transaction in flight.
+     * 
+     * @returns True on success, false otherwise.
+     */
+    bool Abort(const Transaction& transaction) noexcept
+    {
+        auto& handle = m_i2c.GetHandle();
+        if constexpr (std::same_as<WorkingModeT, WorkingMode::DMA>) {
+            auto* dma = transaction.is_read ? handle.hdmarx : handle.hdmatx;
+            if (dma != nullptr && HAL_DMA_GetState(dma) == HAL_DMA_STATE_BUSY && HAL_DMA_Abort(dma) != HAL_OK) {
+                return false;
+            }
+        }
+        return (HAL_OK == HAL_I2C_Init(&handle));
+    }
+
+    /**
+     * @brief Pop the oldest transaction and report its result.
+     * 
+     * @param is_successful     Whether the transaction completed without error.
+     */
+    void Release(bool is_successful) noexcept
+    {
+        auto callback = std::move(m_callbacks[m_read_index++ & s_index_mask]);
+        m_entries.CommitRead(1);
+        callback(is_successful);
+    }
+
+    /**
+     * @brief MEM_RX/MEM_TX complete and error handler, chains the next transaction from interrupt context.
+     * 
+     * @param is_successful     Whether the transaction completed without error.
+     */
+    void OnTransactionComplete(bool is_successful) noexcept
+    {
+        if (!m_busy.load(std::memory_order_relaxed)) {
+            return;
+        }
+        auto callback = std::move(m_callbacks[m_read_index++ & s_index_mask]);
+        m_entries.CommitRead(1);
+        for (; m_drop_count != 0; --m_drop_count) {
+            Release(false);
+        }
+        StartNext();
+        callback(is_successful);
+    }
 };
 
 } /* namespace STM32 */
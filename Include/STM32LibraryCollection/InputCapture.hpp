@@ -0,0 +1,418 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_INPUT_CAPTURE_HPP
+#define STM32_INPUT_CAPTURE_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+#include "Timer.hpp"
+#include "__Internal/__Utility.hpp"
+
+#include "main.h"
+
+#if !defined(HAL_TIM_MODULE_ENABLED) /* module check */
+#error "HAL TIM module is not enabled!"
+#endif /* module check */
+
+#if !defined(HAL_DMA_MODULE_ENABLED) /* module check */
+#error "HAL DMA module is not enabled!"
+#endif /* module check */
+
+#if (USE_HAL_TIM_REGISTER_CALLBACKS != 1) /* module check */
+#error "HAL TIM callbacks are not enabled!"
+#endif /* module check */
+
+namespace STM32 {
+
+/**
+ * @struct InputCaptureLength, A utility struct to configure the number of captured timestamps.
+ *
+ * @tparam LengthV  Number of timestamps in the circular DMA buffer (2 to 65535).
+ *
+ * Longer buffers allow averaging over more periods (see InputCapture::GetFrequency()).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * using SixtyFourEdges = STM32::InputCaptureLength<64>;
+ * @endcode
+ */
+template <std::size_t LengthV>
+struct InputCaptureLength : __Internal::__Constant<std::size_t, LengthV> {};
+
+/**
+ * @brief IsInputCaptureLength, A concept to check if a type is a valid InputCaptureLength.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/InputCapture.hpp>
+ *
+ * static_assert(STM32::IsInputCaptureLength<STM32::InputCaptureLength<64>>);
+ * static_assert(!STM32::IsInputCaptureLength<STM32::InputCaptureLength<1>>);
+ * static_assert(!STM32::IsInputCaptureLength<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsInputCaptureLength =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t> &&
+    (2 <= T::value && T::value <= 65'535);
+
+/**
+ * @class InputCapture, A class to timestamp edges of a signal with timer input capture and circular DMA.
+ *
+ * The timer latches its counter into the capture register on each selected edge,
+ * and DMA copies every capture into an internal ring of timestamps. No CPU work is
+ * done per edge, only once per ring lap. Period and frequency are computed from
+ * the newest timestamps on request, the frequency optionally averaged over many
+ * periods for a resolution finer than one timer tick.
+ *
+ * @tparam InputCaptureLengthT  Number of timestamps in the ring (see InputCaptureLength).
+ * @tparam UniqueTagT           Unique tag type to differentiate multiple InputCapture instances.
+ *                              UniqueTagT must be STM32_UNIQUE_TAG.
+ *
+ * @note InputCapture class is non-copyable and non-movable.
+ * @note Required timer configuration: the channel in input capture direct mode with
+ *       the wanted edge polarity, its DMA request in circular mode with word data width.
+ * @note One InputCapture per timer, the HAL capture callback is shared by all channels.
+ * @note Each period must be shorter than one timer period (ARR + 1 ticks).
+ * @note When the signal stops, the last measured values are held.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/InputCapture.hpp>
+ *
+ * TIM_HandleTypeDef htim2; // 1 MHz counter, channel 1 capturing rising edges with circular DMA
+ *
+ * STM32::Timer timer{htim2};
+ * STM32::InputCapture<STM32::InputCaptureLength<64>, STM32_UNIQUE_TAG> tachometer{timer, TIM_CHANNEL_1, 1'000'000};
+ *
+ * tachometer.Start();
+ *
+ * auto period = tachometer.GetPeriod();            // Ticks of the newest period
+ * auto frequency = tachometer.GetFrequency(16);    // Hz, averaged over the last 16 periods
+ * @endcode
+ */
+template <IsInputCaptureLength InputCaptureLengthT, __Internal::__IsUniqueTag UniqueTagT>
+class InputCapture {
+    using CaptureCallbackT = __Internal::__CallbackManager<
+        TIM_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_TIM_RegisterCallback, HAL_TIM_UnRegisterCallback, HAL_TIM_IC_CAPTURE_CB_ID
+    >;
+
+    static constexpr std::size_t s_length{InputCaptureLengthT::value};
+public:
+
+    /**
+     * @brief Construct InputCapture class.
+     *
+     * @param timer             Free-running timer, shared with other users that only read it.
+     * @param channel           Input capture channel (TIM_CHANNEL_1 ... TIM_CHANNEL_4).
+     * @param tick_frequency    Timer counter frequency in Hz (timer clock divided by the prescaler).
+     *
+     * @note HAL callbacks are automatically registered via RAII.
+     */
+    InputCapture(Timer& timer, std::uint32_t channel, std::uint32_t tick_frequency) noexcept
+      : m_timer{timer},
+        m_channel{channel},
+        m_channel_shift{channel / TIM_CHANNEL_2},
+        m_tick_frequency{tick_frequency},
+        m_capture_callback{timer.GetHandle()}
+    { }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    InputCapture(const InputCapture&) = delete;
+    InputCapture& operator=(const InputCapture&) = delete;
+    InputCapture(InputCapture&&) = delete;
+    InputCapture& operator=(InputCapture&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy InputCapture class, stops capturing.
+     *
+     * @note Callbacks are automatically unregistered via RAII.
+     */
+    ~InputCapture()
+    {
+        Stop();
+    }
+
+    /**
+     * @brief Start capturing, previous timestamps are discarded.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Start() noexcept
+    {
+        m_is_wrapped.store(false, std::memory_order_relaxed);
+        m_capture_callback.Set([this](){
+            if (m_timer.GetHandle().Channel == (HAL_TIM_ACTIVE_CHANNEL_1 << m_channel_shift)) {
+                m_is_wrapped.store(true, std::memory_order_relaxed);
+            }
+        });
+        return (HAL_OK == HAL_TIM_IC_Start_DMA(
+            &m_timer.GetHandle(),
+            m_channel,
+            m_buffer.data(),
+            static_cast<std::uint16_t>(s_length)
+        ));
+    }
+
+    /**
+     * @brief Stop capturing.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Stop() noexcept
+    {
+        m_capture_callback.Clear();
+        return (HAL_OK == HAL_TIM_IC_Stop_DMA(&m_timer.GetHandle(), m_channel));
+    }
+
+    /**
+     * @returns Number of timer ticks of the newest period, std::nullopt before the second edge.
+     */
+    [[nodiscard]]
+    std::optional<std::uint32_t> GetPeriod() const noexcept
+    {
+        const auto newest = Newest();
+        if (!newest) {
+            return std::nullopt;
+        }
+        const auto period = Elapsed(m_buffer[Previous(newest->index)], m_buffer[newest->index]);
+        if (period == 0) {
+            return std::nullopt;
+        }
+        return period;
+    }
+
+    /**
+     * @brief Get the signal frequency, averaged over the newest periods.
+     *
+     * @param periods   Number of periods to average (default is 1), clamped to the
+     *                  captured periods and to half the ring length.
+     *
+     * @returns Frequency in Hz, std::nullopt before the second edge.
+     *
+     * @note Averaging N periods improves the resolution N times, at most one
+     *       timer tick over the averaged span.
+     */
+    [[nodiscard]]
+    std::optional<double> GetFrequency(std::size_t periods = 1) const noexcept
+    {
+        const auto newest = Newest();
+        if (!newest) {
+            return std::nullopt;
+        }
+        periods = std::clamp<std::size_t>(periods, 1, std::min(newest->periods, s_length / 2));
+        std::uint64_t ticks{};
+        for (std::size_t period{}, index{newest->index}; period < periods; ++period) {
+            const auto previous = Previous(index);
+            ticks += Elapsed(m_buffer[previous], m_buffer[index]);
+            index = previous;
+        }
+        if (ticks == 0) {
+            return std::nullopt;
+        }
+        return static_cast<double>(m_tick_frequency) * static_cast<double>(periods) / static_cast<double>(ticks);
+    }
+
+private:
+    /**
+     * @struct NewestCapture, Position of the newest timestamp and the number of periods before it.
+     */
+    struct NewestCapture {
+        std::size_t index;
+        std::size_t periods;
+    };
+
+    Timer& m_timer;
+    const std::uint32_t m_channel;
+    const std::uint32_t m_channel_shift;
+    const std::uint32_t m_tick_frequency;
+    CaptureCallbackT m_capture_callback;
+    std::atomic<bool> m_is_wrapped{};
+    std::array<std::uint32_t, s_length> m_buffer{};
+
+    /**
+     * @returns Newest timestamp, std::nullopt before the second edge.
+     */
+    std::optional<NewestCapture> Newest() const noexcept
+    {
+        auto* dma = m_timer.GetHandle().hdma[TIM_DMA_ID_CC1 + m_channel_shift];
+        const std::size_t written{s_length - __HAL_DMA_GET_COUNTER(dma)};
+        const bool is_wrapped{m_is_wrapped.load(std::memory_order_relaxed)};
+        const std::size_t count{is_wrapped ? s_length : written};
+        if (count < 2) {
+            return std::nullopt;
+        }
+        return NewestCapture{Previous(written % s_length), count - 1};
+    }
+
+    /**
+     * @returns Ring index before index.
+     */
+    static constexpr std::size_t Previous(std::size_t index) noexcept
+    {
+        return (index == 0) ? s_length - 1 : index - 1;
+    }
+
+    /**
+     * @returns Timer ticks from one timestamp to a later one, across one counter wraparound.
+     */
+    std::uint32_t Elapsed(std::uint32_t from, std::uint32_t to) const noexcept
+    {
+        if (to >= from) {
+            return to - from;
+        }
+        return (__HAL_TIM_GET_AUTORELOAD(&m_timer.GetHandle()) - from) + to + 1U;
+    }
+};
+
+/**
+ * @class PwmInput, A class to measure period and duty cycle of a PWM signal in hardware.
+ *
+ * Uses the timer PWM input mode: one input drives two capture channels, the
+ * period channel captures the active edge and resets the counter (slave reset
+ * mode), the pulse channel captures the opposite edge. Period and pulse width
+ * are therefore always available in the capture registers without any CPU work.
+ *
+ * @note PwmInput class is non-copyable and non-movable.
+ * @note Required timer configuration (CubeMX "PWM Input" combined channels):
+ *       slave mode Reset with trigger TI1FP1 (or TI2FP2), the period channel
+ *       direct on the active edge, the pulse channel indirect on the opposite edge.
+ * @note Each period must be shorter than one timer period (ARR + 1 ticks).
+ * @note When the signal stops, the last measured values are held.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/InputCapture.hpp>
+ *
+ * TIM_HandleTypeDef htim3; // 1 MHz counter, PWM input on channel 1
+ *
+ * STM32::PwmInput pwm_input{htim3, 1'000'000};
+ *
+ * auto frequency = pwm_input.GetFrequency();   // Hz
+ * auto duty = pwm_input.GetDutyCycle();        // Percent
+ * @endcode
+ */
+class PwmInput {
+public:
+
+    /**
+     * @brief Construct PwmInput class, starts capturing.
+     *
+     * @param handle            Reference to the TIM handle.
+     * @param tick_frequency    Timer counter frequency in Hz (timer clock divided by the prescaler).
+     * @param period_channel    Direct channel capturing the period (default is TIM_CHANNEL_1).
+     * @param pulse_channel     Indirect channel capturing the pulse width (default is TIM_CHANNEL_2).
+     */
+    PwmInput(
+        TIM_HandleTypeDef& handle,
+        std::uint32_t tick_frequency,
+        std::uint32_t period_channel = TIM_CHANNEL_1,
+        std::uint32_t pulse_channel = TIM_CHANNEL_2
+    ) noexcept
+      : m_handle{handle},
+        m_tick_frequency{tick_frequency},
+        m_period_channel{period_channel},
+        m_pulse_channel{pulse_channel}
+    {
+        HAL_TIM_IC_Start(&m_handle, m_pulse_channel);
+        HAL_TIM_IC_Start(&m_handle, m_period_channel);
+    }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    PwmInput(const PwmInput&) = delete;
+    PwmInput& operator=(const PwmInput&) = delete;
+    PwmInput(PwmInput&&) = delete;
+    PwmInput& operator=(PwmInput&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy PwmInput class, stops capturing.
+     */
+    ~PwmInput()
+    {
+        HAL_TIM_IC_Stop(&m_handle, m_period_channel);
+        HAL_TIM_IC_Stop(&m_handle, m_pulse_channel);
+    }
+
+    /**
+     * @returns TIM handle reference.
+     */
+    [[nodiscard]]
+    auto&& GetHandle(this auto&& self) noexcept
+    {
+        return std::forward<decltype(self)>(self).m_handle;
+    }
+
+    /**
+     * @returns Number of timer ticks of the last period, 0 before the first period.
+     */
+    [[nodiscard]]
+    std::uint32_t GetPeriod() const noexcept
+    {
+        return HAL_TIM_ReadCapturedValue(&m_handle, m_period_channel);
+    }
+
+    /**
+     * @returns Number of timer ticks of the last pulse.
+     */
+    [[nodiscard]]
+    std::uint32_t GetPulseWidth() const noexcept
+    {
+        return HAL_TIM_ReadCapturedValue(&m_handle, m_pulse_channel);
+    }
+
+    /**
+     * @returns Signal frequency in Hz, std::nullopt before the first period.
+     */
+    [[nodiscard]]
+    std::optional<double> GetFrequency() const noexcept
+    {
+        const auto period = GetPeriod();
+        if (period == 0) {
+            return std::nullopt;
+        }
+        return static_cast<double>(m_tick_frequency) / static_cast<double>(period);
+    }
+
+    /**
+     * @returns Duty cycle in percent (0.0-100.0), std::nullopt before the first period.
+     */
+    [[nodiscard]]
+    std::optional<double> GetDutyCycle() const noexcept
+    {
+        const auto period = GetPeriod();
+        if (period == 0) {
+            return std::nullopt;
+        }
+        return std::min(100., 100. * static_cast<double>(GetPulseWidth()) / static_cast<double>(period));
+    }
+
+private:
+    TIM_HandleTypeDef& m_handle;
+    const std::uint32_t m_tick_frequency;
+    const std::uint32_t m_period_channel;
+    const std::uint32_t m_pulse_channel;
+};
+
+} /* namespace STM32 */
+
+#endif /* STM32_INPUT_CAPTURE_HPP */
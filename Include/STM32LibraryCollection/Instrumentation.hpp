@@ -0,0 +1,206 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_INSTRUMENTATION_HPP
+#define STM32_INSTRUMENTATION_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "__Internal/__Utility.hpp"
+
+#include "main.h"
+
+namespace STM32 {
+
+/**
+ * @class Instrumentation, Access to the DWT cycle counter statistics of peripheral operations.
+ *
+ * With STM32_INSTRUMENTATION defined as 1, Uart, Spi and I2c transfers, Adc
+ * conversions and the interrupt dispatch of peripheral callbacks are measured
+ * with the DWT cycle counter. Each peripheral handle keeps, per InstrumentationProbe,
+ * a logarithmic latency histogram, its maximum (the longest ISR dwell time for
+ * CallbackDispatch), the bytes transferred and the HAL_BUSY and error counts in
+ * one of STM32_INSTRUMENTATION_ENTRIES static entries.
+ *
+ * With STM32_INSTRUMENTATION disabled (the default) nothing is measured or stored,
+ * Get() returns zeroed statistics and Dump() reports nothing.
+ *
+ * @note Interrupt and DMA transfers are measured until the transfer is started,
+ *       their bytes are counted when the completion callback is dispatched.
+ * @note Latencies are measured in core clock cycles, only operations shorter
+ *       than 2^32 cycles are measured correctly.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #define STM32_INSTRUMENTATION 1      // Before any library include, e.g., as a compiler definition
+ * #include <STM32LibraryCollection/Instrumentation.hpp>
+ *
+ * STM32::Instrumentation::Enable();    // Start the DWT cycle counter once at startup
+ *
+ * STM32::Instrumentation::Dump([](std::string_view name, const void* handle, const STM32::InstrumentationStats& stats){
+ *     std::printf("%.*s %p: %lu ops, max %lu cycles, %lu busy, %lu errors\n",
+ *         static_cast<int>(name.size()), name.data(), handle,
+ *         stats.count, stats.max_cycles, stats.busy_count, stats.error_count);
+ * });
+ * auto uart1_stats = STM32::Instrumentation::Get(STM32::InstrumentationProbe::UartTransmit, &huart1);
+ * STM32::Instrumentation::Reset();
+ * @endcode
+ */
+class Instrumentation {
+public:
+
+    /**
+     * @brief Instrumentation class has static members only.
+     */
+    Instrumentation() = delete;
+
+    /**
+     * @returns True if STM32_INSTRUMENTATION is enabled.
+     */
+    [[nodiscard]]
+    static constexpr bool IsEnabled() noexcept
+    {
+        return STM32_INSTRUMENTATION != 0;
+    }
+
+    /**
+     * @brief Enable the DWT cycle counter, call once before the first measurement.
+     *
+     * @note Debuggers may also use the cycle counter, it is not reset here.
+     */
+    static void Enable() noexcept
+    {
+#if STM32_INSTRUMENTATION
+        CoreDebug->DEMCR = CoreDebug->DEMCR | CoreDebug_DEMCR_TRCENA_Msk;
+        DWT->CTRL = DWT->CTRL | DWT_CTRL_CYCCNTENA_Msk;
+#endif
+    }
+
+    /**
+     * @brief Zero the statistics of all probes.
+     */
+    static void Reset() noexcept
+    {
+#if STM32_INSTRUMENTATION
+        __Internal::__CriticalSection critical_section{};
+        __Internal::__instrumentation_entries = {};
+        __Internal::__instrumentation_entry_count = 0;
+        __Internal::__instrumentation_dropped = 0;
+#endif
+    }
+
+    /**
+     * @returns Snapshot of the statistics of a probe of one peripheral handle.
+     *
+     * @param probe     Instrumented operation.
+     * @param handle    Peripheral handle (e.g., &huart1).
+     */
+    [[nodiscard]]
+    static InstrumentationStats Get(
+        [[maybe_unused]] InstrumentationProbe probe,
+        [[maybe_unused]] const void* handle
+    ) noexcept
+    {
+#if STM32_INSTRUMENTATION
+        __Internal::__CriticalSection critical_section{};
+        for (std::size_t index = 0; index < __Internal::__instrumentation_entry_count; ++index) {
+            const auto& entry = __Internal::__instrumentation_entries[index];
+            if (entry.handle == handle && entry.probe == probe) {
+                return entry.stats;
+            }
+        }
+#endif
+        return {};
+    }
+
+    /**
+     * @returns Statistics of a probe summed over all peripheral handles.
+     *
+     * @param probe     Instrumented operation.
+     */
+    [[nodiscard]]
+    static InstrumentationStats Get([[maybe_unused]] InstrumentationProbe probe) noexcept
+    {
+        InstrumentationStats total{};
+#if STM32_INSTRUMENTATION
+        __Internal::__CriticalSection critical_section{};
+        for (std::size_t index = 0; index < __Internal::__instrumentation_entry_count; ++index) {
+            const auto& stats = __Internal::__instrumentation_entries[index].stats;
+            if (__Internal::__instrumentation_entries[index].probe != probe) {
+                continue;
+            }
+            for (std::size_t bucket = 0; bucket < total.histogram.size(); ++bucket) {
+                total.histogram[bucket] += stats.histogram[bucket];
+            }
+            total.bytes += stats.bytes;
+            total.count += stats.count;
+            total.busy_count += stats.busy_count;
+            total.error_count += stats.error_count;
+            total.max_cycles = std::max(total.max_cycles, stats.max_cycles);
+        }
+#endif
+        return total;
+    }
+
+    /**
+     * @returns Number of operations not recorded because all STM32_INSTRUMENTATION_ENTRIES entries are in use.
+     */
+    [[nodiscard]]
+    static std::uint32_t Dropped() noexcept
+    {
+#if STM32_INSTRUMENTATION
+        __Internal::__CriticalSection critical_section{};
+        return __Internal::__instrumentation_dropped;
+#else
+        return 0;
+#endif
+    }
+
+    /**
+     * @returns Name of a probe (e.g., "UartTransmit").
+     *
+     * @param probe     Instrumented operation.
+     */
+    [[nodiscard]]
+    static constexpr std::string_view Name(InstrumentationProbe probe) noexcept
+    {
+        return __Internal::__instrumentation_probe_names[static_cast<std::size_t>(probe)];
+    }
+
+    /**
+     * @brief Report the statistics of every peripheral handle and probe with at least one operation.
+     *
+     * @param sink      Callable taking the probe name, the peripheral handle and a statistics snapshot.
+     *
+     * @note Entries are reported in order of first use, snapshots are taken one entry at a time
+     *       and sink is called outside critical sections.
+     */
+    static void Dump(
+        [[maybe_unused]] std::invocable<std::string_view, const void*, const InstrumentationStats&> auto&& sink
+    )
+    {
+#if STM32_INSTRUMENTATION
+        for (std::size_t index = 0; ; ++index) {
+            __Internal::__InstrumentationEntry entry;
+            {
+                __Internal::__CriticalSection critical_section{};
+                if (index >= __Internal::__instrumentation_entry_count) {
+                    return;
+                }
+                entry = __Internal::__instrumentation_entries[index];
+            }
+            if (entry.stats.count != 0) {
+                sink(Name(entry.probe), entry.handle, entry.stats);
+            }
+        }
+#endif
+    }
+};
+
+} /* namespace STM32 */
+
+#endif /* STM32_INSTRUMENTATION_HPP */
@@ -4,8 +4,17 @@
 #ifndef STM32_L298N_HPP
 #define STM32_L298N_HPP
 
-#include <Gpio.hpp>
-#include <Timer.hpp>
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <optional>
+#include <utility>
+
+#include "Gpio.hpp"
+#include "Pwm.hpp"
+#include "Timer.hpp"
+#include "TimerScheduler.hpp"
+#include "__Internal/__Utility.hpp"
 
 namespace STM32 {
 
@@ -72,6 +81,457 @@ private:
 	Timer* m_us_timer;
 };
 
+/**
+ * @enum L298nDirection, Rotation direction of a L298nMotor.
+ */
+enum class L298nDirection : std::uint8_t {
+    Forward,
+    Backward
+};
+
+/**
+ * @struct L298nRamp, A utility struct to hold the acceleration ramp of a L298nMotor.
+ *
+ * @tparam StepV        Speed change per ramp step, in Pwm input units (must be greater than zero).
+ * @tparam IntervalV    Time between ramp steps, in scheduler ticks (must be greater than zero).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/L298n.hpp>
+ *
+ * using SoftStart = STM32::L298nRamp<5, 10'000>; // 5 units every 10 ms with a 1 MHz scheduler
+ * @endcode
+ */
+template <std::uint32_t StepV, std::uint32_t IntervalV>
+struct L298nRamp {
+    static constexpr std::uint32_t step{StepV};
+    static constexpr std::uint32_t interval{IntervalV};
+};
+
+/**
+ * @brief IsL298nRamp, A concept to check if a type is a valid L298nRamp.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/L298n.hpp>
+ *
+ * static_assert(STM32::IsL298nRamp<STM32::L298nRamp<5, 10'000>>);
+ * static_assert(!STM32::IsL298nRamp<STM32::L298nRamp<0, 10'000>>);
+ * static_assert(!STM32::IsL298nRamp<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsL298nRamp =
+    requires {
+        { T::step } -> std::convertible_to<std::uint32_t>;
+        { T::interval } -> std::convertible_to<std::uint32_t>;
+    } &&
+    T::step > 0 && T::interval > 0;
+
+/**
+ * @class L298nMotor, A non-blocking, speed-controlled DC motor on one L298N bridge.
+ *
+ * The direction is set by the IN pins and the speed by a Pwm on the EN pin.
+ * Speed changes are ramped by RampT from periodic TimerScheduler events, and a
+ * direction change first ramps down to zero, so the bridge is never reversed under
+ * load. Timed moves and ramped stops complete from the scheduler as well, nothing
+ * blocks the caller and any number of motors can run concurrently.
+ *
+ * Stop() decelerates along the ramp and then short brakes the motor (both IN pins
+ * high with EN fully on), which holds it at standstill. Brake() and Coast() stop
+ * immediately, see also L298nBrake() to brake several motors at once.
+ *
+ * @tparam PwmConfigT   Pwm configuration of the EN pin, speeds are Pwm input values.
+ * @tparam SchedulerT   TimerScheduler type providing the ramp and timed move events.
+ * @tparam RampT        Acceleration ramp (default is L298nRamp<1, 1'000>).
+ *
+ * @note L298nMotor class is non-copyable and non-movable.
+ * @note The minimum of the Pwm input range is standstill.
+ * @note The ramp uses one periodic scheduler event while the speed changes,
+ *       and a timed move one more event until it starts decelerating.
+ * @note Callbacks run in interrupt context of the scheduler.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/L298n.hpp>
+ *
+ * TIM_HandleTypeDef htim2; // 1 MHz, channel 1 in output compare timing mode
+ * TIM_HandleTypeDef htim3; // PWM on channel 1 (ENA) and channel 2 (ENB)
+ *
+ * using MotorPwmConfig = STM32::PwmConfig<
+ *     STM32::PwmDutyCycleRange<0.0, 100.0>,
+ *     STM32::PwmInputRange<0, 100, 0>,
+ *     STM32::PwmInputRangeMax<0, 100>
+ * >;
+ *
+ * STM32::Timer timer{htim2};
+ * STM32::TimerScheduler<STM32::TimerSchedulerCapacity<8>, STM32_UNIQUE_TAG> scheduler{timer, TIM_CHANNEL_1};
+ *
+ * STM32::GpioOutput in1{GPIOB, GPIO_PIN_0};
+ * STM32::GpioOutput in2{GPIOB, GPIO_PIN_1};
+ * STM32::Pwm<MotorPwmConfig> ena{htim3, TIM_CHANNEL_1};
+ *
+ * STM32::L298nMotor<MotorPwmConfig, decltype(scheduler), STM32::L298nRamp<5, 10'000>> left{
+ *     in1, in2, ena, scheduler
+ * };
+ *
+ * left.Run(STM32::L298nDirection::Forward, 80);    // Ramps up to 80% in 160 ms, returns immediately
+ * left.RunFor(STM32::L298nDirection::Backward, 50, 2'000'000, [](){
+ *     // Ramped down and braked after 2 s, called from interrupt context
+ * });
+ * @endcode
+ */
+template <
+    IsPwmConfig PwmConfigT,
+    IsTimerScheduler SchedulerT,
+    IsL298nRamp RampT = L298nRamp<1, 1'000>
+>
+class L298nMotor {
+    static constexpr std::uint32_t s_min_speed{PwmConfigT::InputRangeT::min_value};
+    static constexpr std::uint32_t s_max_speed{PwmConfigT::InputRangeT::max_value};
+public:
+
+    /**
+     * @brief Construct L298nMotor class, the motor starts coasting.
+     *
+     * @param forward_pin   Output connected to IN1 (IN3) of the bridge.
+     * @param backward_pin  Output connected to IN2 (IN4) of the bridge.
+     * @param enable_pwm    Pwm connected to ENA (ENB) of the bridge.
+     * @param scheduler     Scheduler driving the ramp and timed moves.
+     */
+    L298nMotor(
+        GpioOutput& forward_pin,
+        GpioOutput& backward_pin,
+        Pwm<PwmConfigT>& enable_pwm,
+        SchedulerT& scheduler) noexcept
+      : m_forward_pin{forward_pin},
+        m_backward_pin{backward_pin},
+        m_enable_pwm{enable_pwm},
+        m_scheduler{scheduler}
+    {
+        Coast();
+    }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    L298nMotor(const L298nMotor&) = delete;
+    L298nMotor& operator=(const L298nMotor&) = delete;
+    L298nMotor(L298nMotor&&) = delete;
+    L298nMotor& operator=(L298nMotor&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy L298nMotor class, cancels pending events and coasts the motor.
+     */
+    ~L298nMotor()
+    {
+        Coast();
+    }
+
+    /**
+     * @returns Current direction, the target direction is applied once the speed ramped down to zero.
+     */
+    [[nodiscard]]
+    L298nDirection GetDirection() const noexcept
+    {
+        return m_direction;
+    }
+
+    /**
+     * @returns Current (ramped) speed in Pwm input units.
+     */
+    [[nodiscard]]
+    std::uint32_t GetSpeed() const noexcept
+    {
+        return m_speed;
+    }
+
+    /**
+     * @returns True if the speed is above standstill or still ramping.
+     */
+    [[nodiscard]]
+    bool IsMoving() const noexcept
+    {
+        return m_speed != s_min_speed || m_ramp_event.has_value();
+    }
+
+    /**
+     * @brief Ramp to a direction and speed and keep running.
+     *
+     * @param direction     Rotation direction.
+     * @param speed         Target speed in Pwm input units, clamped to the input range.
+     *
+     * @note Cancels a pending timed move or stop, its callback is not called.
+     * @note If the scheduler is full, the target is applied without ramping.
+     */
+    void Run(L298nDirection direction, std::uint32_t speed) noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        CancelStop();
+        SetTarget(direction, speed);
+    }
+
+    /**
+     * @brief Ramp to a direction and speed, then stop with Stop() after a duration.
+     *
+     * @param direction     Rotation direction.
+     * @param speed         Target speed in Pwm input units, clamped to the input range.
+     * @param duration      Scheduler ticks from now until the motor starts decelerating.
+     * @param callback      Callback function to be called, in interrupt context, once the motor is braked.
+     *
+     * @returns False if the scheduler is full, the motor then runs until stopped.
+     *
+     * @note Cancels a pending timed move or stop, its callback is not called.
+     */
+    bool RunFor(
+        L298nDirection direction,
+        std::uint32_t speed,
+        std::uint32_t duration,
+        CallbackT&& callback = nullptr) noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        CancelStop();
+        SetTarget(direction, speed);
+        m_stop_event = m_scheduler.CallAfter(duration, [this](){
+            m_stop_event.reset();
+            StartStop();
+        });
+        if (!m_stop_event) {
+            return false;
+        }
+        m_stop_callback = std::move(callback);
+        return true;
+    }
+
+    /**
+     * @brief Ramp down to standstill, then short brake the motor.
+     *
+     * @param callback      Callback function to be called, in interrupt context, once the motor is braked.
+     *
+     * @note Cancels a pending timed move or stop, its callback is not called.
+     * @note At standstill the motor is braked and callback is called immediately.
+     * @note May be called from callbacks, including the callback of a previous stop.
+     */
+    void Stop(CallbackT&& callback = nullptr) noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        CancelStop();
+        m_stop_callback = std::move(callback);
+        StartStop();
+    }
+
+    /**
+     * @brief Short brake the motor immediately (both IN pins high, EN fully on).
+     *
+     * @note Cancels pending ramps, timed moves and stops, their callbacks are not called.
+     */
+    void Brake() noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        CancelStop();
+        CancelRamp();
+        ApplyBrake();
+    }
+
+    /**
+     * @brief Let the motor spin freely immediately (both IN pins low, EN off).
+     *
+     * @note Cancels pending ramps, timed moves and stops, their callbacks are not called.
+     */
+    void Coast() noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        CancelStop();
+        CancelRamp();
+        m_speed = s_min_speed;
+        m_target_speed = s_min_speed;
+        m_target_direction = m_direction;
+        m_enable_pwm.Set(s_min_speed);
+        m_forward_pin.Low();
+        m_backward_pin.Low();
+    }
+
+private:
+    GpioOutput& m_forward_pin;
+    GpioOutput& m_backward_pin;
+    Pwm<PwmConfigT>& m_enable_pwm;
+    SchedulerT& m_scheduler;
+    std::optional<TimerEvent> m_ramp_event{};
+    std::optional<TimerEvent> m_stop_event{};
+    CallbackT m_stop_callback{};
+    std::uint32_t m_speed{s_min_speed};
+    std::uint32_t m_target_speed{s_min_speed};
+    L298nDirection m_direction{L298nDirection::Forward};
+    L298nDirection m_target_direction{L298nDirection::Forward};
+    bool m_is_stopping{};
+
+    /**
+     * @brief Cancel a pending timed move or stop and drop its callback.
+     */
+    void CancelStop() noexcept
+    {
+        if (m_stop_event) {
+            m_scheduler.Cancel(*m_stop_event);
+            m_stop_event.reset();
+        }
+        m_stop_callback = nullptr;
+        m_is_stopping = false;
+    }
+
+    /**
+     * @brief Cancel the periodic ramp event.
+     */
+    void CancelRamp() noexcept
+    {
+        if (m_ramp_event) {
+            m_scheduler.Cancel(*m_ramp_event);
+            m_ramp_event.reset();
+        }
+    }
+
+    /**
+     * @brief Set the target and start ramping towards it.
+     *
+     * @param direction     Target direction.
+     * @param speed         Target speed, clamped to the input range.
+     */
+    void SetTarget(L298nDirection direction, std::uint32_t speed) noexcept
+    {
+        m_target_direction = direction;
+        m_target_speed = std::clamp(speed, s_min_speed, s_max_speed);
+        if (m_speed == s_min_speed) {
+            m_direction = direction;
+            Apply();
+        }
+        if (IsAtTarget()) {
+            CancelRamp();
+            OnTargetReached();
+            return;
+        }
+        if (m_ramp_event) {
+            return;
+        }
+        m_ramp_event = m_scheduler.CallEvery(RampT::interval, [this](){
+            Step();
+        });
+        if (!m_ramp_event) {
+            m_direction = m_target_direction;
+            m_speed = m_target_speed;
+            Apply();
+            OnTargetReached();
+        }
+    }
+
+    /**
+     * @brief Ramp down to standstill and brake when reached.
+     */
+    void StartStop() noexcept
+    {
+        m_is_stopping = true;
+        SetTarget(m_direction, s_min_speed);
+    }
+
+    /**
+     * @returns True if the current direction and speed equal the target.
+     */
+    bool IsAtTarget() const noexcept
+    {
+        return m_direction == m_target_direction && m_speed == m_target_speed;
+    }
+
+    /**
+     * @brief Ramp event handler, moves the speed one step towards the target.
+     *
+     * A direction change decelerates to standstill first, then switches the IN pins.
+     */
+    void Step() noexcept
+    {
+        if (m_direction != m_target_direction) {
+            m_speed -= std::min(RampT::step, m_speed - s_min_speed);
+            if (m_speed == s_min_speed) {
+                m_direction = m_target_direction;
+            }
+        } else if (m_speed < m_target_speed) {
+            m_speed += std::min(RampT::step, m_target_speed - m_speed);
+        } else {
+            m_speed -= std::min(RampT::step, m_speed - m_target_speed);
+        }
+        Apply();
+        if (IsAtTarget()) {
+            CancelRamp();
+            OnTargetReached();
+        }
+    }
+
+    /**
+     * @brief Brake and call the stop callback if the target was a stop.
+     */
+    void OnTargetReached() noexcept
+    {
+        if (!m_is_stopping) {
+            return;
+        }
+        m_is_stopping = false;
+        ApplyBrake();
+        auto callback = std::move(m_stop_callback);
+        m_stop_callback = nullptr;
+        if (callback) {
+            callback();
+        }
+    }
+
+    /**
+     * @brief Write the current direction and speed to the bridge.
+     */
+    void Apply() noexcept
+    {
+        const bool is_forward = (m_direction == L298nDirection::Forward);
+        m_forward_pin.Write(is_forward ? GpioPinState::High : GpioPinState::Low);
+        m_backward_pin.Write(is_forward ? GpioPinState::Low : GpioPinState::High);
+        m_enable_pwm.Set(m_speed);
+    }
+
+    /**
+     * @brief Short brake the bridge at standstill.
+     */
+    void ApplyBrake() noexcept
+    {
+        m_speed = s_min_speed;
+        m_target_speed = s_min_speed;
+        m_target_direction = m_direction;
+        m_forward_pin.High();
+        m_backward_pin.High();
+        m_enable_pwm.Set(s_max_speed);
+    }
+};
+
+/**
+ * @brief Short brake several motors at once.
+ *
+ * All bridges are switched inside one critical section, so no motor keeps
+ * driving while the others have already stopped (e.g., the wheels of a robot).
+ *
+ * @param motors    L298nMotor instances to be braked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/L298n.hpp>
+ *
+ * STM32::L298nBrake(left, right);
+ * @endcode
+ */
+template <typename... MotorsT>
+requires (sizeof...(MotorsT) > 0)
+void L298nBrake(MotorsT&... motors) noexcept
+{
+    __Internal::__CriticalSection critical_section{};
+    (motors.Brake(), ...);
+}
+
 } /* namespace STM32 */
 
 #endif /* STM32_L298N_HPP */
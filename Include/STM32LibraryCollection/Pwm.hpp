@@ -5,7 +5,7 @@
 #define STM32_PWM_HPP
 
 #include <algorithm>
-#include <cmath>
+#include <concepts>
 #include <cstdint>
 #include <utility>
 
@@ -210,6 +210,117 @@ concept IsPwmConfig =
         typename T::InputRangeMaxT;
     };
 
+namespace __Internal {
+
+/**
+ * @class __PwmScale, Conversions between PwmConfig input values and timer compare values.
+ *
+ * Coefficients depend on the timer period and are computed once on construction.
+ * Integral inputs and compare values are converted with integer arithmetic only
+ * (see __FixedPointScale), fractional inputs with floating-point arithmetic.
+ *
+ * @tparam PwmConfigT   PWM configuration type defining input/output ranges.
+ *
+ * @note This is an internal class. Do not use directly in application code.
+ */
+template <IsPwmConfig PwmConfigT>
+class __PwmScale {
+public:
+
+    /**
+     * @brief Construct __PwmScale class.
+     *
+     * @param timer_period      Timer period (auto-reload value) of the PWM output.
+     */
+    explicit __PwmScale(std::uint32_t timer_period) noexcept
+      : m_pwm_resolution{timer_period + 1}
+    { }
+
+    /**
+     * @brief Convert an integral input value to a compare value.
+     *
+     * @param input     Input value, clamped to the input range.
+     *
+     * @returns Corresponding compare value.
+     */
+    [[nodiscard]]
+    std::uint32_t ToCompare(std::integral auto input) const noexcept
+    {
+        std::uint32_t clamped{PwmConfigT::InputRangeT::min_value};
+        if (std::cmp_greater(input, PwmConfigT::InputRangeT::max_value)) {
+            clamped = PwmConfigT::InputRangeT::max_value;
+        } else if (std::cmp_greater(input, PwmConfigT::InputRangeT::min_value)) {
+            clamped = static_cast<std::uint32_t>(input);
+        }
+        return m_pwm_scale.Apply(clamped - PwmConfigT::InputRangeMaxT::min_value);
+    }
+
+    /**
+     * @brief Convert a fractional input value to a compare value.
+     *
+     * @param input     Input value, clamped to the input range.
+     *
+     * @returns Corresponding compare value.
+     */
+    [[nodiscard]]
+    std::uint32_t ToCompare(double input) const noexcept
+    {
+        input = std::clamp(
+            input,
+            static_cast<double>(PwmConfigT::InputRangeT::min_value),
+            static_cast<double>(PwmConfigT::InputRangeT::max_value)
+        );
+        return static_cast<std::uint32_t>(
+            m_min_pwm_value +
+            (
+                (input - PwmConfigT::InputRangeMaxT::min_value) / 
+                (PwmConfigT::InputRangeMaxT::range_size)
+            ) *
+            m_pwm_value_resolution
+        );
+    }
+
+    /**
+     * @brief Convert a compare value to an input value.
+     *
+     * @param compare   Compare value.
+     *
+     * @returns Corresponding input value, rounded to nearest.
+     */
+    [[nodiscard]]
+    std::uint32_t ToInput(std::uint32_t compare) const noexcept
+    {
+        return std::min(
+            m_input_scale.Apply(std::min(compare, m_pwm_resolution)),
+            PwmConfigT::InputRangeMaxT::range_size
+        ) + PwmConfigT::InputRangeMaxT::min_value;
+    }
+
+private:
+    std::uint32_t m_pwm_resolution;
+    double m_min_pwm_value{
+        (m_pwm_resolution * PwmConfigT::DutyCycleRangeT::min_value) / 100.
+    };
+    double m_max_pwm_value{
+        (m_pwm_resolution * PwmConfigT::DutyCycleRangeT::max_value) / 100.
+    };
+    double m_pwm_value_resolution{
+        m_max_pwm_value - m_min_pwm_value
+    };
+    __FixedPointScale m_pwm_scale{
+        m_pwm_value_resolution / PwmConfigT::InputRangeMaxT::range_size,
+        m_min_pwm_value,
+        PwmConfigT::InputRangeMaxT::range_size
+    };
+    __FixedPointScale m_input_scale{
+        PwmConfigT::InputRangeMaxT::range_size / m_pwm_value_resolution,
+        .5 - m_min_pwm_value * PwmConfigT::InputRangeMaxT::range_size / m_pwm_value_resolution,
+        m_pwm_resolution
+    };
+};
+
+} /* namespace __Internal */
+
 /**
  * @class Pwm, A class to manage PWM output on STM32 microcontrollers.
  * 
@@ -232,7 +343,7 @@ concept IsPwmConfig =
  *     STM32::PwmInputRangeMax<0, 255>
  * >>;
  * LedPwm led{htim1, TIM_CHANNEL_1};
- * led.Set(128);                    // Set to ~50% brightness
+ * led.Set(128);                    // Set to ~50% brightness, integer arithmetic only
  * auto brightness = led.Get();     // Read current value
  *
  * // For servo control, use the Servo typedef instead
@@ -295,86 +406,44 @@ public:
     }
 
     /**
-     * @returns Current input value corresponding to the PWM duty cycle.
+     * @returns Current input value corresponding to the PWM duty cycle, rounded to nearest.
+     *
+     * @note Computed with integer arithmetic only.
      */
     [[nodiscard]]
     std::uint32_t Get() const noexcept
     {
-        return ConvertToInput(
-            __HAL_TIM_GET_COMPARE(&m_timer_handle, m_timer_channel)
-        );
+        return m_scale.ToInput(__HAL_TIM_GET_COMPARE(&m_timer_handle, m_timer_channel));
+    }
+
+    /**
+     * @brief Set the PWM duty cycle based on an integer input value.
+     *
+     * @param input     Input value to set the PWM duty cycle, clamped to the input range.
+     *
+     * @note Computed with integer arithmetic only, preferred on cores without an FPU.
+     */
+    void Set(std::integral auto input) noexcept
+    {
+        __HAL_TIM_SET_COMPARE(&m_timer_handle, m_timer_channel, m_scale.ToCompare(input));
     }
 
     /**
      * @brief Set the PWM duty cycle based on the input value.
      * 
      * @param input     Input value to set the PWM duty cycle.
+     *
+     * @note Fractional inputs use floating-point arithmetic, see the integral overload.
      */
     void Set(double input) noexcept
     {
-        __HAL_TIM_SET_COMPARE(
-            &m_timer_handle,
-            m_timer_channel,
-            ConvertToPwm(
-                std::clamp(
-                    input,
-                    static_cast<double>(PwmConfigT::InputRangeT::min_value),
-                    static_cast<double>(PwmConfigT::InputRangeT::max_value)
-                )
-            )
-        );
+        __HAL_TIM_SET_COMPARE(&m_timer_handle, m_timer_channel, m_scale.ToCompare(input));
     }
 
 private:
     TIM_HandleTypeDef& m_timer_handle;
     std::uint32_t m_timer_channel;
-    std::uint32_t m_pwm_resolution{
-        m_timer_handle.Init.Period + 1
-    };
-    double m_min_pwm_value{
-        (m_pwm_resolution * PwmConfigT::DutyCycleRangeT::min_value) / 100.
-    };
-    double m_max_pwm_value{
-        (m_pwm_resolution * PwmConfigT::DutyCycleRangeT::max_value) / 100.
-    };
-    double m_pwm_value_resolution{
-        m_max_pwm_value - m_min_pwm_value
-    };
-
-    /**
-     * @brief Convert input value to PWM value.
-     * 
-     * @param input     Input value to convert.
-     * 
-     * @returns Corresponding PWM value.
-     */
-    constexpr auto ConvertToPwm(double input) const noexcept
-    {
-        return static_cast<std::uint32_t>(
-            m_min_pwm_value +
-            (
-                (input - PwmConfigT::InputRangeMaxT::min_value) / 
-                (PwmConfigT::InputRangeMaxT::range_size)
-            ) *
-            m_pwm_value_resolution
-        );
-    }
-
-    /**
-     * @brief Convert PWM value to input value.
-     * 
-     * @param pwm_value     PWM value to convert.
-     * 
-     * @returns Corresponding input value.
-     */
-    constexpr auto ConvertToInput(int pwm_value) const noexcept
-    {
-        return static_cast<std::uint32_t>(std::round(
-            (PwmConfigT::InputRangeMaxT::range_size) *
-            ((pwm_value - m_min_pwm_value) / m_pwm_value_resolution)) +
-            PwmConfigT::InputRangeMaxT::min_value
-        );
-    }
+    __Internal::__PwmScale<PwmConfigT> m_scale{m_timer_handle.Init.Period};
 };
 
 } /* namespace STM32 */
@@ -0,0 +1,724 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_PWM_GROUP_HPP
+#define STM32_PWM_GROUP_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+#include "Config.hpp"
+#include "Pwm.hpp"
+#include "Servo.hpp"
+#include "__Internal/__Utility.hpp"
+
+#include "main.h"
+
+#if (USE_HAL_TIM_REGISTER_CALLBACKS != 1) /* module check */
+#error "HAL TIM callbacks are not enabled!"
+#endif /* module check */
+
+namespace STM32 {
+
+/**
+ * @struct PwmGroupChannels, A utility struct to hold the timer channels of a PwmGroup.
+ *
+ * @tparam TimerChannelsV   Distinct timer channels (TIM_CHANNEL_1 to TIM_CHANNEL_4),
+ *                          in the order used for the group indices.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/PwmGroup.hpp>
+ *
+ * // 3-phase bridge on channels 1-3
+ * using PhaseChannels = STM32::PwmGroupChannels<TIM_CHANNEL_1, TIM_CHANNEL_2, TIM_CHANNEL_3>;
+ * @endcode
+ */
+template <std::uint32_t... TimerChannelsV>
+struct PwmGroupChannels {
+    static_assert(
+        1 <= sizeof...(TimerChannelsV) && sizeof...(TimerChannelsV) <= 4,
+        "Channel count must be in the range [1, 4]!"
+    );
+    static_assert(
+        ((TimerChannelsV == TIM_CHANNEL_1 || TimerChannelsV == TIM_CHANNEL_2 ||
+          TimerChannelsV == TIM_CHANNEL_3 || TimerChannelsV == TIM_CHANNEL_4) && ...),
+        "Channels must be in the range [TIM_CHANNEL_1, TIM_CHANNEL_4]!"
+    );
+    static constexpr std::array<std::uint32_t, sizeof...(TimerChannelsV)> channels{TimerChannelsV...};
+    static_assert(
+        [](){
+            auto sorted = channels;
+            std::ranges::sort(sorted);
+            return std::ranges::adjacent_find(sorted) == sorted.end();
+        }(),
+        "Channels must be distinct!"
+    );
+};
+
+/**
+ * @brief IsPwmGroupChannels, A concept to check if a type is a PwmGroupChannels.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/PwmGroup.hpp>
+ *
+ * static_assert(STM32::IsPwmGroupChannels<STM32::PwmGroupChannels<TIM_CHANNEL_1, TIM_CHANNEL_2>>);
+ * static_assert(!STM32::IsPwmGroupChannels<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsPwmGroupChannels =
+    std::same_as<std::remove_cv_t<decltype(T::channels)>, std::array<std::uint32_t, T::channels.size()>> &&
+    (1 <= T::channels.size() && T::channels.size() <= 4);
+
+/**
+ * @brief IsPwmGroup, A concept to check if a type is a PwmGroup.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/PwmGroup.hpp>
+ *
+ * using MyPwmGroup = STM32::PwmGroup<
+ *     STM32::ServoConfig,
+ *     STM32::PwmGroupChannels<TIM_CHANNEL_1, TIM_CHANNEL_2>,
+ *     STM32::WorkingMode::DMA,
+ *     STM32_UNIQUE_TAG
+ * >;
+ * static_assert(STM32::IsPwmGroup<MyPwmGroup>);
+ * static_assert(!STM32::IsPwmGroup<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsPwmGroup =
+    IsWorkingMode<typename T::DefaultWorkingModeT> &&
+    requires (T& group) {
+        { T::size } -> std::convertible_to<std::size_t>;
+        { group.GetTimerHandle() } -> std::same_as<TIM_HandleTypeDef&>;
+    };
+
+/**
+ * @namespace PwmTrajectoryProfile, Tag types for the motion profile of a PwmTrajectory.
+ */
+namespace PwmTrajectoryProfile {
+
+/**
+ * @struct Linear, Tag for a constant speed ramp.
+ */
+struct Linear {};
+
+/**
+ * @struct SCurve, Tag for a minimum-jerk S-curve (smooth start and stop, zero end speed and acceleration).
+ */
+struct SCurve {};
+
+} /* namespace PwmTrajectoryProfile */
+
+/**
+ * @brief IsPwmTrajectoryProfile, A concept to check if a type is a PwmTrajectoryProfile.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/PwmGroup.hpp>
+ *
+ * static_assert(STM32::IsPwmTrajectoryProfile<STM32::PwmTrajectoryProfile::SCurve>);
+ * static_assert(!STM32::IsPwmTrajectoryProfile<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsPwmTrajectoryProfile =
+    std::same_as<T, PwmTrajectoryProfile::Linear> ||
+    std::same_as<T, PwmTrajectoryProfile::SCurve>;
+
+/**
+ * @struct PwmTrajectoryLength, A utility struct to hold the maximum number of steps of a PwmTrajectory.
+ *
+ * @tparam StepsV   Maximum number of PWM periods of one move, each period outputs one step.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/PwmGroup.hpp>
+ *
+ * // Moves of up to 2 s with 50 Hz servo PWM
+ * using TwoSeconds = STM32::PwmTrajectoryLength<100>;
+ * @endcode
+ */
+template <std::size_t StepsV>
+struct PwmTrajectoryLength : __Internal::__Constant<std::size_t, StepsV> {
+    static_assert(
+        1 <= StepsV && StepsV <= std::numeric_limits<std::uint16_t>::max(),
+        "Trajectory length must be in the range [1, 65535]!"
+    );
+};
+
+/**
+ * @brief IsPwmTrajectoryLength, A concept to check if a type is a PwmTrajectoryLength.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/PwmGroup.hpp>
+ *
+ * static_assert(STM32::IsPwmTrajectoryLength<STM32::PwmTrajectoryLength<100>>);
+ * static_assert(!STM32::IsPwmTrajectoryLength<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsPwmTrajectoryLength =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t> &&
+    (1 <= T::value && T::value <= std::numeric_limits<std::uint16_t>::max());
+
+template <
+    IsPwmGroup PwmGroupT,
+    IsPwmTrajectoryLength PwmTrajectoryLengthT = PwmTrajectoryLength<50>
+>
+class PwmTrajectory;
+
+/**
+ * @class PwmGroup, A class to update several PWM channels of one timer in the same PWM period.
+ *
+ * Compare values are staged with Stage() and committed together with Commit(). Output compare
+ * preload is enabled for all channels, so new compare values take effect at an update event
+ * only, and a commit never lands in different periods on different channels. This keeps
+ * multi-phase bridges and multi-servo arms phase coherent.
+ *
+ * Commit modes:
+ * - WorkingMode::Blocking: the CPU writes all compare registers while update events are
+ *   disabled (UDIS), the values take effect at the next update event.
+ * - WorkingMode::DMA: Commit() returns immediately, a DMA burst (HAL_TIM_DMABurst_WriteStart)
+ *   writes all compare registers on the next update event, and they take effect on the one after.
+ *
+ * @tparam PwmConfigT           PWM configuration type shared by all channels.
+ * @tparam PwmGroupChannelsT    Channels of the group (see PwmGroupChannels).
+ * @tparam WorkingModeT         Commit mode (WorkingMode::Blocking or WorkingMode::DMA).
+ * @tparam UniqueTagT           Unique tag type to differentiate multiple PwmGroup instances.
+ *                              UniqueTagT must be STM32_UNIQUE_TAG.
+ *
+ * @note PwmGroup class is non-copyable and non-movable.
+ * @note PWM starts automatically upon construction with the default value on all channels
+ *       and stops upon destruction. Do not use a Pwm on the channels of a group.
+ * @note Blocking mode drops the update event if the counter overflows during the commit
+ *       (a few CPU cycles), update interrupts and DMA requests of that period are lost.
+ * @note DMA mode requires the timer update DMA request (TIM_DMA_ID_UPDATE) linked in CubeMX:
+ *       memory-to-peripheral, normal mode, word data width on both sides. The burst spans
+ *       all compare registers from the lowest to the highest group channel, channels in between
+ *       that are not in the group are rewritten with their current value.
+ * @note PwmGroup uses the period elapsed callback of the timer.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/PwmGroup.hpp>
+ *
+ * TIM_HandleTypeDef htim1; // Assume 3 PWM channels initialized by CubeMX
+ *
+ * using PhaseConfig = STM32::PwmConfig<
+ *     STM32::PwmDutyCycleRange<0.0, 100.0>,
+ *     STM32::PwmInputRange<0, 1000, 500>,
+ *     STM32::PwmInputRangeMax<0, 1000>
+ * >;
+ *
+ * STM32::PwmGroup<
+ *     PhaseConfig,
+ *     STM32::PwmGroupChannels<TIM_CHANNEL_1, TIM_CHANNEL_2, TIM_CHANNEL_3>,
+ *     STM32::WorkingMode::DMA,
+ *     STM32_UNIQUE_TAG
+ * > phases{htim1};
+ *
+ * phases.Stage(0, 750);
+ * phases.Stage(1, 250);
+ * phases.Stage(2, 500);
+ * phases.Commit();                 // All three change in the same PWM period
+ *
+ * phases.Set({600, 400, 500});     // Stage and commit in one call
+ * @endcode
+ */
+template <
+    IsPwmConfig PwmConfigT,
+    IsPwmGroupChannels PwmGroupChannelsT,
+    IsWorkingMode WorkingModeT,
+    __Internal::__IsUniqueTag UniqueTagT
+>
+class PwmGroup {
+    static_assert(
+        !std::same_as<WorkingModeT, WorkingMode::Interrupt>,
+        "PwmGroup supports WorkingMode::Blocking and WorkingMode::DMA only!"
+    );
+
+    using PeriodElapsedCallbackT = __Internal::__CallbackManager<
+        TIM_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_TIM_RegisterCallback, HAL_TIM_UnRegisterCallback, HAL_TIM_PERIOD_ELAPSED_CB_ID
+    >;
+
+    static constexpr auto s_channels = PwmGroupChannelsT::channels;
+    /* TIM_CHANNEL_x is 4 * (x - 1), so channel / 4 is the CCRx register index. */
+    static constexpr std::size_t s_first_index{std::ranges::min(s_channels) / 4};
+    static constexpr std::size_t s_burst_length{std::ranges::max(s_channels) / 4 - s_first_index + 1};
+
+    template <IsPwmGroup, IsPwmTrajectoryLength>
+    friend class PwmTrajectory;
+public:
+
+    /**
+     * @typedef DefaultWorkingModeT, Commit mode of the group.
+     */
+    using DefaultWorkingModeT = WorkingModeT;
+
+    /** @brief Number of channels in the group. */
+    static constexpr std::size_t size{s_channels.size()};
+
+    /**
+     * @brief Construct PwmGroup class.
+     *
+     * @param timer_handle      Reference to the TIM handle.
+     *
+     * @note PWM starts automatically upon construction with the default value.
+     * @note HAL callbacks are automatically registered via RAII.
+     */
+    explicit PwmGroup(TIM_HandleTypeDef& timer_handle) noexcept
+      : m_timer_handle{timer_handle},
+        m_period_elapsed_callback{timer_handle}
+    {
+        m_staged.fill(m_scale.ToCompare(PwmConfigT::InputRangeT::default_value));
+        for (auto channel : s_channels) {
+            __HAL_TIM_ENABLE_OCxPRELOAD(&m_timer_handle, channel);
+            __HAL_TIM_SET_COMPARE(&m_timer_handle, channel, m_staged[0]);
+        }
+        if constexpr (std::same_as<WorkingModeT, WorkingMode::DMA>) {
+            m_period_elapsed_callback.Set([this](){
+                OnBurstComplete();
+            });
+        }
+        for (auto channel : s_channels) {
+            HAL_TIM_PWM_Start(&m_timer_handle, channel);
+        }
+    }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    PwmGroup(const PwmGroup&) = delete;
+    PwmGroup& operator=(const PwmGroup&) = delete;
+    PwmGroup(PwmGroup&&) = delete;
+    PwmGroup& operator=(PwmGroup&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy the PwmGroup object, stops PWM on all channels.
+     *
+     * @note Callbacks are automatically unregistered via RAII.
+     */
+    ~PwmGroup()
+    {
+        if constexpr (std::same_as<WorkingModeT, WorkingMode::DMA>) {
+            if (IsBusy()) {
+                HAL_TIM_DMABurst_WriteStop(&m_timer_handle, TIM_DMA_UPDATE);
+            }
+        }
+        for (auto channel : s_channels) {
+            HAL_TIM_PWM_Stop(&m_timer_handle, channel);
+        }
+    }
+
+    /**
+     * @returns TIM handle reference.
+     */
+    [[nodiscard]]
+    auto&& GetTimerHandle(this auto&& self) noexcept
+    {
+        return std::forward<decltype(self)>(self).m_timer_handle;
+    }
+
+    /**
+     * @returns Timer channel of a group index.
+     */
+    [[nodiscard]]
+    static constexpr std::uint32_t GetTimerChannel(std::size_t index) noexcept
+    {
+        return s_channels[index];
+    }
+
+    /**
+     * @param index     Group index of the channel.
+     *
+     * @returns Current input value of the channel, rounded to nearest.
+     */
+    [[nodiscard]]
+    std::uint32_t Get(std::size_t index) const noexcept
+    {
+        return m_scale.ToInput(__HAL_TIM_GET_COMPARE(&m_timer_handle, s_channels[index]));
+    }
+
+    /**
+     * @brief Stage a new value of a channel, applied by the next Commit().
+     *
+     * @param index     Group index of the channel.
+     * @param input     Input value, clamped to the input range.
+     *
+     * @note Integral inputs are converted with integer arithmetic only.
+     */
+    void Stage(std::size_t index, std::integral auto input) noexcept
+    {
+        m_staged[index] = m_scale.ToCompare(input);
+    }
+
+    /**
+     * @brief Stage a new value of a channel, applied by the next Commit().
+     *
+     * @param index     Group index of the channel.
+     * @param input     Input value, clamped to the input range.
+     */
+    void Stage(std::size_t index, double input) noexcept
+    {
+        m_staged[index] = m_scale.ToCompare(input);
+    }
+
+    /**
+     * @brief Apply all staged values in the same PWM period.
+     *
+     * @returns True on success, false if a DMA commit is still pending or DMA failed to start.
+     */
+    bool Commit() noexcept
+    {
+        if constexpr (std::same_as<WorkingModeT, WorkingMode::Blocking>) {
+            SET_BIT(m_timer_handle.Instance->CR1, TIM_CR1_UDIS);
+            for (std::size_t index{}; index < size; ++index) {
+                __HAL_TIM_SET_COMPARE(&m_timer_handle, s_channels[index], m_staged[index]);
+            }
+            CLEAR_BIT(m_timer_handle.Instance->CR1, TIM_CR1_UDIS);
+            return true;
+        } else {
+            if (!TryAcquire()) {
+                return false;
+            }
+            for (std::size_t offset{}; offset < s_burst_length; ++offset) {
+                m_burst[offset] = GetBurstCompare(offset);
+            }
+            for (std::size_t index{}; index < size; ++index) {
+                m_burst[s_channels[index] / 4 - s_first_index] = m_staged[index];
+            }
+            const bool is_started{HAL_OK == HAL_TIM_DMABurst_WriteStart(
+                &m_timer_handle,
+                TIM_DMABASE_CCR1 + s_first_index,
+                TIM_DMA_UPDATE,
+                m_burst.data(),
+                TIM_DMABURSTLENGTH_1TRANSFER + ((s_burst_length - 1) << 8)
+            )};
+            if (!is_started) {
+                m_is_busy.store(false, std::memory_order_release);
+            }
+            return is_started;
+        }
+    }
+
+    /**
+     * @brief Stage values of all channels and commit them.
+     *
+     * @param inputs    Input values in group index order, clamped to the input range.
+     *
+     * @returns True on success, false otherwise (see Commit()).
+     */
+    bool Set(const std::array<std::uint32_t, size>& inputs) noexcept
+    {
+        for (std::size_t index{}; index < size; ++index) {
+            Stage(index, inputs[index]);
+        }
+        return Commit();
+    }
+
+    /**
+     * @returns True while a DMA commit is pending.
+     */
+    [[nodiscard]]
+    bool IsBusy() const noexcept
+    {
+        return m_is_busy.load(std::memory_order_acquire);
+    }
+
+private:
+    TIM_HandleTypeDef& m_timer_handle;
+    PeriodElapsedCallbackT m_period_elapsed_callback;
+    __Internal::__PwmScale<PwmConfigT> m_scale{m_timer_handle.Init.Period};
+    std::array<std::uint32_t, size> m_staged{};
+    std::array<std::uint32_t, s_burst_length> m_burst{};
+    std::atomic<bool> m_is_busy{};
+
+    /**
+     * @brief Finish a DMA burst, the request must be stopped before the next one.
+     */
+    void OnBurstComplete() noexcept
+    {
+        HAL_TIM_DMABurst_WriteStop(&m_timer_handle, TIM_DMA_UPDATE);
+        m_is_busy.store(false, std::memory_order_release);
+    }
+
+    /**
+     * @brief Claim the DMA request for a burst.
+     *
+     * @returns True on success, false if a burst is pending.
+     */
+    bool TryAcquire() noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        if (m_is_busy.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        m_is_busy.store(true, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * @returns Current compare value of a register index in the burst span.
+     */
+    std::uint32_t GetBurstCompare(std::size_t offset) const noexcept
+    {
+        return __HAL_TIM_GET_COMPARE(&m_timer_handle, 4 * (s_first_index + offset));
+    }
+};
+
+/**
+ * @class PwmTrajectory, A companion of a DMA PwmGroup that streams precomputed moves into the compare registers.
+ *
+ * MoveTo() computes one frame of compare values per PWM period, from the current
+ * positions to the targets along a ramp or S-curve, and starts a timer DMA burst
+ * that writes one frame on each update event. The CPU is not involved until the
+ * completion callback, regardless of the number of steps and channels, so every
+ * group of up to four servos moves smoothly without a control loop interrupt.
+ *
+ * @tparam PwmGroupT                PwmGroup type to operate on (WorkingMode::DMA).
+ * @tparam PwmTrajectoryLengthT     Maximum number of steps of one move (default is 50).
+ *
+ * @note PwmTrajectory class is non-copyable and non-movable.
+ * @note Takes over the period elapsed callback of the group, PwmGroup::Commit() keeps working
+ *       between moves (and returns false while a move runs).
+ * @note Frames are applied at the update event after their DMA burst (output compare preload),
+ *       the completion callback is called after the last frame has been transferred.
+ * @note The buffer holds PwmTrajectoryLengthT::value frames of the group burst span (in 32-bit words).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/PwmGroup.hpp>
+ *
+ * TIM_HandleTypeDef htim3; // 50 Hz PWM on 4 channels, update DMA request linked in CubeMX
+ *
+ * STM32::PwmGroup<
+ *     STM32::ServoConfig,
+ *     STM32::PwmGroupChannels<TIM_CHANNEL_1, TIM_CHANNEL_2, TIM_CHANNEL_3, TIM_CHANNEL_4>,
+ *     STM32::WorkingMode::DMA,
+ *     STM32_UNIQUE_TAG
+ * > leg{htim3};
+ * STM32::PwmTrajectory<decltype(leg), STM32::PwmTrajectoryLength<100>> leg_motion{leg};
+ *
+ * // All four joints reach their targets together after 1 s (50 PWM periods)
+ * leg_motion.MoveTo<STM32::PwmTrajectoryProfile::SCurve>({45, 90, 135, 180}, 50, [](){
+ *     // Move completed
+ * });
+ * @endcode
+ */
+template <IsPwmGroup PwmGroupT, IsPwmTrajectoryLength PwmTrajectoryLengthT>
+class PwmTrajectory {
+    static_assert(
+        std::same_as<typename PwmGroupT::DefaultWorkingModeT, WorkingMode::DMA>,
+        "PwmTrajectory requires a PwmGroup in WorkingMode::DMA"
+    );
+    static constexpr std::size_t s_burst_length{PwmGroupT::s_burst_length};
+    static_assert(
+        PwmTrajectoryLengthT::value * s_burst_length <= std::numeric_limits<std::uint16_t>::max(),
+        "Trajectory buffer exceeds a single DMA transfer (65535 words)"
+    );
+
+    /** @brief Fixed-point one of the motion profiles (Q16). */
+    static constexpr std::int64_t s_one{std::int64_t{1} << 16};
+public:
+
+    /**
+     * @brief Construct PwmTrajectory class.
+     *
+     * @param group     Reference to the PwmGroup to operate on.
+     *
+     * @note Takes over the period elapsed callback of group.
+     */
+    explicit PwmTrajectory(PwmGroupT& group) noexcept
+      : m_group{group}
+    {
+        m_group.m_period_elapsed_callback.Set([this](){
+            OnBurstComplete();
+        });
+    }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    PwmTrajectory(const PwmTrajectory&) = delete;
+    PwmTrajectory& operator=(const PwmTrajectory&) = delete;
+    PwmTrajectory(PwmTrajectory&&) = delete;
+    PwmTrajectory& operator=(PwmTrajectory&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy PwmTrajectory class, stops a running move and hands the callback back to the group.
+     */
+    ~PwmTrajectory()
+    {
+        Stop();
+        m_group.m_period_elapsed_callback.Set([&group = m_group](){
+            group.OnBurstComplete();
+        });
+    }
+
+    /**
+     * @returns Maximum number of steps of one move.
+     */
+    [[nodiscard]]
+    static constexpr std::size_t Capacity() noexcept
+    {
+        return PwmTrajectoryLengthT::value;
+    }
+
+    /**
+     * @brief Start a move of all channels from their current values to the targets.
+     *
+     * @tparam ProfileT     Motion profile (default is PwmTrajectoryProfile::Linear).
+     *
+     * @param targets       Target input values in group index order, clamped to the input range.
+     * @param steps         Duration of the move in PWM periods, in the range [1, Capacity()].
+     * @param callback      Callback function to be called in interrupt context when the move has finished.
+     *
+     * @returns True if the move has started, false if steps is out of range, a move or commit
+     *          is pending or DMA failed to start.
+     *
+     * @note Frames are computed with integer arithmetic only.
+     */
+    template <IsPwmTrajectoryProfile ProfileT = PwmTrajectoryProfile::Linear>
+    bool MoveTo(
+        const std::array<std::uint32_t, PwmGroupT::size>& targets,
+        std::size_t steps,
+        CallbackT&& callback = [](){}
+    ) noexcept
+    {
+        if (steps == 0 || steps > Capacity() || !m_group.TryAcquire()) {
+            return false;
+        }
+        std::array<std::uint32_t, s_burst_length> start{};
+        std::array<std::uint32_t, s_burst_length> target{};
+        for (std::size_t offset{}; offset < s_burst_length; ++offset) {
+            start[offset] = m_group.GetBurstCompare(offset);
+        }
+        target = start;
+        for (std::size_t index{}; index < PwmGroupT::size; ++index) {
+            target[PwmGroupT::s_channels[index] / 4 - PwmGroupT::s_first_index] =
+                m_group.m_scale.ToCompare(targets[index]);
+        }
+        for (std::size_t step{1}; step <= steps; ++step) {
+            const std::int64_t progress{Profile<ProfileT>(
+                static_cast<std::int64_t>((step << 16) / steps)
+            )};
+            for (std::size_t offset{}; offset < s_burst_length; ++offset) {
+                const std::int64_t distance{
+                    static_cast<std::int64_t>(target[offset]) - static_cast<std::int64_t>(start[offset])
+                };
+                m_frames[(step - 1) * s_burst_length + offset] = static_cast<std::uint32_t>(
+                    start[offset] + ((distance * progress) >> 16)
+                );
+            }
+        }
+        m_callback = std::move(callback);
+        m_is_moving.store(true, std::memory_order_relaxed);
+        const bool is_started{HAL_OK == HAL_TIM_DMABurst_MultiWriteStart(
+            &m_group.m_timer_handle,
+            TIM_DMABASE_CCR1 + PwmGroupT::s_first_index,
+            TIM_DMA_UPDATE,
+            m_frames.data(),
+            TIM_DMABURSTLENGTH_1TRANSFER + ((s_burst_length - 1) << 8),
+            static_cast<std::uint32_t>(steps * s_burst_length)
+        )};
+        if (!is_started) {
+            m_is_moving.store(false, std::memory_order_relaxed);
+            m_group.m_is_busy.store(false, std::memory_order_release);
+        }
+        return is_started;
+    }
+
+    /**
+     * @brief Stop a running move, the outputs keep the last transferred frame.
+     *
+     * @note The completion callback of the move is not called.
+     */
+    void Stop() noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        if (m_is_moving.load(std::memory_order_relaxed)) {
+            m_is_moving.store(false, std::memory_order_relaxed);
+            m_group.OnBurstComplete();
+        }
+    }
+
+    /**
+     * @returns True while a move is running.
+     */
+    [[nodiscard]]
+    bool IsMoving() const noexcept
+    {
+        return m_is_moving.load(std::memory_order_acquire);
+    }
+
+private:
+    PwmGroupT& m_group;
+    CallbackT m_callback{};
+    std::array<std::uint32_t, PwmTrajectoryLengthT::value * s_burst_length> m_frames{};
+    std::atomic<bool> m_is_moving{};
+
+    /**
+     * @brief Map linear progress to profile progress.
+     *
+     * @param t     Linear progress in Q16, in the range [0, 1].
+     *
+     * @returns Profile progress in Q16, 0 at t = 0 and 1 at t = 1.
+     */
+    template <IsPwmTrajectoryProfile ProfileT>
+    static constexpr std::int64_t Profile(std::int64_t t) noexcept
+    {
+        if constexpr (std::same_as<ProfileT, PwmTrajectoryProfile::Linear>) {
+            return t;
+        } else {
+            /* Minimum-jerk polynomial: t^3 * (10 - 15 t + 6 t^2) */
+            const std::int64_t t2{(t * t) >> 16};
+            const std::int64_t t3{(t2 * t) >> 16};
+            return (t3 * (10 * s_one - 15 * t + 6 * t2)) >> 16;
+        }
+    }
+
+    /**
+     * @brief Finish a DMA burst of the group, and a move if one is running.
+     */
+    void OnBurstComplete() noexcept
+    {
+        m_group.OnBurstComplete();
+        if (m_is_moving.load(std::memory_order_relaxed)) {
+            m_is_moving.store(false, std::memory_order_release);
+            auto callback = std::move(m_callback);
+            if (callback) {
+                callback();
+            }
+        }
+    }
+};
+
+} /* namespace STM32 */
+
+#endif /* STM32_PWM_GROUP_HPP */
@@ -0,0 +1,698 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_REGISTER_MAP_HPP
+#define STM32_REGISTER_MAP_HPP
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <utility>
+
+#include "__Internal/__Utility.hpp"
+
+#include "main.h"
+
+#if defined(HAL_I2C_MODULE_ENABLED)
+#include "I2c.hpp"
+#endif /* HAL_I2C_MODULE_ENABLED */
+
+#if defined(HAL_SPI_MODULE_ENABLED)
+#include "Gpio.hpp"
+#include "Spi.hpp"
+#endif /* HAL_SPI_MODULE_ENABLED */
+
+namespace STM32 {
+
+/**
+ * @enum RegisterAccess, Caching behaviour of a device register.
+ */
+enum class RegisterAccess : std::uint8_t {
+    ReadWrite,  /**< Configuration register, cached, writes of the cached value are skipped */
+    ReadOnly,   /**< Constant register (e.g., identification), cached after the first read */
+    Volatile    /**< Status, data or command register, never cached nor bridged over */
+};
+
+/**
+ * @struct DeviceRegister, A compile-time device register of a RegisterMap.
+ *
+ * @tparam AddressV     8-bit register address, as specified in the device datasheet.
+ * @tparam AccessV      Caching behaviour of the register (default is RegisterAccess::ReadWrite).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/RegisterMap.hpp>
+ *
+ * using WhoAmI = STM32::DeviceRegister<0x0F, STM32::RegisterAccess::ReadOnly>;
+ * using Ctrl1 = STM32::DeviceRegister<0x20>;
+ * using OutXL = STM32::DeviceRegister<0x28, STM32::RegisterAccess::Volatile>;
+ * @endcode
+ */
+template <std::uint8_t AddressV, RegisterAccess AccessV = RegisterAccess::ReadWrite>
+struct DeviceRegister {
+    static constexpr std::uint8_t address{AddressV};
+    static constexpr RegisterAccess access{AccessV};
+};
+
+/**
+ * @brief IsDeviceRegister, A concept to check if a type is a DeviceRegister.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/RegisterMap.hpp>
+ *
+ * static_assert(STM32::IsDeviceRegister<STM32::DeviceRegister<0x20>>);
+ * static_assert(!STM32::IsDeviceRegister<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsDeviceRegister =
+    requires {
+        { T::address } -> std::convertible_to<std::uint8_t>;
+        { T::access } -> std::convertible_to<RegisterAccess>;
+    };
+
+/**
+ * @brief IsRegisterBus, A concept to check if a type can transfer register bursts of a device.
+ *
+ * A register bus reads and writes a number of registers starting from an address,
+ * with the device incrementing the address after each register (auto-increment).
+ * max_bridge_length is the number of unrequested registers worth transferring
+ * to merge two bursts into one, i.e., the per-transaction overhead in bytes.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/RegisterMap.hpp>
+ *
+ * using I2cT = STM32::I2c<STM32::WorkingMode::Blocking, STM32_UNIQUE_TAG>;
+ * static_assert(STM32::IsRegisterBus<STM32::I2cRegisterBus<I2cT, STM32::I2cDeviceAddress<0x68>>>);
+ * static_assert(!STM32::IsRegisterBus<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsRegisterBus =
+    requires (T& bus, std::uint8_t address, std::span<std::uint8_t> rx, std::span<const std::uint8_t> tx) {
+        { T::max_bridge_length } -> std::convertible_to<std::size_t>;
+        { bus.Read(address, rx) } -> std::same_as<bool>;
+        { bus.Write(address, tx) } -> std::same_as<bool>;
+    };
+
+#if defined(HAL_I2C_MODULE_ENABLED)
+
+/**
+ * @class I2cRegisterBus, Register bursts of a device with 8-bit register addresses on an I2c.
+ *
+ * Bursts are blocking memory reads and writes on the I2C handle, independent of the
+ * working mode of the I2c.
+ *
+ * @tparam I2cT                 I2c type of the bus.
+ * @tparam DeviceAddressT       Device address (see I2cDeviceAddress).
+ * @tparam AutoIncrementFlagV   Register address bits requesting auto-increment on multi-register
+ *                              bursts (default is 0x00, e.g., 0x80 for many ST sensors).
+ * @tparam TimeoutT             Timeout of a burst (default is 100ms).
+ *
+ * @note I2cRegisterBus class is non-copyable and non-movable.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/RegisterMap.hpp>
+ *
+ * STM32::I2c<STM32::WorkingMode::Blocking, STM32_UNIQUE_TAG> i2c{hi2c1};
+ * STM32::I2cRegisterBus<decltype(i2c), STM32::I2cDeviceAddress<0x68>> imu_bus{i2c};
+ * @endcode
+ */
+template <
+    IsI2c I2cT,
+    IsI2cDeviceAddress DeviceAddressT,
+    std::uint8_t AutoIncrementFlagV = 0x00,
+    IsI2cTimeout TimeoutT = I2cTimeout<100>
+>
+class I2cRegisterBus {
+public:
+
+    /**
+     * @brief START, device address and register address precede each burst.
+     */
+    static constexpr std::size_t max_bridge_length{2};
+
+    /**
+     * @brief Construct I2cRegisterBus class.
+     *
+     * @param i2c       Reference to the I2c of the device.
+     */
+    explicit I2cRegisterBus(I2cT& i2c) noexcept
+      : m_i2c{i2c}
+    { }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    I2cRegisterBus(const I2cRegisterBus&) = delete;
+    I2cRegisterBus& operator=(const I2cRegisterBus&) = delete;
+    I2cRegisterBus(I2cRegisterBus&&) = delete;
+    I2cRegisterBus& operator=(I2cRegisterBus&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Read consecutive registers in one burst.
+     *
+     * @param address   Address of the first register.
+     * @param data      Destination of the registers.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Read(std::uint8_t address, std::span<std::uint8_t> data) noexcept
+    {
+        const auto size = __Internal::__ClampMessageLength<std::uint16_t>(data.size());
+        return __Internal::__Measure<InstrumentationProbe::I2cMemoryRead>(
+            m_i2c.GetHandle(), size, HAL_I2C_Mem_Read,
+            DeviceAddressT::value,
+            GetMemoryAddress(address, size),
+            std::to_underlying(I2cMemoryAddressSize::Bits8),
+            data.data(),
+            size,
+            TimeoutT::value
+        );
+    }
+
+    /**
+     * @brief Write consecutive registers in one burst.
+     *
+     * @param address   Address of the first register.
+     * @param data      Values of the registers.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Write(std::uint8_t address, std::span<const std::uint8_t> data) noexcept
+    {
+        const auto size = __Internal::__ClampMessageLength<std::uint16_t>(data.size());
+        return __Internal::__Measure<InstrumentationProbe::I2cMemoryWrite>(
+            m_i2c.GetHandle(), size, HAL_I2C_Mem_Write,
+            DeviceAddressT::value,
+            GetMemoryAddress(address, size),
+            std::to_underlying(I2cMemoryAddressSize::Bits8),
+            const_cast<std::uint8_t*>(data.data()),
+            size,
+            TimeoutT::value
+        );
+    }
+
+private:
+    static constexpr std::uint16_t GetMemoryAddress(std::uint8_t address, std::uint16_t size) noexcept
+    {
+        return static_cast<std::uint16_t>((size > 1) ? (address | AutoIncrementFlagV) : address);
+    }
+
+    I2cT& m_i2c;
+};
+
+#endif /* HAL_I2C_MODULE_ENABLED */
+
+#if defined(HAL_SPI_MODULE_ENABLED)
+
+/**
+ * @class SpiRegisterBus, Register bursts of a device with 8-bit register addresses on a Spi.
+ *
+ * Each burst applies the settings of the SpiDevice, selects it, transmits the
+ * register address byte and then transmits or receives the registers, in blocking mode.
+ *
+ * @tparam SpiT                 Spi type of the bus.
+ * @tparam ReadFlagV            Register address bits marking a read (default is 0x80).
+ * @tparam AutoIncrementFlagV   Register address bits requesting auto-increment on multi-register
+ *                              bursts (default is 0x00, e.g., 0x40 for many ST sensors).
+ * @tparam TimeoutT             Timeout of each transfer of a burst (default is 100ms).
+ *
+ * @note SpiRegisterBus class is non-copyable and non-movable.
+ * @note Devices without settings use the settings the SPI had when the bus was constructed.
+ * @note The Spi must not be shared with an SpiBus: the blocking bursts fail with
+ *       HAL_BUSY while a queued transfer is in flight and would reconfigure it.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/RegisterMap.hpp>
+ *
+ * STM32::Spi<STM32::WorkingMode::Blocking, STM32_UNIQUE_TAG> spi{hspi1};
+ * STM32::GpioOutput imu_cs{GPIOB, GPIO_PIN_5};
+ * STM32::SpiDevice imu{imu_cs, {
+ *     .baud_rate_prescaler = SPI_BAUDRATEPRESCALER_16,
+ *     .clock_polarity = SPI_POLARITY_HIGH,
+ *     .clock_phase = SPI_PHASE_2EDGE
+ * }};
+ * STM32::SpiRegisterBus<decltype(spi), 0x80, 0x40> imu_bus{spi, imu};
+ * @endcode
+ */
+template <
+    IsSpi SpiT,
+    std::uint8_t ReadFlagV = 0x80,
+    std::uint8_t AutoIncrementFlagV = 0x00,
+    IsSpiTimeout TimeoutT = SpiTimeout<100>
+>
+class SpiRegisterBus {
+public:
+
+    /**
+     * @brief Chip-select toggling and the register address byte precede each burst.
+     */
+    static constexpr std::size_t max_bridge_length{1};
+
+    /**
+     * @brief Construct SpiRegisterBus class.
+     *
+     * @param spi       Reference to the Spi of the device.
+     * @param device    Chip-select and transfer settings of the device.
+     *
+     * @note The current SPI settings become the settings of a device without its own.
+     */
+    SpiRegisterBus(SpiT& spi, SpiDevice& device) noexcept
+      : m_spi{spi},
+        m_device{device},
+        m_initial_settings{GetSettings(spi.GetHandle())}
+    { }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    SpiRegisterBus(const SpiRegisterBus&) = delete;
+    SpiRegisterBus& operator=(const SpiRegisterBus&) = delete;
+    SpiRegisterBus(SpiRegisterBus&&) = delete;
+    SpiRegisterBus& operator=(SpiRegisterBus&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Read consecutive registers in one burst.
+     *
+     * @param address   Address of the first register.
+     * @param data      Destination of the registers.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Read(std::uint8_t address, std::span<std::uint8_t> data) noexcept
+    {
+        const std::array<std::uint8_t, 1> header{GetHeader(address, data.size(), ReadFlagV)};
+        if (!Configure()) {
+            return false;
+        }
+        m_device.Select();
+        const bool is_succeeded =
+            m_spi.template Transmit<WorkingMode::Blocking, TimeoutT>(header) &&
+            m_spi.template ReceiveTo<WorkingMode::Blocking, TimeoutT>(data);
+        m_device.Deselect();
+        return is_succeeded;
+    }
+
+    /**
+     * @brief Write consecutive registers in one burst.
+     *
+     * @param address   Address of the first register.
+     * @param data      Values of the registers.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Write(std::uint8_t address, std::span<const std::uint8_t> data) noexcept
+    {
+        const std::array<std::uint8_t, 1> header{GetHeader(address, data.size(), 0x00)};
+        if (!Configure()) {
+            return false;
+        }
+        m_device.Select();
+        const bool is_succeeded =
+            m_spi.template Transmit<WorkingMode::Blocking, TimeoutT>(header) &&
+            m_spi.template Transmit<WorkingMode::Blocking, TimeoutT>(data);
+        m_device.Deselect();
+        return is_succeeded;
+    }
+
+private:
+    static constexpr std::uint8_t GetHeader(std::uint8_t address, std::size_t size, std::uint8_t flag) noexcept
+    {
+        return static_cast<std::uint8_t>(address | flag | ((size > 1) ? AutoIncrementFlagV : 0x00));
+    }
+
+    static SpiDeviceSettings GetSettings(const SPI_HandleTypeDef& handle) noexcept
+    {
+        return {
+            handle.Init.BaudRatePrescaler,
+            handle.Init.CLKPolarity,
+            handle.Init.CLKPhase,
+            handle.Init.FirstBit
+        };
+    }
+
+    /**
+     * @brief Apply the settings of the device, re-initializes the SPI only if they differ.
+     *
+     * @returns True on success, false otherwise.
+     */
+    bool Configure() noexcept
+    {
+        const auto settings = m_device.GetSettings().value_or(m_initial_settings);
+        auto& handle = m_spi.GetHandle();
+        if (settings == GetSettings(handle)) {
+            return true;
+        }
+        handle.Init.BaudRatePrescaler = settings.baud_rate_prescaler;
+        handle.Init.CLKPolarity = settings.clock_polarity;
+        handle.Init.CLKPhase = settings.clock_phase;
+        handle.Init.FirstBit = settings.first_bit;
+        return (HAL_OK == HAL_SPI_Init(&handle));
+    }
+
+    SpiT& m_spi;
+    SpiDevice& m_device;
+    const SpiDeviceSettings m_initial_settings;
+};
+
+#endif /* HAL_SPI_MODULE_ENABLED */
+
+namespace __Internal {
+
+struct __RegisterEntry {
+    std::uint8_t address;
+    RegisterAccess access;
+};
+
+template <IsDeviceRegister... RegistersT>
+inline constexpr auto __register_table = [](){
+    std::array<__RegisterEntry, sizeof...(RegistersT)> table{{
+        {RegistersT::address, RegistersT::access}...
+    }};
+    std::ranges::sort(table, {}, &__RegisterEntry::address);
+    return table;
+}();
+
+} /* namespace __Internal */
+
+/**
+ * @class RegisterMap, A RAM shadow of the registers of a device with burst transfers.
+ *
+ * Drivers touch the shadow instead of the bus:
+ * - Write() only marks a register dirty if its value changes, Flush() then writes
+ *   all dirty registers, coalescing adjacent ones into auto-increment bursts.
+ * - Read() serves cached ReadWrite and ReadOnly registers without bus traffic,
+ *   Fetch() reads several registers, coalescing adjacent ones into bursts.
+ *
+ * Two bursts separated by at most BusT::max_bridge_length registers are merged
+ * if the registers in between are safe to transfer again: clean cached ReadWrite
+ * registers for writes, non-Volatile registers without a pending write for reads.
+ * Bursts never cross an undeclared address, declare the reserved registers a burst
+ * may safely cover to merge more.
+ *
+ * @tparam BusT         Register bus of the device (I2cRegisterBus, SpiRegisterBus).
+ * @tparam RegistersT   Registers of the device (DeviceRegister), in any order.
+ *
+ * @note RegisterMap class is non-copyable and non-movable.
+ * @note The cache is only valid as long as the device is not reset behind its back,
+ *       call Invalidate() after resetting the device.
+ * @note Writes are deferred until Flush(), a Volatile (e.g., command) register
+ *       written several times before a Flush() is written once, with the last value.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/RegisterMap.hpp>
+ *
+ * using WhoAmI = STM32::DeviceRegister<0x0F, STM32::RegisterAccess::ReadOnly>;
+ * using Ctrl1 = STM32::DeviceRegister<0x20>;
+ * using Ctrl2 = STM32::DeviceRegister<0x21>;
+ * using Ctrl3 = STM32::DeviceRegister<0x22>;
+ * using Ctrl4 = STM32::DeviceRegister<0x23>;
+ * using OutXL = STM32::DeviceRegister<0x28, STM32::RegisterAccess::Volatile>;
+ * using OutXH = STM32::DeviceRegister<0x29, STM32::RegisterAccess::Volatile>;
+ *
+ * STM32::I2c<STM32::WorkingMode::Blocking, STM32_UNIQUE_TAG> i2c{hi2c1};
+ * STM32::I2cRegisterBus<decltype(i2c), STM32::I2cDeviceAddress<0x19>, 0x80> bus{i2c};
+ * STM32::RegisterMap<decltype(bus), WhoAmI, Ctrl1, Ctrl2, Ctrl3, Ctrl4, OutXL, OutXH> imu{bus};
+ *
+ * imu.Write<Ctrl1>(0x57);
+ * imu.Write<Ctrl4>(0x08);
+ * imu.Flush();                                 // One burst 0x20-0x23, Ctrl2 and Ctrl3 bridged if cached
+ *
+ * auto id = imu.Read<WhoAmI>();                // Bus read once, cached afterwards
+ * imu.Modify<Ctrl1>(0xF0, 0x70);               // Read-modify-write on the cache
+ * imu.Flush();
+ *
+ * if (imu.Fetch<OutXL, OutXH>()) {             // One burst 0x28-0x29
+ *     auto x = static_cast<std::int16_t>((imu.Peek<OutXH>() << 8) | imu.Peek<OutXL>());
+ * }
+ * @endcode
+ */
+template <IsRegisterBus BusT, IsDeviceRegister... RegistersT>
+class RegisterMap {
+    static constexpr auto& s_table = __Internal::__register_table<RegistersT...>;
+    static constexpr std::size_t s_register_count{sizeof...(RegistersT)};
+
+    static_assert(
+        s_register_count > 0,
+        "RegisterMap must have at least one register"
+    );
+    static_assert(
+        std::ranges::adjacent_find(s_table, {}, &__Internal::__RegisterEntry::address) == s_table.end(),
+        "RegisterMap register addresses must be unique"
+    );
+
+    template <typename RegisterT>
+    static constexpr bool s_is_member = (std::same_as<RegisterT, RegistersT> || ...);
+
+public:
+
+    /**
+     * @brief Construct RegisterMap class with an empty cache.
+     *
+     * @param bus       Reference to the register bus of the device.
+     */
+    explicit RegisterMap(BusT& bus) noexcept
+      : m_bus{bus}
+    { }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    RegisterMap(const RegisterMap&) = delete;
+    RegisterMap& operator=(const RegisterMap&) = delete;
+    RegisterMap(RegisterMap&&) = delete;
+    RegisterMap& operator=(RegisterMap&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Read a register, from the cache if possible.
+     *
+     * @tparam RegisterT    Register to read.
+     *
+     * @returns Value of the register (pending write value if written), std::nullopt if the bus read fails.
+     */
+    template <IsDeviceRegister RegisterT>
+    [[nodiscard]]
+    std::optional<std::uint8_t> Read() noexcept
+    requires s_is_member<RegisterT>
+    {
+        if (!Fetch<RegisterT>()) {
+            return std::nullopt;
+        }
+        return Peek<RegisterT>();
+    }
+
+    /**
+     * @brief Read registers that are not cached, coalescing adjacent ones into bursts.
+     *
+     * Volatile registers are always read, others only if they are not cached.
+     * Registers with a pending write keep their pending value.
+     *
+     * @tparam ReadRegistersT   Registers to read.
+     *
+     * @returns True on success, false if any burst fails.
+     */
+    template <IsDeviceRegister... ReadRegistersT>
+    bool Fetch() noexcept
+    requires (s_is_member<ReadRegistersT> && ...)
+    {
+        std::array<bool, s_register_count> is_requested{};
+        ((is_requested[GetIndex<ReadRegistersT>()] = true), ...);
+        return Transfer(
+            [&](std::size_t index){
+                return is_requested[index] && !m_is_dirty[index] &&
+                    ((s_table[index].access == RegisterAccess::Volatile) || !m_is_cached[index]);
+            },
+            [&](std::size_t index){
+                return (s_table[index].access != RegisterAccess::Volatile) && !m_is_dirty[index];
+            },
+            [&](std::size_t first, std::size_t last){
+                const bool is_succeeded = m_bus.Read(
+                    s_table[first].address,
+                    std::span{m_shadow}.subspan(first, last - first)
+                );
+                for (auto index = first; index < last; ++index) {
+                    m_is_cached[index] = is_succeeded && (s_table[index].access != RegisterAccess::Volatile);
+                }
+                return is_succeeded;
+            }
+        );
+    }
+
+    /**
+     * @brief Get the shadow value of a register without bus traffic.
+     *
+     * @tparam RegisterT    Register to get.
+     *
+     * @returns Last read, fetched or written value of the register.
+     */
+    template <IsDeviceRegister RegisterT>
+    [[nodiscard]]
+    std::uint8_t Peek() const noexcept
+    requires s_is_member<RegisterT>
+    {
+        return m_shadow[GetIndex<RegisterT>()];
+    }
+
+    /**
+     * @brief Write a register on the next Flush(), skipped if the cached value is unchanged.
+     *
+     * @tparam RegisterT    Register to write, must not be ReadOnly.
+     *
+     * @param value         Register value.
+     */
+    template <IsDeviceRegister RegisterT>
+    void Write(std::uint8_t value) noexcept
+    requires s_is_member<RegisterT> && (RegisterT::access != RegisterAccess::ReadOnly)
+    {
+        constexpr auto index = GetIndex<RegisterT>();
+        if (m_is_cached[index] && !m_is_dirty[index] && (m_shadow[index] == value)) {
+            return;
+        }
+        m_shadow[index] = value;
+        m_is_dirty[index] = true;
+    }
+
+    /**
+     * @brief Modify the masked bits of a register on the next Flush().
+     *
+     * The register is read first if it is not cached.
+     *
+     * @tparam RegisterT    Register to modify, must not be ReadOnly.
+     *
+     * @param mask          Bits to modify.
+     * @param bits          New values of the masked bits.
+     *
+     * @returns True on success, false if the bus read fails.
+     */
+    template <IsDeviceRegister RegisterT>
+    bool Modify(std::uint8_t mask, std::uint8_t bits) noexcept
+    requires s_is_member<RegisterT> && (RegisterT::access != RegisterAccess::ReadOnly)
+    {
+        const auto value = Read<RegisterT>();
+        if (!value) {
+            return false;
+        }
+        Write<RegisterT>(static_cast<std::uint8_t>((*value & ~mask) | (bits & mask)));
+        return true;
+    }
+
+    /**
+     * @brief Write all dirty registers, coalescing adjacent ones into bursts.
+     *
+     * @returns True on success, false if any burst fails (its registers stay dirty).
+     */
+    bool Flush() noexcept
+    {
+        return Transfer(
+            [&](std::size_t index){
+                return m_is_dirty[index];
+            },
+            [&](std::size_t index){
+                return (s_table[index].access == RegisterAccess::ReadWrite) && m_is_cached[index];
+            },
+            [&](std::size_t first, std::size_t last){
+                if (!m_bus.Write(
+                    s_table[first].address,
+                    std::span<const std::uint8_t>{m_shadow}.subspan(first, last - first)
+                )) {
+                    return false;
+                }
+                for (auto index = first; index < last; ++index) {
+                    m_is_dirty[index] = false;
+                    m_is_cached[index] = (s_table[index].access != RegisterAccess::Volatile);
+                }
+                return true;
+            }
+        );
+    }
+
+    /**
+     * @returns True if any register has a pending write.
+     */
+    [[nodiscard]]
+    bool IsDirty() const noexcept
+    {
+        return (std::ranges::find(m_is_dirty, true) != m_is_dirty.end());
+    }
+
+    /**
+     * @brief Drop the cache and the pending writes, e.g., after resetting the device.
+     */
+    void Invalidate() noexcept
+    {
+        m_is_cached.fill(false);
+        m_is_dirty.fill(false);
+    }
+
+private:
+    template <typename RegisterT>
+    static consteval std::size_t GetIndex() noexcept
+    {
+        return static_cast<std::size_t>(std::ranges::find(
+            s_table, RegisterT::address, &__Internal::__RegisterEntry::address
+        ) - s_table.begin());
+    }
+
+    static constexpr bool IsAdjacent(std::size_t index) noexcept
+    {
+        return (s_table[index].address == s_table[index - 1].address + 1);
+    }
+
+    /**
+     * @brief Transfer the needed registers in bursts of adjacent addresses,
+     *        bridging short gaps of bridgeable registers.
+     */
+    bool Transfer(auto is_needed, auto is_bridgeable, auto transfer) noexcept
+    {
+        bool is_succeeded{true};
+        std::size_t first{};
+        while (first < s_register_count) {
+            if (!is_needed(first)) {
+                ++first;
+                continue;
+            }
+            auto last = first + 1;
+            std::size_t bridge_length{};
+            for (auto index = last; (index < s_register_count) && IsAdjacent(index); ++index) {
+                if (is_needed(index)) {
+                    last = index + 1;
+                    bridge_length = 0;
+                } else if (!is_bridgeable(index) || (++bridge_length > BusT::max_bridge_length)) {
+                    break;
+                }
+            }
+            is_succeeded = transfer(first, last) && is_succeeded;
+            first = last;
+        }
+        return is_succeeded;
+    }
+
+    BusT& m_bus;
+    std::array<std::uint8_t, s_register_count> m_shadow{};
+    std::array<bool, s_register_count> m_is_cached{};
+    std::array<bool, s_register_count> m_is_dirty{};
+};
+
+} /* namespace STM32 */
+
+#endif /* STM32_REGISTER_MAP_HPP */
@@ -8,6 +8,18 @@
 
 namespace STM32 {
 
+/**
+ * @typedef ServoConfig, PWM configuration of standard hobby servos.
+ *
+ * Input range is 0-180 degrees (default 90 degrees), mapped to 2.5% - 12% duty cycle.
+ * Use it for servos driven by PwmGroup (e.g., with PwmTrajectory).
+ */
+using ServoConfig = PwmConfig<
+    PwmDutyCycleRange<2.5, 12.>,
+    PwmInputRange<0, 180, 90>,
+    PwmInputRangeMax<0, 180>
+>;
+
 /**
  * @typedef Servo, Pre-configured PWM class for standard servo motor control.
  * 
@@ -32,13 +44,7 @@ namespace STM32 {
  * auto pos = servo.Get();  // Read current position
  * @endcode
  */
-using Servo = Pwm<
-    PwmConfig<
-        PwmDutyCycleRange<2.5, 12.>,
-        PwmInputRange<0, 180, 90>,
-        PwmInputRangeMax<0, 180>
-    >
->;
+using Servo = Pwm<ServoConfig>;
 
 } /* namespace STM32 */
 
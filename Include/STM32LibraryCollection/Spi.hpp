@@ -5,12 +5,19 @@
 #define STM32_SPI_HPP
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
 #include <concepts>
+#include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <optional>
 #include <ranges>
 
 #include "Config.hpp"
+#include "EventQueue.hpp"
+#include "Gpio.hpp"
 #include "__Internal/__Utility.hpp"
 
 #include "main.h"
@@ -95,6 +102,222 @@ concept IsSpiTimeout =
 template <typename T>
 concept IsSpiMessage = __Internal::__IsMessage<T, std::uint8_t>;
 
+/**
+ * @brief IsSpi, A concept to check if a type is a Spi.
+ * 
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Spi.hpp>
+ * 
+ * static_assert(STM32::IsSpi<STM32::Spi<STM32::WorkingMode::DMA, STM32_UNIQUE_TAG>>);
+ * static_assert(!STM32::IsSpi<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsSpi =
+    IsWorkingMode<typename T::DefaultWorkingModeT> &&
+    requires (T& spi) {
+        { spi.GetHandle() } -> std::same_as<SPI_HandleTypeDef&>;
+    };
+
+/**
+ * @struct SpiBusCapacity, A utility struct to hold the SPI bus transaction queue capacity.
+ * 
+ * @tparam CapacityV    Maximum number of queued transactions (must be a power of two).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Spi.hpp>
+ *
+ * using MyBusCapacity = STM32::SpiBusCapacity<16>;
+ * @endcode
+ */
+template <std::size_t CapacityV>
+struct SpiBusCapacity : __Internal::__Constant<std::size_t, CapacityV> {
+    static_assert(
+        std::has_single_bit(CapacityV),
+        "Capacity must be a power of two"
+    );
+};
+
+/**
+ * @brief IsSpiBusCapacity, A concept to check if a type is a SpiBusCapacity.
+ * 
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Spi.hpp>
+ * 
+ * static_assert(STM32::IsSpiBusCapacity<STM32::SpiBusCapacity<8>>);
+ * static_assert(!STM32::IsSpiBusCapacity<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsSpiBusCapacity =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t> &&
+    std::has_single_bit(T::value);
+
+/**
+ * @namespace SpiChipSelect, Tag types for the chip-select behaviour after a bus transaction.
+ */
+namespace SpiChipSelect {
+
+/**
+ * @struct Release, Tag to deassert the chip-select line when the transaction completes.
+ */
+struct Release {};
+
+/**
+ * @struct Hold, Tag to keep the chip-select line asserted for the next transaction of the same device.
+ * 
+ * Use this tag to batch several transactions into one device frame
+ * (e.g., a flash command followed by its data phase).
+ */
+struct Hold {};
+
+} /* namespace SpiChipSelect */
+
+/**
+ * @brief IsSpiChipSelect, A concept to check if a type is a SpiChipSelect.
+ * 
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Spi.hpp>
+ * 
+ * static_assert(STM32::IsSpiChipSelect<STM32::SpiChipSelect::Hold>);
+ * static_assert(!STM32::IsSpiChipSelect<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsSpiChipSelect =
+    std::same_as<T, SpiChipSelect::Release> ||
+    std::same_as<T, SpiChipSelect::Hold>;
+
+/**
+ * @struct SpiDeviceSettings, Transfer settings of a device on a shared SPI bus.
+ * 
+ * Values are the HAL SPI_InitTypeDef constants of the respective fields.
+ * 
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Spi.hpp>
+ *
+ * // SPI mode 3, bus clock / 16
+ * constexpr STM32::SpiDeviceSettings imu_settings{
+ *     .baud_rate_prescaler = SPI_BAUDRATEPRESCALER_16,
+ *     .clock_polarity = SPI_POLARITY_HIGH,
+ *     .clock_phase = SPI_PHASE_2EDGE
+ * };
+ * @endcode
+ */
+struct SpiDeviceSettings {
+    std::uint32_t baud_rate_prescaler{SPI_BAUDRATEPRESCALER_2};
+    std::uint32_t clock_polarity{SPI_POLARITY_LOW};
+    std::uint32_t clock_phase{SPI_PHASE_1EDGE};
+    std::uint32_t first_bit{SPI_FIRSTBIT_MSB};
+
+    friend constexpr bool operator==(const SpiDeviceSettings&, const SpiDeviceSettings&) = default;
+};
+
+/**
+ * @class SpiDevice, A device on a shared SPI bus, see SpiBus.
+ * 
+ * Binds the chip-select output of a device to its transfer settings.
+ * The chip-select line is active low.
+ * 
+ * @note SpiDevice class is non-copyable and non-movable.
+ * @note Devices without settings use the settings the SPI has been initialized with (CubeMX).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Spi.hpp>
+ *
+ * STM32::GpioOutput flash_cs{GPIOB, GPIO_PIN_6};
+ * STM32::GpioOutput display_cs{GPIOB, GPIO_PIN_7};
+ *
+ * STM32::SpiDevice flash{flash_cs};
+ * STM32::SpiDevice display{display_cs, {.baud_rate_prescaler = SPI_BAUDRATEPRESCALER_4}};
+ * @endcode
+ */
+class SpiDevice {
+public:
+
+    /**
+     * @brief Construct SpiDevice class with the initial bus settings, deasserts chip-select.
+     * 
+     * @param chip_select   Chip-select output of the device.
+     */
+    explicit SpiDevice(GpioOutput& chip_select) noexcept
+      : m_chip_select{chip_select}
+    {
+        Deselect();
+    }
+
+    /**
+     * @brief Construct SpiDevice class with its own settings, deasserts chip-select.
+     * 
+     * @param chip_select   Chip-select output of the device.
+     * @param settings      Transfer settings applied before each transaction of the device.
+     */
+    SpiDevice(GpioOutput& chip_select, const SpiDeviceSettings& settings) noexcept
+      : m_chip_select{chip_select},
+        m_settings{settings}
+    {
+        Deselect();
+    }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    SpiDevice(const SpiDevice&) = delete;
+    SpiDevice& operator=(const SpiDevice&) = delete;
+    SpiDevice(SpiDevice&&) = delete;
+    SpiDevice& operator=(SpiDevice&&) = delete;
+    /** @} */
+
+    /**
+     * @returns Transfer settings of the device, std::nullopt for the initial bus settings.
+     */
+    [[nodiscard]]
+    const std::optional<SpiDeviceSettings>& GetSettings() const noexcept
+    {
+        return m_settings;
+    }
+
+    /**
+     * @brief Assert chip-select (drive low).
+     */
+    void Select() noexcept
+    {
+        m_chip_select.Low();
+    }
+
+    /**
+     * @brief Deassert chip-select (drive high).
+     */
+    void Deselect() noexcept
+    {
+        m_chip_select.High();
+    }
+
+private:
+    GpioOutput& m_chip_select;
+    std::optional<SpiDeviceSettings> m_settings{};
+};
+
+template <
+    IsSpi SpiT,
+    IsSpiBusCapacity CapacityT = SpiBusCapacity<8>
+>
+class SpiBus;
+
 /**
  * @class Spi, A class to manage SPI functionality on STM32 microcontrollers.
  * 
@@ -110,7 +333,10 @@ concept IsSpiMessage = __Internal::__IsMessage<T, std::uint8_t>;
  *                              UniqueTagT must be STM32_UNIQUE_TAG.
  *
  * @note Spi class is non-copyable and non-movable.
- * @note CS/NSS pin management is the user's responsibility (manual GPIO or hardware NSS).
+ * @note At most STM32_CALLBACK_INSTANCE_CAPACITY (default is 4) Spi instances may exist at the same time,
+ *       constructing one more calls STM32_CALLBACK_INSTANCE_OVERFLOW() (default is Error_Handler()).
+ * @note CS/NSS pin management is the user's responsibility (manual GPIO or hardware NSS),
+ *       or use SpiBus to share one SPI between several devices.
  *
  * @example Usage:
  * @code {.cpp}
@@ -148,19 +374,34 @@ concept IsSpiMessage = __Internal::__IsMessage<T, std::uint8_t>;
  */
 template <IsWorkingMode WorkingModeT, __Internal::__IsUniqueTag UniqueTagT>
 class Spi {
-    using TransmitCompleteCallbackT = __Internal::__CallbackManager<
-        SPI_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
-        HAL_SPI_RegisterCallback, HAL_SPI_UnRegisterCallback, HAL_SPI_TX_COMPLETE_CB_ID
+    using TransmitCompleteCallbackT = __Internal::__InstanceCallbackManager<
+        SPI_HandleTypeDef,
+        HAL_SPI_RegisterCallback, HAL_SPI_UnRegisterCallback, HAL_SPI_TX_COMPLETE_CB_ID,
+        __Internal::__ProbeComplete<InstrumentationProbe::SpiTransmit>,
+        __Internal::__HalTransmittedLength<SPI_HandleTypeDef>
+    >;
+    using ReceiveCompleteCallbackT = __Internal::__InstanceCallbackManager<
+        SPI_HandleTypeDef,
+        HAL_SPI_RegisterCallback, HAL_SPI_UnRegisterCallback, HAL_SPI_RX_COMPLETE_CB_ID,
+        __Internal::__ProbeComplete<InstrumentationProbe::SpiReceive>,
+        __Internal::__HalReceivedLength<SPI_HandleTypeDef>
     >;
-    using ReceiveCompleteCallbackT = __Internal::__CallbackManager<
-        SPI_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
-        HAL_SPI_RegisterCallback, HAL_SPI_UnRegisterCallback, HAL_SPI_RX_COMPLETE_CB_ID
+    using TransmitReceiveCompleteCallbackT = __Internal::__InstanceCallbackManager<
+        SPI_HandleTypeDef,
+        HAL_SPI_RegisterCallback, HAL_SPI_UnRegisterCallback, HAL_SPI_TX_RX_COMPLETE_CB_ID,
+        __Internal::__ProbeComplete<InstrumentationProbe::SpiTransmitReceive>,
+        __Internal::__HalReceivedLength<SPI_HandleTypeDef>
     >;
-    using TransmitReceiveCompleteCallbackT = __Internal::__CallbackManager<
-        SPI_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
-        HAL_SPI_RegisterCallback, HAL_SPI_UnRegisterCallback, HAL_SPI_TX_RX_COMPLETE_CB_ID
+    using ErrorCallbackT = __Internal::__InstanceCallbackManager<
+        SPI_HandleTypeDef,
+        HAL_SPI_RegisterCallback, HAL_SPI_UnRegisterCallback, HAL_SPI_ERROR_CB_ID,
+        nullptr, __Internal::__HalErrorCode<SPI_HandleTypeDef>
     >;
+
+    template <IsSpi, IsSpiBusCapacity>
+    friend class SpiBus;
 public:
+    using DefaultWorkingModeT = WorkingModeT;
 
     /**
      * @brief Construct Spi class.
@@ -173,7 +414,8 @@ public:
       : m_handle{handle},
         m_transmit_complete_callback{handle},
         m_receive_complete_callback{handle},
-        m_transmit_receive_complete_callback{handle}
+        m_transmit_receive_complete_callback{handle},
+        m_error_callback{handle}
     { }
 
     /**
@@ -225,12 +467,13 @@ public:
     ) noexcept
     requires std::same_as<RxWorkingModeT, WorkingMode::Blocking>
     {
-        return (HAL_OK == HAL_SPI_Receive(
-            &m_handle,
+        const auto size = __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message));
+        return __Internal::__Measure<InstrumentationProbe::SpiReceive>(
+            m_handle, size, HAL_SPI_Receive,
             std::ranges::data(rx_message),
-            __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message)),
+            size,
             TimeoutV::value
-        ));
+        );
     }
 
     /**
@@ -257,19 +500,34 @@ public:
         m_receive_complete_callback.Set(
             std::move(complete_callback)
         );
-        if constexpr (std::same_as<RxWorkingModeT, WorkingMode::Interrupt>) {
-            return (HAL_OK == HAL_SPI_Receive_IT(
-                &m_handle,
-                std::ranges::data(rx_message),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message))
-            ));
-        } else if constexpr (std::same_as<RxWorkingModeT, WorkingMode::DMA>) {
-            return (HAL_OK == HAL_SPI_Receive_DMA(
-                &m_handle,
-                std::ranges::data(rx_message),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message))
-            ));
-        }
+        return StartReceive<RxWorkingModeT>(rx_message);
+    }
+
+    /**
+     * @brief Receive data into the provided buffer in non-blocking mode, reporting the received length.
+     * 
+     * @tparam RxWorkingModeT   Working mode for receiving (default is WorkingModeT).
+     * 
+     * @param rx_message        A contiguous range to store the received data.
+     * @param complete_callback Callback function to be called upon completion with the received byte count.
+     * 
+     * @returns True on success, false otherwise.
+     * 
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     */
+    template <
+        IsWorkingMode RxWorkingModeT = WorkingModeT
+    >
+    bool ReceiveTo(
+        IsSpiMessage auto& rx_message,
+        EventCallbackT<std::uint16_t>&& complete_callback
+    ) noexcept
+    requires (!std::same_as<RxWorkingModeT, WorkingMode::Blocking>)
+    {
+        m_receive_complete_callback.Set(
+            std::move(complete_callback)
+        );
+        return StartReceive<RxWorkingModeT>(rx_message);
     }
 
     /* ======================== Transmit Operations ======================== */
@@ -295,12 +553,13 @@ public:
     ) noexcept
     requires std::same_as<TxWorkingModeT, WorkingMode::Blocking>
     {
-        return (HAL_OK == HAL_SPI_Transmit(
-            &m_handle,
+        const auto size = __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message));
+        return __Internal::__Measure<InstrumentationProbe::SpiTransmit>(
+            m_handle, size, HAL_SPI_Transmit,
             const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
-            __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message)),
+            size,
             TimeoutV::value
-        ));
+        );
     }
 
     /**
@@ -327,19 +586,34 @@ public:
         m_transmit_complete_callback.Set(
             std::move(complete_callback)
         );
-        if constexpr (std::same_as<TxWorkingModeT, WorkingMode::Interrupt>) {
-            return (HAL_OK == HAL_SPI_Transmit_IT(
-                &m_handle,
-                const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message))
-            ));
-        } else if constexpr (std::same_as<TxWorkingModeT, WorkingMode::DMA>) {
-            return (HAL_OK == HAL_SPI_Transmit_DMA(
-                &m_handle,
-                const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message))
-            ));
-        }
+        return StartTransmit<TxWorkingModeT>(tx_message);
+    }
+
+    /**
+     * @brief Transmit data from the provided buffer in non-blocking mode, reporting the transmitted length.
+     * 
+     * @tparam TxWorkingModeT    Working mode for transmitting (default is WorkingModeT).
+     * 
+     * @param tx_message         A contiguous range containing the data to transmit.
+     * @param complete_callback  Callback function to be called upon completion with the transmitted byte count.
+     * 
+     * @returns True on success, false otherwise.
+     * 
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     */
+    template <
+        IsWorkingMode TxWorkingModeT = WorkingModeT
+    >
+    bool Transmit(
+        const IsSpiMessage auto& tx_message,
+        EventCallbackT<std::uint16_t>&& complete_callback
+    ) noexcept
+    requires (!std::same_as<TxWorkingModeT, WorkingMode::Blocking>)
+    {
+        m_transmit_complete_callback.Set(
+            std::move(complete_callback)
+        );
+        return StartTransmit<TxWorkingModeT>(tx_message);
     }
 
     /* ==================== Transmit-Receive Operations ==================== */
@@ -376,13 +650,13 @@ public:
         const auto size = __Internal::__ClampMessageLength<std::uint16_t>(
             std::min(std::ranges::size(tx_message), std::ranges::size(rx_message))
         );
-        return (HAL_OK == HAL_SPI_TransmitReceive(
-            &m_handle,
+        return __Internal::__Measure<InstrumentationProbe::SpiTransmitReceive>(
+            m_handle, size, HAL_SPI_TransmitReceive,
             const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
             std::ranges::data(rx_message),
             size,
             TimeoutV::value
-        ));
+        );
     }
 
     /**
@@ -417,31 +691,709 @@ public:
         m_transmit_receive_complete_callback.Set(
             std::move(complete_callback)
         );
+        return StartTransmitReceive<TxRxWorkingModeT>(tx_message, rx_message);
+    }
+
+    /**
+     * @brief Simultaneously transmit and receive data in non-blocking mode, reporting the received length.
+     * 
+     * This is full-duplex SPI operation: data is transmitted from tx_message
+     * while simultaneously receiving into rx_message.
+     * 
+     * @tparam TxRxWorkingModeT Working mode for the operation (default is WorkingModeT).
+     * 
+     * @param tx_message        A contiguous range containing the data to transmit.
+     * @param rx_message        A contiguous range to store the received data.
+     * @param complete_callback Callback function to be called upon completion with the received byte count.
+     * 
+     * @returns True on success, false otherwise.
+     * 
+     * @note tx_message and rx_message must have the same size. The smaller size
+     *       is used if they differ.
+     * 
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     */
+    template <
+        IsWorkingMode TxRxWorkingModeT = WorkingModeT
+    >
+    bool TransmitReceive(
+        const IsSpiMessage auto& tx_message,
+        IsSpiMessage auto& rx_message,
+        EventCallbackT<std::uint16_t>&& complete_callback
+    ) noexcept
+    requires (!std::same_as<TxRxWorkingModeT, WorkingMode::Blocking>)
+    {
+        m_transmit_receive_complete_callback.Set(
+            std::move(complete_callback)
+        );
+        return StartTransmitReceive<TxRxWorkingModeT>(tx_message, rx_message);
+    }
+
+    /**
+     * @brief Set the callback invoked when a non-blocking operation fails.
+     * 
+     * @param error_callback    Callback function receiving the HAL error code.
+     * 
+     * @returns True on success, false if the error callback is already owned
+     *          (e.g., by a SpiBus or an AsyncTransfer()).
+     */
+    bool SetErrorCallback(EventCallbackT<std::uint32_t>&& error_callback) noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        if (m_error_callback.IsSet()) {
+            return false;
+        }
+        m_error_callback.Set([error_callback = std::move(error_callback)](std::uint32_t error_code) {
+            error_callback(error_code);
+        });
+        return true;
+    }
+
+    /**
+     * @brief Clear the callback set by SetErrorCallback().
+     */
+    void ClearErrorCallback() noexcept
+    {
+        m_error_callback.Clear();
+    }
+
+    /**
+     * @returns Directions of the non-blocking transfer running, read from the HAL state.
+     */
+    [[nodiscard]]
+    TransferDirection GetBusyDirection() const noexcept
+    {
+        if (m_handle.State == HAL_SPI_STATE_BUSY_TX) {
+            return TransferDirection::Transmit;
+        }
+        if (m_handle.State == HAL_SPI_STATE_BUSY_RX) {
+            return TransferDirection::Receive;
+        }
+        if (m_handle.State == HAL_SPI_STATE_BUSY_TX_RX) {
+            return TransferDirection::Both;
+        }
+        return TransferDirection::None;
+    }
+
+    /**
+     * @brief Abort the non-blocking transfer with HAL_SPI_Abort() and clear the complete callbacks.
+     * 
+     * @param direction     Directions to abort, SPI runs one transfer so any direction aborts it.
+     * 
+     * @returns True on success, false otherwise.
+     */
+    bool AbortTransfer(TransferDirection direction) noexcept
+    {
+        if (direction == TransferDirection::None) {
+            return true;
+        }
+        const auto status = HAL_SPI_Abort(&m_handle);
+        m_transmit_complete_callback.Clear();
+        m_receive_complete_callback.Clear();
+        m_transmit_receive_complete_callback.Clear();
+        return (HAL_OK == status);
+    }
+
+    /**
+     * @brief Run the completion and error callbacks from an event queue instead of interrupt context.
+     *
+     * @tparam PriorityV    Priority of the posted callbacks (default is EventPriority::Normal).
+     *
+     * @param queue         Event queue to post the callbacks to (see EventQueue).
+     *
+     * @note If the queue is full or STM32_CALLBACK_DEFER_CAPACITY replaced callbacks are pending,
+     *       a callback runs in interrupt context.
+     * @note A SpiBus on this Spi then starts its next transaction from the queue.
+     */
+    template <EventPriority PriorityV = EventPriority::Normal, IsEventQueue QueueT>
+    void SetCompletionQueue(QueueT& queue) noexcept
+    {
+        m_transmit_complete_callback.Defer<PriorityV>(queue);
+        m_receive_complete_callback.Defer<PriorityV>(queue);
+        m_transmit_receive_complete_callback.Defer<PriorityV>(queue);
+        m_error_callback.Defer<PriorityV>(queue);
+    }
+
+    /**
+     * @brief Run the completion and error callbacks in interrupt context again.
+     */
+    void ClearCompletionQueue() noexcept
+    {
+        m_transmit_complete_callback.ClearDefer();
+        m_receive_complete_callback.ClearDefer();
+        m_transmit_receive_complete_callback.ClearDefer();
+        m_error_callback.ClearDefer();
+    }
+
+private:
+    SPI_HandleTypeDef& m_handle;
+    TransmitCompleteCallbackT m_transmit_complete_callback;
+    ReceiveCompleteCallbackT m_receive_complete_callback;
+    TransmitReceiveCompleteCallbackT m_transmit_receive_complete_callback;
+    ErrorCallbackT m_error_callback;
+
+    /**
+     * @brief Start a non-blocking reception into the provided buffer.
+     * 
+     * @tparam RxWorkingModeT   Working mode for receiving (Interrupt or DMA).
+     * 
+     * @param rx_message        A contiguous range to store the received data.
+     * 
+     * @returns True on success, false otherwise.
+     */
+    template <IsWorkingMode RxWorkingModeT>
+    bool StartReceive(
+        IsSpiMessage auto& rx_message
+    ) noexcept
+    {
+        if constexpr (std::same_as<RxWorkingModeT, WorkingMode::Interrupt>) {
+            const auto size = __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message));
+            return __Internal::__Measure<InstrumentationProbe::SpiReceive, __Internal::__ProbeBytes::OnComplete>(
+                m_handle, size, HAL_SPI_Receive_IT,
+                std::ranges::data(rx_message),
+                size
+            );
+        } else if constexpr (std::same_as<RxWorkingModeT, WorkingMode::DMA>) {
+            const auto size = __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message));
+            return __Internal::__Measure<InstrumentationProbe::SpiReceive, __Internal::__ProbeBytes::OnComplete>(
+                m_handle, size, HAL_SPI_Receive_DMA,
+                std::ranges::data(rx_message),
+                size
+            );
+        }
+    }
+
+    /**
+     * @brief Start a non-blocking transmission of the provided buffer.
+     * 
+     * @tparam TxWorkingModeT    Working mode for transmitting (Interrupt or DMA).
+     * 
+     * @param tx_message         A contiguous range containing the data to transmit.
+     * 
+     * @returns True on success, false otherwise.
+     */
+    template <IsWorkingMode TxWorkingModeT>
+    bool StartTransmit(
+        const IsSpiMessage auto& tx_message
+    ) noexcept
+    {
+        if constexpr (std::same_as<TxWorkingModeT, WorkingMode::Interrupt>) {
+            const auto size = __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message));
+            return __Internal::__Measure<InstrumentationProbe::SpiTransmit, __Internal::__ProbeBytes::OnComplete>(
+                m_handle, size, HAL_SPI_Transmit_IT,
+                const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
+                size
+            );
+        } else if constexpr (std::same_as<TxWorkingModeT, WorkingMode::DMA>) {
+            const auto size = __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message));
+            return __Internal::__Measure<InstrumentationProbe::SpiTransmit, __Internal::__ProbeBytes::OnComplete>(
+                m_handle, size, HAL_SPI_Transmit_DMA,
+                const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
+                size
+            );
+        }
+    }
+
+    /**
+     * @brief Start a non-blocking full-duplex transfer.
+     * 
+     * @tparam TxRxWorkingModeT Working mode for the operation (Interrupt or DMA).
+     * 
+     * @param tx_message        A contiguous range containing the data to transmit.
+     * @param rx_message        A contiguous range to store the received data.
+     * 
+     * @returns True on success, false otherwise.
+     */
+    template <IsWorkingMode TxRxWorkingModeT>
+    bool StartTransmitReceive(
+        const IsSpiMessage auto& tx_message,
+        IsSpiMessage auto& rx_message
+    ) noexcept
+    {
         const auto size = __Internal::__ClampMessageLength<std::uint16_t>(
             std::min(std::ranges::size(tx_message), std::ranges::size(rx_message))
         );
         if constexpr (std::same_as<TxRxWorkingModeT, WorkingMode::Interrupt>) {
-            return (HAL_OK == HAL_SPI_TransmitReceive_IT(
-                &m_handle,
+            return __Internal::__Measure<InstrumentationProbe::SpiTransmitReceive, __Internal::__ProbeBytes::OnComplete>(
+                m_handle, size, HAL_SPI_TransmitReceive_IT,
                 const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
                 std::ranges::data(rx_message),
                 size
-            ));
+            );
         } else if constexpr (std::same_as<TxRxWorkingModeT, WorkingMode::DMA>) {
-            return (HAL_OK == HAL_SPI_TransmitReceive_DMA(
-                &m_handle,
+            return __Internal::__Measure<InstrumentationProbe::SpiTransmitReceive, __Internal::__ProbeBytes::OnComplete>(
+                m_handle, size, HAL_SPI_TransmitReceive_DMA,
                 const_cast<std::uint8_t*>(std::ranges::data(tx_message)),
                 std::ranges::data(rx_message),
                 size
-            ));
+            );
+        }
+    }
+};
+
+/**
+ * @class SpiBus, A bounded, allocation-free transaction queue for devices sharing a non-blocking Spi.
+ * 
+ * Owns chip-select handling and per-device transfer settings of every SpiDevice on
+ * the bus. Each transaction is started directly from the TX/RX/TX_RX complete (or error)
+ * interrupt of the previous one: chip-select of the finished device is deasserted,
+ * the settings of the next device are applied and its chip-select is asserted in the
+ * same interrupt, so the bus does not wait for the main loop between transfers.
+ * Buffers are never copied, each transfer runs in place.
+ * 
+ * Transactions queued with SpiChipSelect::Hold keep chip-select asserted, so that
+ * consecutive transactions of the same device form a single frame. Chip-select is
+ * deasserted before a transaction of another device starts, or when a transaction fails.
+ * 
+ * @tparam SpiT         Spi type to operate on (WorkingMode::Interrupt or WorkingMode::DMA).
+ * @tparam CapacityT    Maximum number of queued transactions (default is 8).
+ * 
+ * @note SpiBus class is non-copyable and non-movable.
+ * @note Queued buffers must stay valid until their completion callback is called.
+ * @note Transmit()/ReceiveTo()/TransmitReceive() must be called from a single context:
+ *       either the main loop, or completion callbacks, with lower priority than the SPI
+ *       and DMA interrupts.
+ * @note Settings are applied with HAL_SPI_Init() only when they differ from the
+ *       previous transaction, devices with equal settings switch without reconfiguration.
+ * @note Do not call Spi operations in non-blocking mode directly while the bus exists,
+ *       the bus owns their completion callbacks.
+ * 
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Spi.hpp>
+ *
+ * SPI_HandleTypeDef hspi1; // Assume this is properly initialized elsewhere, TX/RX DMA enabled.
+ *
+ * STM32::GpioOutput imu_cs{GPIOB, GPIO_PIN_5};
+ * STM32::GpioOutput flash_cs{GPIOB, GPIO_PIN_6};
+ *
+ * STM32::Spi<STM32::WorkingMode::DMA, STM32_UNIQUE_TAG> spi{hspi1};
+ * STM32::SpiBus bus{spi};
+ *
+ * STM32::SpiDevice imu{imu_cs, {
+ *     .baud_rate_prescaler = SPI_BAUDRATEPRESCALER_16,
+ *     .clock_polarity = SPI_POLARITY_HIGH,
+ *     .clock_phase = SPI_PHASE_2EDGE
+ * }};
+ * STM32::SpiDevice flash{flash_cs};
+ *
+ * std::array<std::uint8_t, 7> imu_tx{0x3B | 0x80};
+ * std::array<std::uint8_t, 7> imu_rx{};
+ * std::array<std::uint8_t, 4> read_command{0x03, 0x00, 0x10, 0x00};
+ * std::array<std::uint8_t, 256> page{};
+ *
+ * // All three transactions run back-to-back from the completion interrupts
+ * bus.TransmitReceive(imu, imu_tx, imu_rx, [](bool is_successful){ });
+ * bus.Transmit<STM32::SpiChipSelect::Hold>(flash, read_command);
+ * bus.ReceiveTo(flash, page, [](bool is_successful){ });
+ * @endcode
+ */
+template <IsSpi SpiT, IsSpiBusCapacity CapacityT>
+class SpiBus {
+    using WorkingModeT = typename SpiT::DefaultWorkingModeT;
+    static_assert(
+        !std::same_as<WorkingModeT, WorkingMode::Blocking>,
+        "SpiBus requires a Spi in WorkingMode::Interrupt or WorkingMode::DMA"
+    );
+
+    /**
+     * @struct Transaction, Descriptor of a queued bus transaction.
+     * 
+     * Transmit-only transactions have no rx_data, receive-only ones have no tx_data.
+     */
+    struct Transaction {
+        SpiDevice* device;
+        const std::uint8_t* tx_data;
+        std::uint8_t* rx_data;
+        std::uint16_t size;
+        bool is_held;
+    };
+public:
+
+    /**
+     * @brief Construct SpiBus class.
+     * 
+     * @param spi       Reference to the Spi to operate on.
+     * 
+     * @note Takes over the complete and error callbacks of spi.
+     * @note The current SPI settings become the settings of devices without their own.
+     */
+    explicit SpiBus(SpiT& spi) noexcept
+      : m_spi{spi},
+        m_initial_settings{
+            spi.GetHandle().Init.BaudRatePrescaler,
+            spi.GetHandle().Init.CLKPolarity,
+            spi.GetHandle().Init.CLKPhase,
+            spi.GetHandle().Init.FirstBit
+        },
+        m_active_settings{m_initial_settings}
+    {
+        m_spi.m_transmit_complete_callback.Set([this](){
+            OnTransactionComplete(true);
+        });
+        m_spi.m_receive_complete_callback.Set([this](){
+            OnTransactionComplete(true);
+        });
+        m_spi.m_transmit_receive_complete_callback.Set([this](){
+            OnTransactionComplete(true);
+        });
+        m_spi.m_error_callback.Set([this]([[maybe_unused]] std::uint32_t error_code){
+            OnTransactionComplete(false);
+        });
+    }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    SpiBus(const SpiBus&) = delete;
+    SpiBus& operator=(const SpiBus&) = delete;
+    SpiBus(SpiBus&&) = delete;
+    SpiBus& operator=(SpiBus&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy SpiBus class, aborts pending transactions.
+     */
+    ~SpiBus()
+    {
+        Clear();
+        m_spi.m_transmit_complete_callback.Clear();
+        m_spi.m_receive_complete_callback.Clear();
+        m_spi.m_transmit_receive_complete_callback.Clear();
+        m_spi.m_error_callback.Clear();
+    }
+
+    /**
+     * @returns Maximum number of queued transactions.
+     */
+    [[nodiscard]]
+    static constexpr std::size_t Capacity() noexcept
+    {
+        return CapacityT::value;
+    }
+
+    /**
+     * @returns Number of queued transactions, including the one in flight.
+     */
+    [[nodiscard]]
+    std::size_t Size() const noexcept
+    {
+        return m_entries.Size();
+    }
+
+    /**
+     * @returns True if no transaction is queued.
+     */
+    [[nodiscard]]
+    bool IsEmpty() const noexcept
+    {
+        return m_entries.IsEmpty();
+    }
+
+    /**
+     * @returns True if no more transactions can be queued.
+     */
+    [[nodiscard]]
+    bool IsFull() const noexcept
+    {
+        return m_entries.IsFull();
+    }
+
+    /**
+     * @brief Queue a transmit-only transaction.
+     * 
+     * @tparam ChipSelectT          Chip-select behaviour after the transaction
+     *                              (default is SpiChipSelect::Release).
+     * 
+     * @param device                Device to transmit to.
+     * @param tx_message            A contiguous range containing the data to transmit.
+     * @param complete_callback     Callback function to be called, in interrupt context,
+     *                              with the result of the transaction.
+     * 
+     * @returns True if the transaction is queued, false if the queue is full or
+     *          tx_message is empty.
+     * 
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     */
+    template <IsSpiChipSelect ChipSelectT = SpiChipSelect::Release>
+    bool Transmit(
+        SpiDevice& device,
+        const IsSpiMessage auto& tx_message,
+        EventCallbackT<bool>&& complete_callback = [](bool){}
+    ) noexcept
+    {
+        return Enqueue<ChipSelectT>(
+            device,
+            std::ranges::data(tx_message),
+            nullptr,
+            std::ranges::size(tx_message),
+            std::move(complete_callback)
+        );
+    }
+
+    /**
+     * @brief Queue a receive-only transaction.
+     * 
+     * @tparam ChipSelectT          Chip-select behaviour after the transaction
+     *                              (default is SpiChipSelect::Release).
+     * 
+     * @param device                Device to receive from.
+     * @param rx_message            A contiguous range to store the received data.
+     * @param complete_callback     Callback function to be called, in interrupt context,
+     *                              with the result of the transaction.
+     * 
+     * @returns True if the transaction is queued, false if the queue is full or
+     *          rx_message is empty.
+     * 
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     */
+    template <IsSpiChipSelect ChipSelectT = SpiChipSelect::Release>
+    bool ReceiveTo(
+        SpiDevice& device,
+        IsSpiMessage auto& rx_message,
+        EventCallbackT<bool>&& complete_callback = [](bool){}
+    ) noexcept
+    {
+        return Enqueue<ChipSelectT>(
+            device,
+            nullptr,
+            std::ranges::data(rx_message),
+            std::ranges::size(rx_message),
+            std::move(complete_callback)
+        );
+    }
+
+    /**
+     * @brief Queue a full-duplex transaction.
+     * 
+     * @tparam ChipSelectT          Chip-select behaviour after the transaction
+     *                              (default is SpiChipSelect::Release).
+     * 
+     * @param device                Device to exchange data with.
+     * @param tx_message            A contiguous range containing the data to transmit.
+     * @param rx_message            A contiguous range to store the received data.
+     * @param complete_callback     Callback function to be called, in interrupt context,
+     *                              with the result of the transaction.
+     * 
+     * @returns True if the transaction is queued, false if the queue is full or
+     *          a message is empty.
+     * 
+     * @note The smaller size is used if tx_message and rx_message sizes differ.
+     * 
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     */
+    template <IsSpiChipSelect ChipSelectT = SpiChipSelect::Release>
+    bool TransmitReceive(
+        SpiDevice& device,
+        const IsSpiMessage auto& tx_message,
+        IsSpiMessage auto& rx_message,
+        EventCallbackT<bool>&& complete_callback = [](bool){}
+    ) noexcept
+    {
+        return Enqueue<ChipSelectT>(
+            device,
+            std::ranges::data(tx_message),
+            std::ranges::data(rx_message),
+            std::min(std::ranges::size(tx_message), std::ranges::size(rx_message)),
+            std::move(complete_callback)
+        );
+    }
+
+    /**
+     * @brief Abort the transaction in flight, deassert chip-select and drop all queued transactions.
+     * 
+     * The completion callback of every dropped transaction is called with false.
+     */
+    void Clear() noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        if (m_busy.load(std::memory_order_relaxed)) {
+            HAL_SPI_Abort(&m_spi.GetHandle());
+            m_busy.store(false, std::memory_order_relaxed);
+        }
+        Deselect();
+        while (!IsEmpty()) {
+            Release(false);
         }
     }
 
 private:
-    SPI_HandleTypeDef& m_handle;
-    TransmitCompleteCallbackT m_transmit_complete_callback;
-    ReceiveCompleteCallbackT m_receive_complete_callback;
-    TransmitReceiveCompleteCallbackT m_transmit_receive_complete_callback;
+    SpiT& m_spi;
+    __Internal::__RingBuffer<Transaction, CapacityT::value> m_entries{};
+    std::array<EventCallbackT<bool>, CapacityT::value> m_callbacks{};
+    std::size_t m_write_index{};
+    std::size_t m_read_index{};
+    std::atomic<bool> m_busy{};
+    SpiDevice* m_selected_device{};
+    const SpiDeviceSettings m_initial_settings;
+    SpiDeviceSettings m_active_settings;
+
+    static constexpr std::size_t s_index_mask{CapacityT::value - 1};
+
+    /**
+     * @brief Append a transaction and start it if the bus is idle.
+     * 
+     * @returns True if the transaction is queued, false otherwise.
+     */
+    template <IsSpiChipSelect ChipSelectT>
+    bool Enqueue(
+        SpiDevice& device,
+        const std::uint8_t* tx_data,
+        std::uint8_t* rx_data,
+        std::size_t size,
+        EventCallbackT<bool>&& complete_callback
+    ) noexcept
+    {
+        const Transaction transaction{
+            &device,
+            tx_data,
+            rx_data,
+            __Internal::__ClampMessageLength<std::uint16_t>(size),
+            std::same_as<ChipSelectT, SpiChipSelect::Hold>
+        };
+        if (transaction.size == 0 || IsFull()) {
+            return false;
+        }
+        m_callbacks[m_write_index++ & s_index_mask] = std::move(complete_callback);
+        m_entries.Push(transaction);
+        __Internal::__CriticalSection critical_section{};
+        if (!m_busy.load(std::memory_order_relaxed)) {
+            StartNext();
+        }
+        return true;
+    }
+
+    /**
+     * @brief Start the oldest queued transaction, completing the ones that fail to start.
+     */
+    void StartNext() noexcept
+    {
+        while (!IsEmpty()) {
+            if (Start(m_entries.Front())) {
+                m_busy.store(true, std::memory_order_relaxed);
+                return;
+            }
+            Deselect();
+            Release(false);
+        }
+        m_busy.store(false, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Select the device of a transaction and start the transfer.
+     * 
+     * @returns True on success, false otherwise.
+     */
+    bool Start(const Transaction& transaction) noexcept
+    {
+        if (m_selected_device != transaction.device) {
+            Deselect();
+            if (!Configure(transaction.device->GetSettings().value_or(m_initial_settings))) {
+                return false;
+            }
+            transaction.device->Select();
+            m_selected_device = transaction.device;
+        }
+        using __Internal::__Measure;
+        constexpr auto on_complete = __Internal::__ProbeBytes::OnComplete;
+        auto& handle = m_spi.GetHandle();
+        auto tx_data = const_cast<std::uint8_t*>(transaction.tx_data);
+        const auto size = transaction.size;
+        if constexpr (std::same_as<WorkingModeT, WorkingMode::Interrupt>) {
+            if (transaction.rx_data == nullptr) {
+                return __Measure<InstrumentationProbe::SpiTransmit, on_complete>(
+                    handle, size, HAL_SPI_Transmit_IT, tx_data, size
+                );
+            }
+            if (transaction.tx_data == nullptr) {
+                return __Measure<InstrumentationProbe::SpiReceive, on_complete>(
+                    handle, size, HAL_SPI_Receive_IT, transaction.rx_data, size
+                );
+            }
+            return __Measure<InstrumentationProbe::SpiTransmitReceive, on_complete>(
+                handle, size, HAL_SPI_TransmitReceive_IT, tx_data, transaction.rx_data, size
+            );
+        } else if constexpr (std::same_as<WorkingModeT, WorkingMode::DMA>) {
+            if (transaction.rx_data == nullptr) {
+                return __Measure<InstrumentationProbe::SpiTransmit, on_complete>(
+                    handle, size, HAL_SPI_Transmit_DMA, tx_data, size
+                );
+            }
+            if (transaction.tx_data == nullptr) {
+                return __Measure<InstrumentationProbe::SpiReceive, on_complete>(
+                    handle, size, HAL_SPI_Receive_DMA, transaction.rx_data, size
+                );
+            }
+            return __Measure<InstrumentationProbe::SpiTransmitReceive, on_complete>(
+                handle, size, HAL_SPI_TransmitReceive_DMA, tx_data, transaction.rx_data, size
+            );
+        }
+    }
+
+    /**
+     * @brief Apply the transfer settings of a device if they differ from the active ones.
+     * 
+     * @returns True on success, false otherwise.
+     */
+    bool Configure(const SpiDeviceSettings& settings) noexcept
+    {
+        if (settings == m_active_settings) {
+            return true;
+        }
+        auto& handle = m_spi.GetHandle();
+        handle.Init.BaudRatePrescaler = settings.baud_rate_prescaler;
+        handle.Init.CLKPolarity = settings.clock_polarity;
+        handle.Init.CLKPhase = settings.clock_phase;
+        handle.Init.FirstBit = settings.first_bit;
+        if (HAL_OK != HAL_SPI_Init(&handle)) {
+            return false;
+        }
+        m_active_settings = settings;
+        return true;
+    }
+
+    /**
+     * @brief Deassert chip-select of the selected device, if any.
+     */
+    void Deselect() noexcept
+    {
+        if (m_selected_device != nullptr) {
+            m_selected_device->Deselect();
+            m_selected_device = nullptr;
+        }
+    }
+
+    /**
+     * @brief Pop the oldest transaction and report its result.
+     * 
+     * @param is_successful     Whether the transaction completed without error.
+     */
+    void Release(bool is_successful) noexcept
+    {
+        auto callback = std::move(m_callbacks[m_read_index++ & s_index_mask]);
+        m_entries.CommitRead(1);
+        callback(is_successful);
+    }
+
+    /**
+     * @brief Complete and error handler, switches chip-select and chains the next transaction from interrupt context.
+     * 
+     * @param is_successful     Whether the transaction completed without error.
+     */
+    void OnTransactionComplete(bool is_successful) noexcept
+    {
+        if (!m_busy.load(std::memory_order_relaxed)) {
+            return;
+        }
+        if (!is_successful || !m_entries.Front().is_held) {
+            Deselect();
+        }
+        auto callback = std::move(m_callbacks[m_read_index++ & s_index_mask]);
+        m_entries.CommitRead(1);
+        StartNext();
+        callback(is_successful);
+    }
 };
 
 } /* namespace STM32 */
@@ -0,0 +1,197 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_TICKLESS_IDLE_HPP
+#define STM32_TICKLESS_IDLE_HPP
+
+#include <concepts>
+#include <cstdint>
+
+#include "TimerScheduler.hpp"
+#include "__Internal/__Utility.hpp"
+
+#include "main.h"
+
+namespace STM32 {
+
+/**
+ * @class TicklessIdle, A low-power wait primitive on top of a TimerScheduler.
+ *
+ * Waits put the core to sleep with WFI instead of spinning. The HAL SysTick
+ * interrupt is suspended for the duration, so the core is not woken every
+ * millisecond, and the HAL tick count is compensated from the elapsed scheduler
+ * time on wake. HAL_GetTick() therefore stays continuous across waits.
+ *
+ * The core wakes up for the deadline (a TimerScheduler compare event) or any
+ * other enabled interrupt. SleepFor() and SleepUntil() go back to sleep until
+ * the deadline, Idle() returns after the first wake-up.
+ *
+ * @tparam SchedulerT           TimerScheduler type providing the wake-up events.
+ *
+ * @note TicklessIdle class is non-copyable and non-movable.
+ * @note Requires the default 1 kHz HAL tick.
+ * @note The core enters Sleep mode, where timers keep running. Stop mode halts the
+ *       TIM clocks, so it cannot be woken by a TimerScheduler deadline.
+ * @note Waits must be called from the main loop only. HAL_Delay() must not be used from
+ *       interrupts while waiting, since HAL_GetTick() does not advance during the wait.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/TicklessIdle.hpp>
+ *
+ * TIM_HandleTypeDef htim2; // 1 MHz, channel 1 in output compare timing mode
+ *
+ * STM32::Timer timer{htim2};
+ * STM32::TimerScheduler<STM32::TimerSchedulerCapacity<8>, STM32_UNIQUE_TAG> scheduler{timer, TIM_CHANNEL_1};
+ * STM32::TicklessIdle idle{scheduler, 1'000}; // 1000 timer ticks per millisecond
+ *
+ * idle.SleepFor(250'000);          // Sleep 250 ms, HAL_GetTick() advances by 250
+ *
+ * scheduler.CallEvery(1'000'000, [](){ sample = true; });
+ * while (true) {
+ *     if (sample) { ... }
+ *     idle.Idle([](){ return sample; }); // Sleep until the next event or interrupt unless sample is set
+ * }
+ * @endcode
+ */
+template <IsTimerScheduler SchedulerT>
+class TicklessIdle {
+public:
+
+    /**
+     * @brief Construct TicklessIdle class.
+     *
+     * @param scheduler                 Scheduler providing the time base and wake-up events.
+     * @param ticks_per_millisecond     Scheduler ticks per millisecond (e.g., 1000 for a 1 MHz timer).
+     */
+    TicklessIdle(SchedulerT& scheduler, std::uint32_t ticks_per_millisecond) noexcept
+      : m_scheduler{scheduler},
+        m_ticks_per_millisecond{ticks_per_millisecond}
+    { }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    TicklessIdle(const TicklessIdle&) = delete;
+    TicklessIdle& operator=(const TicklessIdle&) = delete;
+    TicklessIdle(TicklessIdle&&) = delete;
+    TicklessIdle& operator=(TicklessIdle&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Sleep until the next scheduled event or any other interrupt.
+     *
+     * @note Interrupts are masked from suspension to resumption, an interrupt becoming
+     *       pending in between still wakes WFI and is served after the HAL tick is resumed.
+     */
+    void Idle() noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        const auto start = Suspend();
+        __WFI();
+        Resume(start);
+    }
+
+    /**
+     * @brief Sleep until the next scheduled event or any other interrupt, unless work is pending.
+     *
+     * @param is_pending    Callable returning true if there is work to do (e.g., a flag set by a callback).
+     *
+     * @returns True if the core has slept, false if is_pending() returned true.
+     *
+     * @note is_pending() is checked with interrupts masked, so a callback setting it
+     *       after the check still wakes the core instead of being missed until the next wake-up.
+     */
+    bool Idle(std::predicate auto&& is_pending) noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        if (is_pending()) {
+            return false;
+        }
+        const auto start = Suspend();
+        __WFI();
+        Resume(start);
+        return true;
+    }
+
+    /**
+     * @brief Sleep for a duration.
+     *
+     * @param duration      Number of scheduler ticks to sleep.
+     *
+     * @note Interrupts are served during the wait, the core goes back to sleep after each.
+     */
+    void SleepFor(std::uint32_t duration) noexcept
+    {
+        SleepUntil(m_scheduler.Now() + duration);
+    }
+
+    /**
+     * @brief Sleep until a time point, returns immediately if it has passed.
+     *
+     * @param time_point    Scheduler time point (see TimerScheduler::Now()).
+     *
+     * @note Interrupts are served during the wait, the core goes back to sleep after each.
+     *       The deadline is checked with interrupts masked before each WFI, so a wake-up
+     *       arriving between the check and WFI is not missed.
+     * @note If the scheduler is full, the core wakes up at least every half timer period.
+     */
+    void SleepUntil(std::uint64_t time_point) noexcept
+    {
+        if (m_scheduler.Now() >= time_point) {
+            return;
+        }
+        const auto wake_up = m_scheduler.CallAt(time_point, [](){});
+        const auto start = Suspend();
+        while (true) {
+            __Internal::__CriticalSection critical_section{};
+            if (m_scheduler.Now() >= time_point) {
+                break;
+            }
+            __WFI();
+        }
+        Resume(start);
+        if (wake_up) {
+            m_scheduler.Cancel(*wake_up);
+        }
+    }
+
+private:
+    SchedulerT& m_scheduler;
+    const std::uint32_t m_ticks_per_millisecond;
+    std::uint64_t m_remainder{};
+
+    /**
+     * @brief Suspend the HAL tick interrupt.
+     *
+     * @returns Scheduler time point at suspension.
+     */
+    std::uint64_t Suspend() noexcept
+    {
+        HAL_SuspendTick();
+        return m_scheduler.Now();
+    }
+
+    /**
+     * @brief Advance the HAL tick count by the slept time and resume the tick interrupt.
+     *
+     * @param start     Scheduler time point at suspension.
+     *
+     * @note Sub-millisecond remainders are carried over, so repeated waits do not drift.
+     */
+    void Resume(std::uint64_t start) noexcept
+    {
+        const auto elapsed = m_remainder + (m_scheduler.Now() - start);
+        m_remainder = elapsed % m_ticks_per_millisecond;
+        {
+            __Internal::__CriticalSection critical_section{};
+            uwTick = uwTick + static_cast<std::uint32_t>(elapsed / m_ticks_per_millisecond);
+        }
+        HAL_ResumeTick();
+    }
+};
+
+} /* namespace STM32 */
+
+#endif /* STM32_TICKLESS_IDLE_HPP */
@@ -23,7 +23,8 @@ namespace STM32 {
  * 
  * @note Timer class is non-copyable and non-movable.
  * @note Timer starts automatically upon construction and stops on destruction.
- * @note SleepFor() and SleepUntil() are blocking operations.
+ * @note SleepFor() and SleepUntil() are blocking operations, see TimerScheduler
+ *       for non-blocking deadlines on a shared timer.
  *
  * @example Usage:
  * @code {.cpp}
@@ -92,6 +93,26 @@ public:
         return __HAL_TIM_GET_COUNTER(&m_handle);
     }
 
+    /**
+     * @brief Get the number of ticks elapsed since a previous counter value.
+     * 
+     * Accounts for a single counter wraparound at the auto-reload value,
+     * so the result is correct for durations shorter than one timer period.
+     * 
+     * @param time_point    A counter value returned by Get() earlier.
+     * 
+     * @returns Elapsed timer ticks.
+     */
+    [[nodiscard]]
+    std::uint32_t ElapsedSince(std::uint32_t time_point) const noexcept
+    {
+        const auto current = Get();
+        if (current >= time_point) {
+            return current - time_point;
+        }
+        return (__HAL_TIM_GET_AUTORELOAD(&m_handle) - time_point) + current + 1U;
+    }
+
     /**
      * @returns TIM handle reference.
      */
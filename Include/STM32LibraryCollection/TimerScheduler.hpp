@@ -0,0 +1,565 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_TIMER_SCHEDULER_HPP
+#define STM32_TIMER_SCHEDULER_HPP
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <utility>
+
+#include "Timer.hpp"
+#include "__Internal/__Utility.hpp"
+
+#include "main.h"
+
+#if (USE_HAL_TIM_REGISTER_CALLBACKS != 1) /* module check */
+#error "HAL TIM callbacks are not enabled!"
+#endif /* module check */
+
+namespace STM32 {
+
+/**
+ * @struct TimerSchedulerCapacity, A utility struct to hold the maximum number of scheduled events.
+ *
+ * @tparam CapacityV    Maximum number of pending one-shot and periodic events.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/TimerScheduler.hpp>
+ *
+ * using MyCapacity = STM32::TimerSchedulerCapacity<16>;
+ * @endcode
+ */
+template <std::size_t CapacityV>
+struct TimerSchedulerCapacity : __Internal::__Constant<std::size_t, CapacityV> {
+    static_assert(
+        0 < CapacityV && CapacityV < std::numeric_limits<std::uint16_t>::max(),
+        "Capacity must be in the range [1, 65534]"
+    );
+};
+
+/**
+ * @brief IsTimerSchedulerCapacity, A concept to check if a type is a TimerSchedulerCapacity.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/TimerScheduler.hpp>
+ *
+ * static_assert(STM32::IsTimerSchedulerCapacity<STM32::TimerSchedulerCapacity<16>>);
+ * static_assert(!STM32::IsTimerSchedulerCapacity<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsTimerSchedulerCapacity =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t> &&
+    (0 < T::value && T::value < std::numeric_limits<std::uint16_t>::max());
+
+/**
+ * @struct TimerEvent, Identifier of an event scheduled on a TimerScheduler.
+ *
+ * @note Identifiers of completed or cancelled events are never reused for
+ *       a new event of the same slot, so stale identifiers are harmless.
+ */
+struct TimerEvent {
+    std::uint16_t slot;
+    std::uint16_t generation;
+
+    friend constexpr bool operator==(const TimerEvent&, const TimerEvent&) = default;
+};
+
+/**
+ * @class TimerScheduler, A software timer multiplexer on one free-running hardware timer.
+ *
+ * Many one-shot and periodic deadlines share one output-compare channel: the
+ * compare register always holds the earliest deadline, and its interrupt calls
+ * the due callbacks and re-arms the channel. Pending events are kept in a
+ * fixed-capacity binary heap sorted by deadline, so scheduling and cancelling
+ * are O(log n) without any allocation.
+ *
+ * Time points are 64-bit tick counts extended from the hardware counter in
+ * software. The channel also fires at least every half timer period, so counter
+ * wraparounds are always observed and deadlines are exact for any timer width
+ * and auto-reload value.
+ *
+ * @tparam CapacityT    Maximum number of pending events.
+ * @tparam UniqueTagT   Unique tag type to differentiate multiple TimerScheduler instances.
+ *                      UniqueTagT must be STM32_UNIQUE_TAG.
+ *
+ * @note TimerScheduler class is non-copyable and non-movable.
+ * @note Required timer configuration: internal clock, up-counting, the channel in
+ *       "Output Compare No Output" mode (TIM_OCMODE_TIMING), TIM global or CC interrupt enabled.
+ * @note The counter must not be modified while the scheduler exists
+ *       (e.g., by Timer::Reset() or Timer::SleepFor()), use Timer::Get() or Now() instead.
+ * @note Callbacks run in interrupt context, periodic events missed due to long
+ *       callbacks are caught up back-to-back.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/TimerScheduler.hpp>
+ *
+ * TIM_HandleTypeDef htim2; // 1 MHz, channel 1 in output compare timing mode
+ *
+ * STM32::Timer timer{htim2};
+ * STM32::TimerScheduler<STM32::TimerSchedulerCapacity<16>, STM32_UNIQUE_TAG> scheduler{timer, TIM_CHANNEL_1};
+ *
+ * // Blink every 500 ms
+ * auto blink = scheduler.CallEvery(500'000, [&](){ led.Toggle(); });
+ *
+ * // Stop the motor 2 s from now
+ * scheduler.CallAfter(2'000'000, [&](){ motor.stop(); });
+ *
+ * scheduler.Cancel(*blink);
+ * @endcode
+ */
+template <IsTimerSchedulerCapacity CapacityT, __Internal::__IsUniqueTag UniqueTagT>
+class TimerScheduler {
+    using CompareCallbackT = __Internal::__CallbackManager<
+        TIM_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+        HAL_TIM_RegisterCallback, HAL_TIM_UnRegisterCallback, HAL_TIM_OC_DELAY_ELAPSED_CB_ID
+    >;
+
+    /**
+     * @struct Slot, Bookkeeping of one event.
+     */
+    struct Slot {
+        std::uint64_t deadline;
+        std::uint32_t period;
+        std::uint16_t position;
+        std::uint16_t generation;
+    };
+
+    static constexpr std::size_t s_capacity{CapacityT::value};
+    static constexpr std::uint16_t s_not_queued{std::numeric_limits<std::uint16_t>::max()};
+public:
+
+    /**
+     * @brief Construct TimerScheduler class, starts the output-compare interrupt.
+     *
+     * @param timer     Free-running timer, shared with other users that only read it.
+     * @param channel   Output-compare channel (TIM_CHANNEL_1 ... TIM_CHANNEL_4).
+     *
+     * @note HAL callbacks are automatically registered via RAII.
+     */
+    TimerScheduler(Timer& timer, std::uint32_t channel) noexcept
+      : m_timer{timer},
+        m_channel{channel},
+        m_channel_shift{channel / TIM_CHANNEL_2},
+        m_compare_callback{timer.GetHandle()},
+        m_period{std::uint64_t{__HAL_TIM_GET_AUTORELOAD(&timer.GetHandle())} + 1},
+        m_last_count{timer.Get()}
+    {
+        for (std::size_t slot{}; slot < s_capacity; ++slot) {
+            m_free_slots[slot] = static_cast<std::uint16_t>(s_capacity - 1 - slot);
+            m_slots[slot].position = s_not_queued;
+        }
+        m_compare_callback.Set([this](){
+            OnCompare();
+        });
+        {
+            __Internal::__CriticalSection critical_section{};
+            Arm(Now());
+        }
+        HAL_TIM_OC_Start_IT(&m_timer.GetHandle(), m_channel);
+    }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    TimerScheduler(const TimerScheduler&) = delete;
+    TimerScheduler& operator=(const TimerScheduler&) = delete;
+    TimerScheduler(TimerScheduler&&) = delete;
+    TimerScheduler& operator=(TimerScheduler&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy TimerScheduler class, stops the output-compare interrupt.
+     *
+     * @note Pending events are dropped without being called.
+     */
+    ~TimerScheduler()
+    {
+        HAL_TIM_OC_Stop_IT(&m_timer.GetHandle(), m_channel);
+        m_compare_callback.Clear();
+    }
+
+    /**
+     * @returns Maximum number of pending events.
+     */
+    [[nodiscard]]
+    static constexpr std::size_t Capacity() noexcept
+    {
+        return s_capacity;
+    }
+
+    /**
+     * @returns Number of pending events.
+     */
+    [[nodiscard]]
+    std::size_t Size() const noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        return m_size;
+    }
+
+    /**
+     * @returns True if no event is pending.
+     */
+    [[nodiscard]]
+    bool IsEmpty() const noexcept
+    {
+        return Size() == 0;
+    }
+
+    /**
+     * @returns True if no more events can be scheduled.
+     */
+    [[nodiscard]]
+    bool IsFull() const noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        return m_free_count == 0;
+    }
+
+    /**
+     * @returns Current time point in timer ticks since the scheduler was constructed, never wraps.
+     */
+    [[nodiscard]]
+    std::uint64_t Now() noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        const auto count = m_timer.Get();
+        if (count < m_last_count) {
+            m_base += m_period;
+        }
+        m_last_count = count;
+        return m_base + count;
+    }
+
+    /**
+     * @returns Time point of the earliest pending event, std::nullopt if none is pending.
+     */
+    [[nodiscard]]
+    std::optional<std::uint64_t> NextDeadline() const noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        if (m_size == 0) {
+            return std::nullopt;
+        }
+        return m_slots[m_heap[0]].deadline;
+    }
+
+    /**
+     * @brief Schedule a one-shot event at a time point.
+     *
+     * @param time_point    Time point in ticks (see Now()), past time points are due immediately.
+     * @param callback      Callback function to be called, in interrupt context, at time_point.
+     *
+     * @returns Identifier of the event, std::nullopt if the scheduler is full.
+     */
+    std::optional<TimerEvent> CallAt(std::uint64_t time_point, CallbackT&& callback) noexcept
+    {
+        return Schedule(time_point, 0, std::move(callback));
+    }
+
+    /**
+     * @brief Schedule a one-shot event after a delay.
+     *
+     * @param delay         Delay in timer ticks.
+     * @param callback      Callback function to be called, in interrupt context, after delay.
+     *
+     * @returns Identifier of the event, std::nullopt if the scheduler is full.
+     */
+    std::optional<TimerEvent> CallAfter(std::uint32_t delay, CallbackT&& callback) noexcept
+    {
+        return Schedule(Now() + delay, 0, std::move(callback));
+    }
+
+    /**
+     * @brief Schedule a periodic event, the first call is one period from now.
+     *
+     * @param period        Period in timer ticks (must be greater than zero).
+     * @param callback      Callback function to be called, in interrupt context, every period.
+     *
+     * @returns Identifier of the event, std::nullopt if the scheduler is full or period is zero.
+     *
+     * @note Deadlines advance by exactly one period, so periodic events do not drift.
+     */
+    std::optional<TimerEvent> CallEvery(std::uint32_t period, CallbackT&& callback) noexcept
+    {
+        if (period == 0) {
+            return std::nullopt;
+        }
+        return Schedule(Now() + period, period, std::move(callback));
+    }
+
+    /**
+     * @brief Cancel a pending event.
+     *
+     * @param event     Identifier returned when the event was scheduled.
+     *
+     * @returns True if the event was pending, false if it was already completed or cancelled.
+     *
+     * @note May be called from callbacks, including the callback of the event itself.
+     */
+    bool Cancel(TimerEvent event) noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        if (!IsPending(event)) {
+            return false;
+        }
+        if (m_slots[event.slot].position != s_not_queued) {
+            Remove(m_slots[event.slot].position);
+        }
+        Free(event.slot);
+        return true;
+    }
+
+    /**
+     * @returns True if the event is pending (scheduled and not yet completed or cancelled).
+     */
+    [[nodiscard]]
+    bool IsPending(TimerEvent event) const noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        return event.slot < s_capacity &&
+            m_is_used[event.slot] &&
+            m_slots[event.slot].generation == event.generation;
+    }
+
+private:
+    Timer& m_timer;
+    const std::uint32_t m_channel;
+    const std::uint32_t m_channel_shift;
+    CompareCallbackT m_compare_callback;
+    const std::uint64_t m_period;
+    std::uint64_t m_base{};
+    std::uint32_t m_last_count;
+    std::array<Slot, s_capacity> m_slots{};
+    std::array<bool, s_capacity> m_is_used{};
+    std::array<CallbackT, s_capacity> m_callbacks{};
+    std::array<std::uint16_t, s_capacity> m_heap{};
+    std::array<std::uint16_t, s_capacity> m_free_slots{};
+    std::size_t m_size{};
+    std::size_t m_free_count{s_capacity};
+
+    /**
+     * @brief Allocate a slot, queue it and re-arm the channel if it became the earliest.
+     *
+     * @returns Identifier of the event, std::nullopt if the scheduler is full.
+     */
+    std::optional<TimerEvent> Schedule(
+        std::uint64_t deadline,
+        std::uint32_t period,
+        CallbackT&& callback
+    ) noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        if (m_free_count == 0) {
+            return std::nullopt;
+        }
+        const auto slot = m_free_slots[--m_free_count];
+        m_is_used[slot] = true;
+        m_slots[slot].deadline = deadline;
+        m_slots[slot].period = period;
+        m_callbacks[slot] = std::move(callback);
+        Insert(slot);
+        if (m_heap[0] == slot) {
+            Arm(Now());
+        }
+        return TimerEvent{slot, m_slots[slot].generation};
+    }
+
+    /**
+     * @brief Release a slot, invalidates its identifiers.
+     */
+    void Free(std::uint16_t slot) noexcept
+    {
+        m_is_used[slot] = false;
+        ++m_slots[slot].generation;
+        m_callbacks[slot] = nullptr;
+        m_free_slots[m_free_count++] = slot;
+    }
+
+    /**
+     * @returns True if the event at heap position lhs is due before the one at rhs.
+     */
+    bool IsEarlier(std::size_t lhs, std::size_t rhs) const noexcept
+    {
+        return m_slots[m_heap[lhs]].deadline < m_slots[m_heap[rhs]].deadline;
+    }
+
+    /**
+     * @brief Swap two heap positions and update the slot positions.
+     */
+    void Swap(std::size_t lhs, std::size_t rhs) noexcept
+    {
+        std::swap(m_heap[lhs], m_heap[rhs]);
+        m_slots[m_heap[lhs]].position = static_cast<std::uint16_t>(lhs);
+        m_slots[m_heap[rhs]].position = static_cast<std::uint16_t>(rhs);
+    }
+
+    /**
+     * @brief Move a heap position towards the root while it is earlier than its parent.
+     */
+    void SiftUp(std::size_t position) noexcept
+    {
+        while (position > 0) {
+            const auto parent = (position - 1) / 2;
+            if (!IsEarlier(position, parent)) {
+                return;
+            }
+            Swap(position, parent);
+            position = parent;
+        }
+    }
+
+    /**
+     * @brief Move a heap position towards the leaves while a child is earlier.
+     */
+    void SiftDown(std::size_t position) noexcept
+    {
+        while (true) {
+            const auto left = 2 * position + 1;
+            if (left >= m_size) {
+                return;
+            }
+            const auto right = left + 1;
+            const auto child = (right < m_size && IsEarlier(right, left)) ? right : left;
+            if (!IsEarlier(child, position)) {
+                return;
+            }
+            Swap(position, child);
+            position = child;
+        }
+    }
+
+    /**
+     * @brief Queue a slot by its deadline.
+     */
+    void Insert(std::uint16_t slot) noexcept
+    {
+        m_heap[m_size] = slot;
+        m_slots[slot].position = static_cast<std::uint16_t>(m_size);
+        SiftUp(m_size++);
+    }
+
+    /**
+     * @brief Dequeue the slot at a heap position.
+     */
+    void Remove(std::size_t position) noexcept
+    {
+        m_slots[m_heap[position]].position = s_not_queued;
+        if (position != --m_size) {
+            m_heap[position] = m_heap[m_size];
+            m_slots[m_heap[position]].position = static_cast<std::uint16_t>(position);
+            SiftDown(position);
+            SiftUp(position);
+        }
+    }
+
+    /**
+     * @brief Program the compare register with the earliest deadline, or half a period ahead.
+     *
+     * @param now       Current time point, read with interrupts disabled.
+     *
+     * @note If the target has already passed while programming, the compare event is generated by software.
+     */
+    void Arm(std::uint64_t now) noexcept
+    {
+        auto target = now + m_period / 2;
+        if (m_size > 0 && m_slots[m_heap[0]].deadline < target) {
+            target = m_slots[m_heap[0]].deadline;
+        }
+        if (target > now) {
+            auto compare = m_last_count + (target - now);
+            if (compare >= m_period) {
+                compare -= m_period;
+            }
+            __HAL_TIM_SET_COMPARE(&m_timer.GetHandle(), m_channel, static_cast<std::uint32_t>(compare));
+            if (Now() < target) {
+                return;
+            }
+        }
+        HAL_TIM_GenerateEvent(&m_timer.GetHandle(), TIM_EVENTSOURCE_CC1 << m_channel_shift);
+    }
+
+    /**
+     * @brief Output-compare handler, calls due events and re-arms the channel from interrupt context.
+     */
+    void OnCompare() noexcept
+    {
+        if (m_timer.GetHandle().Channel != (HAL_TIM_ACTIVE_CHANNEL_1 << m_channel_shift)) {
+            return;
+        }
+        while (true) {
+            std::uint16_t slot{};
+            std::uint16_t generation{};
+            std::uint32_t period{};
+            CallbackT callback{};
+            {
+                __Internal::__CriticalSection critical_section{};
+                const auto now = Now();
+                if (m_size == 0 || m_slots[m_heap[0]].deadline > now) {
+                    Arm(now);
+                    return;
+                }
+                slot = m_heap[0];
+                generation = m_slots[slot].generation;
+                period = m_slots[slot].period;
+                Remove(0);
+                callback = std::move(m_callbacks[slot]);
+                if (period == 0) {
+                    Free(slot);
+                }
+            }
+            if (callback) {
+                callback();
+            }
+            if (period != 0) {
+                __Internal::__CriticalSection critical_section{};
+                if (m_is_used[slot] && m_slots[slot].generation == generation) {
+                    m_slots[slot].deadline += period;
+                    m_callbacks[slot] = std::move(callback);
+                    Insert(slot);
+                }
+            }
+        }
+    }
+};
+
+/**
+ * @brief IsTimerScheduler, A concept to check if a type is a TimerScheduler.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/TimerScheduler.hpp>
+ *
+ * using MyScheduler = STM32::TimerScheduler<STM32::TimerSchedulerCapacity<8>, STM32_UNIQUE_TAG>;
+ * static_assert(STM32::IsTimerScheduler<MyScheduler>);
+ * static_assert(!STM32::IsTimerScheduler<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsTimerScheduler =
+    requires (T& scheduler, std::uint64_t time_point, std::uint32_t delay, TimerEvent event) {
+        { scheduler.Now() } -> std::same_as<std::uint64_t>;
+        { scheduler.CallAt(time_point, [](){}) } -> std::same_as<std::optional<TimerEvent>>;
+        { scheduler.CallAfter(delay, [](){}) } -> std::same_as<std::optional<TimerEvent>>;
+        { scheduler.CallEvery(delay, [](){}) } -> std::same_as<std::optional<TimerEvent>>;
+        { scheduler.Cancel(event) } -> std::same_as<bool>;
+    };
+
+} /* namespace STM32 */
+
+#endif /* STM32_TIMER_SCHEDULER_HPP */
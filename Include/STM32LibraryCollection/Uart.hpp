@@ -6,12 +6,17 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <bit>
 #include <concepts>
+#include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <ranges>
+#include <span>
 
 #include "Config.hpp"
+#include "EventQueue.hpp"
 #include "__Internal/__Utility.hpp"
 
 #include "main.h"
@@ -97,6 +102,72 @@ concept IsUartTimeout =
 template <typename T>
 concept IsUartMessage = __Internal::__IsMessage<T, char>;
 
+/**
+ * @brief IsUart, A concept to check if a type is a Uart.
+ * 
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Uart.hpp>
+ * 
+ * static_assert(STM32::IsUart<STM32::Uart<STM32::WorkingMode::DMA, STM32_UNIQUE_TAG>>);
+ * static_assert(!STM32::IsUart<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsUart =
+    IsWorkingMode<typename T::DefaultWorkingModeT> &&
+    requires (T& uart) {
+        { uart.GetHandle() } -> std::same_as<UART_HandleTypeDef&>;
+    };
+
+/**
+ * @struct UartTransmitQueueCapacity, A utility struct to hold the UART transmit queue capacity.
+ * 
+ * @tparam CapacityV    Maximum number of queued messages (must be a power of two).
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Uart.hpp>
+ *
+ * using MyQueueCapacity = STM32::UartTransmitQueueCapacity<16>;
+ * auto capacity = MyQueueCapacity::value; // capacity is 16 messages.
+ * @endcode
+ */
+template <std::size_t CapacityV>
+struct UartTransmitQueueCapacity : __Internal::__Constant<std::size_t, CapacityV> {
+    static_assert(
+        std::has_single_bit(CapacityV),
+        "Capacity must be a power of two"
+    );
+};
+
+/**
+ * @brief IsUartTransmitQueueCapacity, A concept to check if a type is a UartTransmitQueueCapacity.
+ * 
+ * @tparam T        Type to be checked.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Uart.hpp>
+ * 
+ * static_assert(STM32::IsUartTransmitQueueCapacity<STM32::UartTransmitQueueCapacity<8>>);
+ * static_assert(!STM32::IsUartTransmitQueueCapacity<int>);
+ * @endcode
+ */
+template <typename T>
+concept IsUartTransmitQueueCapacity =
+    __Internal::__IsConstant<T> &&
+    std::same_as<typename T::ValueTypeT, std::size_t> &&
+    std::has_single_bit(T::value);
+
+template <
+    IsUart UartT,
+    IsUartTransmitQueueCapacity CapacityT = UartTransmitQueueCapacity<8>
+>
+class UartTransmitQueue;
+
 /**
  * @class Uart, A class to manage UART functionality on STM32 microcontrollers.
  * 
@@ -106,6 +177,8 @@ concept IsUartMessage = __Internal::__IsMessage<T, char>;
  *                              UniqueTagT must be STM32_UNIQUE_TAG.
  *
  * @note Uart class is non-copyable and non-movable.
+ * @note At most STM32_CALLBACK_INSTANCE_CAPACITY (default is 4) Uart instances may exist at the same time,
+ *       constructing one more calls STM32_CALLBACK_INSTANCE_OVERFLOW() (default is Error_Handler()).
  *
  * @example Usage:
  * @code {.cpp}
@@ -132,6 +205,10 @@ concept IsUartMessage = __Internal::__IsMessage<T, char>;
  *     // RX complete callback - parse received data here
  * });
  *
+ * uart1.ReceiveTo(rx_message, [](std::uint16_t length){
+ *     // RX complete callback receiving the number of received bytes
+ * });
+ *
  * // 2. Override mode per-operation: use Blocking for TX, keep DMA for RX
  * uart1.Transmit<STM32::WorkingMode::Blocking>(tx_message);
  *
@@ -141,20 +218,54 @@ concept IsUartMessage = __Internal::__IsMessage<T, char>;
  *
  * // 4. Access underlying HAL handle if needed
  * auto& handle = uart1.GetHandle();
+ *
+ * // 5. Continuous circular DMA reception with idle-line detection
+ * std::array<char, 256> rx_ring{};
+ * uart1.CircularReceiveTo(rx_ring, [](std::span<const char> received){
+ *     // Called on half, complete and idle events with newly arrived bytes
+ * });
+ * uart1.AbortCircularReceive();
+ *
+ * // 6. Run the completion callbacks from the main loop
+ * STM32::EventQueue<STM32::EventQueueCapacity<8>> events{};
+ * uart1.SetCompletionQueue(events);
+ * events.RunUntilIdle();
  * @endcode
  */
 template <IsWorkingMode WorkingModeT, __Internal::__IsUniqueTag UniqueTagT>
 class Uart {
-    using TransmitCompleteCallbackT = __Internal::__CallbackManager<
-        UART_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
-        HAL_UART_RegisterCallback, HAL_UART_UnRegisterCallback, HAL_UART_TX_COMPLETE_CB_ID
+    using TransmitCompleteCallbackT = __Internal::__InstanceCallbackManager<
+        UART_HandleTypeDef,
+        HAL_UART_RegisterCallback, HAL_UART_UnRegisterCallback, HAL_UART_TX_COMPLETE_CB_ID,
+        __Internal::__ProbeComplete<InstrumentationProbe::UartTransmit>,
+        __Internal::__HalTransmittedLength<UART_HandleTypeDef>
     >;
-    using ReceiveCompleteCallbackT = __Internal::__CallbackManager<
+    using ReceiveCompleteCallbackT = __Internal::__InstanceCallbackManager<
+        UART_HandleTypeDef,
+        HAL_UART_RegisterCallback, HAL_UART_UnRegisterCallback, HAL_UART_RX_COMPLETE_CB_ID,
+        __Internal::__ProbeComplete<InstrumentationProbe::UartReceive>,
+        __Internal::__HalReceivedLength<UART_HandleTypeDef>
+    >;
+    using ReceiveEventCallbackT = __Internal::__EventCallbackManager<
         UART_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
-        HAL_UART_RegisterCallback, HAL_UART_UnRegisterCallback, HAL_UART_RX_COMPLETE_CB_ID
+        HAL_UART_RegisterRxEventCallback, HAL_UART_UnRegisterRxEventCallback,
+        std::uint16_t
+    >;
+    using ErrorCallbackT = __Internal::__InstanceCallbackManager<
+        UART_HandleTypeDef,
+        HAL_UART_RegisterCallback, HAL_UART_UnRegisterCallback, HAL_UART_ERROR_CB_ID,
+        nullptr, __Internal::__HalErrorCode<UART_HandleTypeDef>
     >;
+
+    template <IsUart, IsUartTransmitQueueCapacity>
+    friend class UartTransmitQueue;
 public:
 
+    /**
+     * @typedef DefaultWorkingModeT, Working mode used when an operation does not override it.
+     */
+    using DefaultWorkingModeT = WorkingModeT;
+
     /**
      * @brief Construct Uart class.
      * 
@@ -163,8 +274,14 @@ public:
     explicit Uart(UART_HandleTypeDef& handle) noexcept
       : m_handle{handle},
         m_transmit_complete_callback{handle},
-        m_receive_complete_callback{handle}
-    { }
+        m_receive_complete_callback{handle},
+        m_receive_event_callback{handle},
+        m_error_callback{handle}
+    {
+        m_error_callback.Set([this](std::uint32_t error_code){
+            OnError(error_code);
+        });
+    }
 
     /**
      * @defgroup Deleted copy and move members.
@@ -214,12 +331,13 @@ public:
     ) noexcept
     requires std::same_as<RxWorkingModeT, WorkingMode::Blocking>
     {
-        return (HAL_OK == HAL_UART_Receive(
-            &m_handle,
+        const auto size = __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message));
+        return __Internal::__Measure<InstrumentationProbe::UartReceive>(
+            m_handle, size, HAL_UART_Receive,
             reinterpret_cast<std::uint8_t*>(std::ranges::data(rx_message)),
-            __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message)),
+            size,
             TimeoutV::value
-        ));
+        );
     }
 
     /**
@@ -247,19 +365,35 @@ public:
         m_receive_complete_callback.Set(
             std::move(complete_callback)
         );
-        if constexpr (std::same_as<RxWorkingModeT, WorkingMode::Interrupt>){
-            return (HAL_OK == HAL_UART_Receive_IT(
-                &m_handle,
-                reinterpret_cast<std::uint8_t*>(std::ranges::data(rx_message)),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message))
-            ));
-        } else if constexpr (std::same_as<RxWorkingModeT, WorkingMode::DMA>){
-            return (HAL_OK == HAL_UART_Receive_DMA(
-                &m_handle,
-                reinterpret_cast<std::uint8_t*>(std::ranges::data(rx_message)),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message))
-            ));
-        }
+        return StartReceive<RxWorkingModeT>(rx_message);
+    }
+
+    /**
+     * @brief Receive data into the provided message buffer in non-blocking mode, reporting the received length.
+     * 
+     * @tparam RxWorkingModeT   Working mode for receiving (default is WorkingModeT).
+     * 
+     * @param rx_message        A contiguous range to store the received message.
+     * @param complete_callback Callback function to be called upon completion with the received byte count.
+     * 
+     * @returns True on success, false otherwise.
+     * 
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     *          Only the first 65535 bytes will be received for oversized buffers.
+     */
+    template <
+        IsWorkingMode RxWorkingModeT = WorkingModeT
+    >
+    bool ReceiveTo(
+        IsUartMessage auto& rx_message,
+        EventCallbackT<std::uint16_t>&& complete_callback
+    ) noexcept
+    requires (!std::same_as<RxWorkingModeT, WorkingMode::Blocking>)
+    {
+        m_receive_complete_callback.Set(
+            std::move(complete_callback)
+        );
+        return StartReceive<RxWorkingModeT>(rx_message);
     }
 
     /**
@@ -284,14 +418,15 @@ public:
     ) noexcept
     requires std::same_as<TxWorkingModeT, WorkingMode::Blocking>
     {
-        return (HAL_OK == HAL_UART_Transmit(
-            &m_handle,
+        const auto size = __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message));
+        return __Internal::__Measure<InstrumentationProbe::UartTransmit>(
+            m_handle, size, HAL_UART_Transmit,
             reinterpret_cast<std::uint8_t*>(
                 const_cast<char *>(std::ranges::data(tx_message))
             ),
-            __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message)),
+            size,
             TimeoutV::value
-        ));
+        );
     }
 
     /**
@@ -319,29 +454,611 @@ public:
         m_transmit_complete_callback.Set(
             std::move(complete_callback)
         );
+        return StartTransmit<TxWorkingModeT>(tx_message);
+    }
+
+    /**
+     * @brief Transmit data from the provided message buffer in non-blocking mode, reporting the transmitted length.
+     * 
+     * @tparam TxWorkingModeT    Working mode for transmitting (default is WorkingModeT).
+     * 
+     * @param tx_message         A contiguous range containing the message to transmit.
+     * @param complete_callback  Callback function to be called upon completion with the transmitted byte count.
+     * 
+     * @returns True on success, false otherwise.
+     * 
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     *          Only the first 65535 bytes will be transmitted for oversized buffers.
+     */
+    template <
+        IsWorkingMode TxWorkingModeT = WorkingModeT
+    >
+    bool Transmit(
+        const IsUartMessage auto& tx_message,
+        EventCallbackT<std::uint16_t>&& complete_callback
+    ) noexcept
+    requires (!std::same_as<TxWorkingModeT, WorkingMode::Blocking>)
+    {
+        m_transmit_complete_callback.Set(
+            std::move(complete_callback)
+        );
+        return StartTransmit<TxWorkingModeT>(tx_message);
+    }
+
+    /**
+     * @brief Start continuous reception into a circular DMA buffer with idle-line detection.
+     * 
+     * Reception is started once with HAL_UARTEx_ReceiveToIdle_DMA and never re-armed,
+     * so no bytes are lost between frames. On every half-transfer, transfer-complete
+     * and idle-line event, the callback receives a span over the bytes that arrived
+     * since the previous event. The span points directly into rx_buffer (zero-copy).
+     * When the new data wraps around the end of rx_buffer, the callback is invoked
+     * twice, once for each contiguous part, in arrival order.
+     * 
+     * Reception is restarted automatically from the start of rx_buffer after
+     * a UART error that ended it (e.g., overrun or RX DMA error). Errors leaving
+     * the reception running (e.g., a TX DMA error) do not disturb it.
+     * 
+     * @tparam RxWorkingModeT   Working mode for receiving (default is WorkingModeT).
+     * 
+     * @param rx_buffer         A contiguous range used as the DMA ring buffer.
+     * @param receive_callback  Callback function to be called with newly received data.
+     * 
+     * @returns True on success, false otherwise.
+     * 
+     * @note The UART RX DMA stream must be configured in circular mode (DMA_CIRCULAR).
+     * @note rx_buffer must outlive the reception, it is written by DMA until
+     *       AbortCircularReceive() is called.
+     * @note The callback runs in interrupt context and must consume the span before
+     *       DMA overwrites it, i.e., within half of the buffer time.
+     * 
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     */
+    template <
+        IsWorkingMode RxWorkingModeT = WorkingModeT
+    >
+    bool CircularReceiveTo(
+        IsUartMessage auto& rx_buffer,
+        EventCallbackT<std::span<const char>>&& receive_callback
+    ) noexcept
+    requires std::same_as<RxWorkingModeT, WorkingMode::DMA>
+    {
+        m_circular_rx_buffer = std::span<char>{
+            std::ranges::data(rx_buffer),
+            __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_buffer))
+        };
+        m_circular_rx_position = 0;
+        m_circular_rx_callback = std::move(receive_callback);
+        m_receive_event_callback.Set([this](std::uint16_t position){
+            OnCircularReceiveEvent(position);
+        });
+        return StartCircularReceive();
+    }
+
+    /**
+     * @brief Stop the continuous reception started by CircularReceiveTo().
+     * 
+     * @returns True on success, false otherwise.
+     */
+    bool AbortCircularReceive() noexcept
+    {
+        m_receive_event_callback.Clear();
+        {
+            __Internal::__CriticalSection critical_section{};
+            m_circular_rx_callback = nullptr;
+        }
+        const auto status = HAL_UART_AbortReceive(&m_handle);
+        m_circular_rx_buffer = {};
+        m_circular_rx_position = 0;
+        return (HAL_OK == status);
+    }
+
+    /**
+     * @brief Set the callback invoked when a non-blocking operation fails.
+     * 
+     * @param error_callback    Callback function receiving the HAL error code.
+     * 
+     * @returns True on success, false if a callback is already set (e.g., by an AsyncTransfer()).
+     * 
+     * @note The error recovery of CircularReceiveTo() and the error handling of a
+     *       UartTransmitQueue run before it.
+     */
+    bool SetErrorCallback(EventCallbackT<std::uint32_t>&& error_callback) noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        if (m_user_error_callback) {
+            return false;
+        }
+        m_user_error_callback = std::move(error_callback);
+        return true;
+    }
+
+    /**
+     * @brief Clear the callback set by SetErrorCallback().
+     */
+    void ClearErrorCallback() noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        m_user_error_callback = nullptr;
+    }
+
+    /**
+     * @returns Directions of the non-blocking transfers running, read from the HAL states.
+     */
+    [[nodiscard]]
+    TransferDirection GetBusyDirection() const noexcept
+    {
+        auto direction = TransferDirection::None;
+        if (m_handle.gState == HAL_UART_STATE_BUSY_TX) {
+            direction = direction | TransferDirection::Transmit;
+        }
+        if (m_handle.RxState == HAL_UART_STATE_BUSY_RX) {
+            direction = direction | TransferDirection::Receive;
+        }
+        return direction;
+    }
+
+    /**
+     * @brief Abort the non-blocking transfers of the given directions and clear their complete callbacks.
+     * 
+     * @param direction     Directions to abort.
+     * 
+     * @returns True on success, false otherwise.
+     * 
+     * @note Do not abort a reception started by CircularReceiveTo() this way, use AbortCircularReceive().
+     */
+    bool AbortTransfer(TransferDirection direction) noexcept
+    {
+        bool is_aborted{true};
+        if ((direction & TransferDirection::Transmit) != TransferDirection::None) {
+            is_aborted = (HAL_OK == HAL_UART_AbortTransmit(&m_handle)) && is_aborted;
+            m_transmit_complete_callback.Clear();
+        }
+        if ((direction & TransferDirection::Receive) != TransferDirection::None) {
+            is_aborted = (HAL_OK == HAL_UART_AbortReceive(&m_handle)) && is_aborted;
+            m_receive_complete_callback.Clear();
+        }
+        return is_aborted;
+    }
+
+    /**
+     * @brief Run the transmit complete, receive complete and error callbacks from an event queue instead of interrupt context.
+     *
+     * @tparam PriorityV    Priority of the posted callbacks (default is EventPriority::Normal).
+     *
+     * @param queue         Event queue to post the callbacks to (see EventQueue).
+     *
+     * @note If the queue is full or STM32_CALLBACK_DEFER_CAPACITY replaced callbacks are pending,
+     *       a callback runs in interrupt context.
+     * @note CircularReceiveTo() events still run in interrupt context, its error
+     *       recovery restarts the reception from the queue.
+     */
+    template <EventPriority PriorityV = EventPriority::Normal, IsEventQueue QueueT>
+    void SetCompletionQueue(QueueT& queue) noexcept
+    {
+        m_transmit_complete_callback.Defer<PriorityV>(queue);
+        m_receive_complete_callback.Defer<PriorityV>(queue);
+        m_error_callback.Defer<PriorityV>(queue);
+    }
+
+    /**
+     * @brief Run the transmit complete, receive complete and error callbacks in interrupt context again.
+     */
+    void ClearCompletionQueue() noexcept
+    {
+        m_transmit_complete_callback.ClearDefer();
+        m_receive_complete_callback.ClearDefer();
+        m_error_callback.ClearDefer();
+    }
+
+private:
+    UART_HandleTypeDef& m_handle;
+    TransmitCompleteCallbackT m_transmit_complete_callback;
+    ReceiveCompleteCallbackT m_receive_complete_callback;
+    ReceiveEventCallbackT m_receive_event_callback;
+    ErrorCallbackT m_error_callback;
+    EventCallbackT<std::span<const char>> m_circular_rx_callback{};
+    std::span<char> m_circular_rx_buffer{};
+    std::uint16_t m_circular_rx_position{};
+    EventCallbackT<std::uint32_t> m_transmit_error_callback{};
+    EventCallbackT<std::uint32_t> m_user_error_callback{};
+
+    /**
+     * @brief Error handler, forwards the error to the circular reception, the transmit queue and the user.
+     * 
+     * @param error_code    HAL error code of the handle.
+     */
+    void OnError(std::uint32_t error_code) noexcept
+    {
+        if (m_circular_rx_callback && m_handle.RxState == HAL_UART_STATE_READY) {
+            m_circular_rx_position = 0;
+            StartCircularReceive();
+        }
+        if (m_transmit_error_callback) {
+            m_transmit_error_callback(error_code);
+        }
+        if (m_user_error_callback) {
+            m_user_error_callback(error_code);
+        }
+    }
+
+    /**
+     * @brief Start a non-blocking reception into the provided message buffer.
+     * 
+     * @tparam RxWorkingModeT   Working mode for receiving (Interrupt or DMA).
+     * 
+     * @param rx_message        A contiguous range to store the received message.
+     * 
+     * @returns True on success, false otherwise.
+     */
+    template <IsWorkingMode RxWorkingModeT>
+    bool StartReceive(
+        IsUartMessage auto& rx_message
+    ) noexcept
+    {
+        if constexpr (std::same_as<RxWorkingModeT, WorkingMode::Interrupt>){
+            const auto size = __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message));
+            return __Internal::__Measure<InstrumentationProbe::UartReceive, __Internal::__ProbeBytes::OnComplete>(
+                m_handle, size, HAL_UART_Receive_IT,
+                reinterpret_cast<std::uint8_t*>(std::ranges::data(rx_message)),
+                size
+            );
+        } else if constexpr (std::same_as<RxWorkingModeT, WorkingMode::DMA>){
+            const auto size = __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(rx_message));
+            return __Internal::__Measure<InstrumentationProbe::UartReceive, __Internal::__ProbeBytes::OnComplete>(
+                m_handle, size, HAL_UART_Receive_DMA,
+                reinterpret_cast<std::uint8_t*>(std::ranges::data(rx_message)),
+                size
+            );
+        }
+    }
+
+    /**
+     * @brief Start a non-blocking transmission of the provided message buffer.
+     * 
+     * @tparam TxWorkingModeT    Working mode for transmitting (Interrupt or DMA).
+     * 
+     * @param tx_message         A contiguous range containing the message to transmit.
+     * 
+     * @returns True on success, false otherwise.
+     */
+    template <IsWorkingMode TxWorkingModeT>
+    bool StartTransmit(
+        const IsUartMessage auto& tx_message
+    ) noexcept
+    {
         if constexpr (std::same_as<TxWorkingModeT, WorkingMode::Interrupt>){
-            return (HAL_OK == HAL_UART_Transmit_IT(
-                &m_handle,
+            const auto size = __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message));
+            return __Internal::__Measure<InstrumentationProbe::UartTransmit, __Internal::__ProbeBytes::OnComplete>(
+                m_handle, size, HAL_UART_Transmit_IT,
                 reinterpret_cast<std::uint8_t*>(
                     const_cast<char *>(std::ranges::data(tx_message))
                 ),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message))
-            ));
+                size
+            );
         } else if constexpr (std::same_as<TxWorkingModeT, WorkingMode::DMA>){
-            return (HAL_OK == HAL_UART_Transmit_DMA(
-                &m_handle,
+            const auto size = __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message));
+            return __Internal::__Measure<InstrumentationProbe::UartTransmit, __Internal::__ProbeBytes::OnComplete>(
+                m_handle, size, HAL_UART_Transmit_DMA,
                 reinterpret_cast<std::uint8_t*>(
                     const_cast<char *>(std::ranges::data(tx_message))
                 ),
-                __Internal::__ClampMessageLength<std::uint16_t>(std::ranges::size(tx_message))
-            ));
+                size
+            );
+        }
+    }
+
+    /**
+     * @brief (Re)start circular DMA reception from the start of the ring buffer.
+     * 
+     * @returns True on success, false otherwise.
+     */
+    bool StartCircularReceive() noexcept
+    {
+        return (HAL_OK == HAL_UARTEx_ReceiveToIdle_DMA(
+            &m_handle,
+            reinterpret_cast<std::uint8_t*>(m_circular_rx_buffer.data()),
+            static_cast<std::uint16_t>(m_circular_rx_buffer.size())
+        ));
+    }
+
+    /**
+     * @brief Deliver bytes received between the previous and the current DMA position.
+     * 
+     * @param position      Current DMA write position in the ring buffer reported by HAL.
+     */
+    void OnCircularReceiveEvent(std::uint16_t position) noexcept
+    {
+        const auto size = m_circular_rx_buffer.size();
+        if (position > size || position == m_circular_rx_position) {
+            return;
+        }
+        if (position > m_circular_rx_position) {
+            DeliverCircularReceive(m_circular_rx_position, position);
+        } else {
+            DeliverCircularReceive(m_circular_rx_position, size);
+            DeliverCircularReceive(0, position);
+        }
+        m_circular_rx_position = (position == size) ? 0 : position;
+    }
+
+    /**
+     * @brief Invoke the user callback with ring buffer bytes in [first, last).
+     * 
+     * @param first     Index of the first byte.
+     * @param last      Index past the last byte.
+     */
+    void DeliverCircularReceive(std::size_t first, std::size_t last) const noexcept
+    {
+        if (first < last) {
+            m_circular_rx_callback(
+                std::span<const char>{m_circular_rx_buffer.subspan(first, last - first)}
+            );
+        }
+    }
+};
+
+/**
+ * @class UartTransmitQueue, A bounded, allocation-free transmit queue for a non-blocking Uart.
+ * 
+ * Queues descriptors (pointer and length) of caller-owned message buffers. Messages
+ * are never copied: each queued buffer is transmitted in place, and the next transfer
+ * is started directly from the TX complete interrupt so the line does not go idle
+ * between back-to-back messages. Transmit() never blocks and never returns HAL_BUSY
+ * style failures while there is room in the queue.
+ * 
+ * A message that fails to start or ends with a UART TX error (e.g., a TX DMA error)
+ * is dropped and handed to the release callback, and the next queued one is started.
+ * 
+ * @tparam UartT        Uart type to transmit on (WorkingMode::Interrupt or WorkingMode::DMA).
+ * @tparam CapacityT    Maximum number of queued messages (default is 8).
+ * 
+ * @note UartTransmitQueue class is non-copyable and non-movable.
+ * @note Queued buffers must stay valid and unmodified until they are released.
+ * @note Transmit() must be called from a single context (thread or one ISR) with
+ *       lower priority than the UART interrupt.
+ * @note Do not call Uart::Transmit() directly while the queue is in use, use at most one queue per Uart.
+ * 
+ * @example Usage:
+ * @code {.cpp}
+ * #include <STM32LibraryCollection/Uart.hpp>
+ *
+ * UART_HandleTypeDef huart1; // Assume this is properly initialized elsewhere.
+ *
+ * STM32::Uart<STM32::WorkingMode::DMA, STM32_UNIQUE_TAG> uart{huart1};
+ *
+ * // Queue with default capacity (8 messages), release callback runs in ISR
+ * STM32::UartTransmitQueue tx_queue{uart, [](std::span<const char> released){
+ *     // released buffer may be reused now
+ * }};
+ *
+ * // Queue with custom capacity
+ * STM32::UartTransmitQueue<decltype(uart), STM32::UartTransmitQueueCapacity<16>> log_queue{uart};
+ *
+ * static constexpr std::array<char, 5> header{'H', 'E', 'L', 'L', 'O'};
+ * std::array<char, 64> telemetry{};
+ *
+ * tx_queue.Transmit(header);       // Starts DMA immediately if idle
+ * tx_queue.Transmit(telemetry);    // Chained from TX complete ISR
+ * @endcode
+ */
+template <IsUart UartT, IsUartTransmitQueueCapacity CapacityT>
+class UartTransmitQueue {
+    using WorkingModeT = typename UartT::DefaultWorkingModeT;
+    static_assert(
+        !std::same_as<WorkingModeT, WorkingMode::Blocking>,
+        "UartTransmitQueue requires a Uart in WorkingMode::Interrupt or WorkingMode::DMA"
+    );
+public:
+
+    /**
+     * @brief Construct UartTransmitQueue class.
+     * 
+     * @param uart              Reference to the Uart to transmit on.
+     * @param release_callback  Callback function to be called with each queued buffer once it
+     *                          is transmitted or dropped, in interrupt context (or from the
+     *                          completion queue, see Uart::SetCompletionQueue()), and from the
+     *                          calling context for the buffers dropped by Clear().
+     * 
+     * @note Takes over the transmit complete callback of uart.
+     */
+    explicit UartTransmitQueue(
+        UartT& uart,
+        EventCallbackT<std::span<const char>>&& release_callback = [](std::span<const char>){}
+    ) noexcept
+      : m_uart{uart},
+        m_release_callback{std::move(release_callback)}
+    {
+        m_uart.m_transmit_complete_callback.Set(CallbackT{[this](){
+            OnTransmitComplete();
+        }});
+        __Internal::__CriticalSection critical_section{};
+        m_uart.m_transmit_error_callback = [this]([[maybe_unused]] std::uint32_t error_code){
+            OnTransmitError();
+        };
+    }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    UartTransmitQueue(const UartTransmitQueue&) = delete;
+    UartTransmitQueue& operator=(const UartTransmitQueue&) = delete;
+    UartTransmitQueue(UartTransmitQueue&&) = delete;
+    UartTransmitQueue& operator=(UartTransmitQueue&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Destroy UartTransmitQueue class, aborts pending transmission.
+     */
+    ~UartTransmitQueue()
+    {
+        Clear();
+        m_uart.m_transmit_complete_callback.Clear();
+        __Internal::__CriticalSection critical_section{};
+        m_uart.m_transmit_error_callback = nullptr;
+    }
+
+    /**
+     * @returns Maximum number of queued messages.
+     */
+    [[nodiscard]]
+    static constexpr std::size_t Capacity() noexcept
+    {
+        return CapacityT::value;
+    }
+
+    /**
+     * @returns Number of queued messages, including the one in flight.
+     */
+    [[nodiscard]]
+    std::size_t Size() const noexcept
+    {
+        return m_entries.Size();
+    }
+
+    /**
+     * @returns True if no message is queued.
+     */
+    [[nodiscard]]
+    bool IsEmpty() const noexcept
+    {
+        return m_entries.IsEmpty();
+    }
+
+    /**
+     * @returns True if no more messages can be queued.
+     */
+    [[nodiscard]]
+    bool IsFull() const noexcept
+    {
+        return m_entries.IsFull();
+    }
+
+    /**
+     * @brief Queue a message buffer for transmission.
+     * 
+     * Starts the transfer immediately if the line is idle, otherwise the message
+     * is transmitted from the TX complete interrupt after the queued ones.
+     * 
+     * @param tx_message    A contiguous range containing the message to transmit.
+     * 
+     * @returns True if the message is queued, false if the queue is full or
+     *          tx_message is empty.
+     * 
+     * @warning Buffer sizes exceeding 65535 bytes are silently clamped to 65535.
+     *          Only the first 65535 bytes will be transmitted for oversized buffers.
+     */
+    bool Transmit(const IsUartMessage auto& tx_message) noexcept
+    {
+        const auto size = __Internal::__ClampMessageLength<std::uint16_t>(
+            std::ranges::size(tx_message)
+        );
+        if (size == 0 || !m_entries.Push(std::span<const char>{std::ranges::data(tx_message), size})) {
+            return false;
+        }
+        __Internal::__CriticalSection critical_section{};
+        if (!m_busy.load(std::memory_order_relaxed)) {
+            StartNext();
+        }
+        return true;
+    }
+
+    /**
+     * @brief Abort the transfer in flight and drop all queued messages.
+     * 
+     * The release callback is invoked for every dropped message.
+     */
+    void Clear() noexcept
+    {
+        __Internal::__CriticalSection critical_section{};
+        if (m_busy.load(std::memory_order_relaxed)) {
+            HAL_UART_AbortTransmit(&m_uart.GetHandle());
+            m_busy.store(false, std::memory_order_relaxed);
+        }
+        while (!IsEmpty()) {
+            Release();
         }
     }
 
 private:
-    UART_HandleTypeDef& m_handle;
-    TransmitCompleteCallbackT m_transmit_complete_callback;
-    ReceiveCompleteCallbackT m_receive_complete_callback;
+    UartT& m_uart;
+    EventCallbackT<std::span<const char>> m_release_callback;
+    __Internal::__RingBuffer<std::span<const char>, CapacityT::value> m_entries{};
+    std::atomic<bool> m_busy{};
+
+    /**
+     * @brief Pop the oldest queued message and hand it back through the release callback.
+     */
+    void Release() noexcept
+    {
+        m_release_callback(m_entries.Front());
+        m_entries.CommitRead(1);
+    }
+
+    /**
+     * @brief Start the oldest queued message, dropping the ones that fail to start.
+     */
+    void StartNext() noexcept
+    {
+        while (!IsEmpty()) {
+            if (Start(m_entries.Front())) {
+                m_busy.store(true, std::memory_order_relaxed);
+                return;
+            }
+            Release();
+        }
+        m_busy.store(false, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Start the transfer of a message.
+     * 
+     * @param message   Queued message.
+     * 
+     * @returns True on success, false otherwise.
+     */
+    bool Start(std::span<const char> message) noexcept
+    {
+        const auto size = static_cast<std::uint16_t>(message.size());
+        auto* data = reinterpret_cast<std::uint8_t*>(const_cast<char*>(message.data()));
+        if constexpr (std::same_as<WorkingModeT, WorkingMode::Interrupt>) {
+            return __Internal::__Measure<InstrumentationProbe::UartTransmit, __Internal::__ProbeBytes::OnComplete>(
+                m_uart.GetHandle(), size, HAL_UART_Transmit_IT, data, size
+            );
+        } else if constexpr (std::same_as<WorkingModeT, WorkingMode::DMA>) {
+            return __Internal::__Measure<InstrumentationProbe::UartTransmit, __Internal::__ProbeBytes::OnComplete>(
+                m_uart.GetHandle(), size, HAL_UART_Transmit_DMA, data, size
+            );
+        }
+    }
+
+    /**
+     * @brief TX complete handler, chains the next queued message from interrupt context.
+     */
+    void OnTransmitComplete() noexcept
+    {
+        if (!m_busy.load(std::memory_order_relaxed)) {
+            return;
+        }
+        Release();
+        StartNext();
+    }
+
+    /**
+     * @brief UART error handler, drops the message in flight if HAL ended its transfer.
+     * 
+     * Errors leaving the transmission running (e.g., RX noise or overrun) are ignored.
+     */
+    void OnTransmitError() noexcept
+    {
+        if (!m_busy.load(std::memory_order_relaxed) ||
+            m_uart.GetHandle().gState != HAL_UART_STATE_READY) {
+            return;
+        }
+        Release();
+        StartNext();
+    }
 };
 
 } /* namespace STM32 */
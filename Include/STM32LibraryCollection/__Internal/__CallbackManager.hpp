@@ -4,14 +4,88 @@
 #ifndef STM32_CALLBACK_MANAGER_HPP
 #define STM32_CALLBACK_MANAGER_HPP
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#include "__CriticalSection.hpp"
 #include "__InplaceFunction.hpp"
+#include "__Instrumentation.hpp"
+
+/**
+ * @def STM32_CALLBACK_CAPACITY
+ * @brief Size of the callable buffer of CallbackT and EventCallbackT in bytes.
+ *
+ * Define before including the library to trade capture size for RAM (default is 64).
+ * Stateless callables need no buffer, lambdas capturing `this` need one pointer.
+ */
+#if !defined(STM32_CALLBACK_CAPACITY)
+#define STM32_CALLBACK_CAPACITY 64
+#endif
+
+/**
+ * @def STM32_CALLBACK_ALIGNMENT
+ * @brief Alignment of the callable buffer of CallbackT and EventCallbackT in bytes.
+ *
+ * Define before including the library, e.g. as alignof(void*) when no callback
+ * captures 8-byte values by copy (default is alignof(std::max_align_t)).
+ */
+#if !defined(STM32_CALLBACK_ALIGNMENT)
+#define STM32_CALLBACK_ALIGNMENT alignof(std::max_align_t)
+#endif
+
+/**
+ * @def STM32_CALLBACK_INSTANCE_CAPACITY
+ * @brief Maximum number of live __InstanceCallbackManager instances per handle type and callback ID.
+ *
+ * Define before including the library to support more peripheral instances (default is 4).
+ * Constructing one more instance calls STM32_CALLBACK_INSTANCE_OVERFLOW().
+ */
+#if !defined(STM32_CALLBACK_INSTANCE_CAPACITY)
+#define STM32_CALLBACK_INSTANCE_CAPACITY 4
+#endif
+
+/**
+ * @def STM32_CALLBACK_INSTANCE_OVERFLOW
+ * @brief Called when an __InstanceCallbackManager finds no free table entry (see STM32_CALLBACK_INSTANCE_CAPACITY).
+ *
+ * The peripheral callbacks of that instance would never run. Define before including
+ * the library to report the overflow differently (default is Error_Handler() of CubeMX main.h).
+ */
+#if !defined(STM32_CALLBACK_INSTANCE_OVERFLOW)
+#define STM32_CALLBACK_INSTANCE_OVERFLOW() Error_Handler()
+#endif
+
+/**
+ * @def STM32_CALLBACK_DEFER_CAPACITY
+ * @brief Number of distinct callbacks an __InstanceCallbackManager keeps for posted, not yet run work.
+ *
+ * A callback replaced (e.g., by the next transfer) while its posted work is pending
+ * is kept until the work has run. Define before including the library to trade RAM
+ * for deeper deferral (default is 2). Beyond it, callbacks run in interrupt context.
+ */
+#if !defined(STM32_CALLBACK_DEFER_CAPACITY)
+#define STM32_CALLBACK_DEFER_CAPACITY 2
+#endif
 
 namespace STM32 {
 
 /**
  * @typedef CallbackT, Non-allocating callback type for embedded systems.
+ *
+ * @note The buffer size is STM32_CALLBACK_CAPACITY bytes aligned to STM32_CALLBACK_ALIGNMENT.
  */
-using CallbackT = __Internal::__InplaceFunction<>;
+using CallbackT = __Internal::__InplaceFunction<STM32_CALLBACK_CAPACITY, STM32_CALLBACK_ALIGNMENT>;
+
+/**
+ * @typedef EventCallbackT, Non-allocating callback type receiving event arguments.
+ * 
+ * @tparam ArgsT    Argument types passed to the callback (e.g., received data span).
+ */
+template <typename... ArgsT>
+using EventCallbackT = __Internal::__InplaceFunction<STM32_CALLBACK_CAPACITY, STM32_CALLBACK_ALIGNMENT, ArgsT...>;
 
 namespace __Internal {
 
@@ -146,10 +220,11 @@ public:
      * 
      * Automatically registered with HAL. Invokes the stored callback if set.
      * 
-     * @param handle    Pointer to the peripheral handle (unused).
+     * @param handle    Pointer to the peripheral handle, keys the CallbackDispatch statistics.
      */
-    static void Invoke([[maybe_unused]] HandleT* handle) noexcept
+    static void Invoke(HandleT* handle) noexcept
     {
+        [[maybe_unused]] __Probe<InstrumentationProbe::CallbackDispatch> probe{handle};
         if (s_callback) {
             s_callback();
         }
@@ -160,6 +235,503 @@ private:
     static inline CallbackT s_callback{};
 };
 
+/**
+ * @class __EventCallbackManager, A self-registering RAII callback manager for HAL event callbacks.
+ * 
+ * Counterpart of __CallbackManager for HAL callbacks that have a dedicated registration
+ * function without a callback ID and pass extra arguments to the callback
+ * (e.g., HAL_UART_RegisterRxEventCallback with `void (*)(UART_HandleTypeDef*, uint16_t)`).
+ * 
+ * @tparam HandleT                 Type of the HAL peripheral handle (e.g., UART_HandleTypeDef).
+ * @tparam PeripheralUniqueTagT    Unique tag type to differentiate peripheral instances.
+ *                                 Must be created via STM32_UNIQUE_TAG macro at instantiation site.
+ * @tparam CallbackUniqueTagT      Unique tag type to differentiate callback purposes.
+ *                                 Use STM32_UNIQUE_TAG on separate lines within the class.
+ * @tparam HalRegisterFunctionT    HAL registration function (e.g., HAL_UART_RegisterRxEventCallback).
+ * @tparam HalUnregisterFunctionT  HAL unregistration function (e.g., HAL_UART_UnRegisterRxEventCallback).
+ * @tparam ArgsT                   Extra arguments passed by HAL after the handle pointer.
+ * 
+ * @note This is an internal class. Do not use directly in application code.
+ * 
+ * @example Usage Pattern:
+ * 
+ * @code {.cpp}
+ * using ReceiveEventCallbackT = __Internal::__EventCallbackManager<
+ *     UART_HandleTypeDef, UniqueTagT, STM32_UNIQUE_TAG,
+ *     HAL_UART_RegisterRxEventCallback, HAL_UART_UnRegisterRxEventCallback,
+ *     std::uint16_t
+ * >;
+ * 
+ * ReceiveEventCallbackT m_receive_event_callback{handle};
+ * 
+ * m_receive_event_callback.Set([](std::uint16_t position){
+ *     // Handle reception event up to position
+ * });
+ * @endcode
+ */
+template <
+    typename HandleT,
+    typename PeripheralUniqueTagT,
+    typename CallbackUniqueTagT,
+    auto HalRegisterFunctionT,
+    auto HalUnregisterFunctionT,
+    typename... ArgsT
+>
+class __EventCallbackManager {
+public:
+
+    /**
+     * @brief Construct and register with HAL.
+     * 
+     * @param handle    Reference to the peripheral handle.
+     */
+    explicit __EventCallbackManager(HandleT& handle) noexcept
+      : m_handle{handle}
+    {
+        HalRegisterFunctionT(&m_handle, &__EventCallbackManager::Invoke);
+    }
+
+    /**
+     * @brief Destroy and unregister from HAL.
+     */
+    ~__EventCallbackManager()
+    {
+        HalUnregisterFunctionT(&m_handle);
+        s_callback = nullptr;
+    }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    __EventCallbackManager(const __EventCallbackManager&) = delete;
+    __EventCallbackManager& operator=(const __EventCallbackManager&) = delete;
+    __EventCallbackManager(__EventCallbackManager&&) = delete;
+    __EventCallbackManager& operator=(__EventCallbackManager&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Set a callback.
+     * 
+     * @param callback  Callback function to invoke upon event.
+     */
+    void Set(EventCallbackT<ArgsT...>&& callback) noexcept
+    {
+        s_callback = std::move(callback);
+    }
+
+    /**
+     * @brief Clear the callback.
+     */
+    void Clear() noexcept
+    {
+        s_callback = nullptr;
+    }
+
+    /**
+     * @brief HAL-compatible callback function pointer.
+     * 
+     * Automatically registered with HAL. Invokes the stored callback if set.
+     * 
+     * @param handle    Pointer to the peripheral handle, keys the CallbackDispatch statistics.
+     * @param args      Event arguments passed by HAL.
+     */
+    static void Invoke(HandleT* handle, ArgsT... args) noexcept
+    {
+        [[maybe_unused]] __Probe<InstrumentationProbe::CallbackDispatch> probe{handle};
+        if (s_callback) {
+            s_callback(args...);
+        }
+    }
+
+private:
+    HandleT& m_handle;
+    static inline EventCallbackT<ArgsT...> s_callback{};
+};
+
+/**
+ * @brief HAL error code of a peripheral handle, __InstanceCallbackManager argument.
+ *
+ * @tparam HandleT  Type of the HAL peripheral handle (e.g., SPI_HandleTypeDef).
+ *
+ * @param handle    Peripheral handle passed to the HAL callback.
+ *
+ * @returns HAL error code (e.g., HAL_SPI_ERROR_OVR).
+ */
+template <typename HandleT>
+std::uint32_t __HalErrorCode(const HandleT& handle) noexcept
+{
+    return handle.ErrorCode;
+}
+
+/**
+ * @brief Bytes transmitted by the completed transfer of a peripheral handle, __InstanceCallbackManager argument.
+ *
+ * @tparam HandleT  Type of the HAL peripheral handle (e.g., UART_HandleTypeDef).
+ *
+ * @param handle    Peripheral handle passed to the HAL callback.
+ *
+ * @returns TxXferSize - TxXferCount.
+ */
+template <typename HandleT>
+std::uint16_t __HalTransmittedLength(const HandleT& handle) noexcept
+{
+    return static_cast<std::uint16_t>(handle.TxXferSize - handle.TxXferCount);
+}
+
+/**
+ * @brief Bytes received by the completed transfer of a peripheral handle, __InstanceCallbackManager argument.
+ *
+ * @tparam HandleT  Type of the HAL peripheral handle (e.g., UART_HandleTypeDef).
+ *
+ * @param handle    Peripheral handle passed to the HAL callback.
+ *
+ * @returns RxXferSize - RxXferCount.
+ */
+template <typename HandleT>
+std::uint16_t __HalReceivedLength(const HandleT& handle) noexcept
+{
+    return static_cast<std::uint16_t>(handle.RxXferSize - handle.RxXferCount);
+}
+
+/**
+ * @class __InstanceCallbackManager, A self-registering RAII callback manager with per-instance storage.
+ *
+ * Counterpart of __CallbackManager without a unique tag: all instances with the
+ * same handle type and callback ID share one template instantiation, and the
+ * callback is stored in the instance instead of a static slot. On construction
+ * the instance takes a free entry of a static table and registers the matching
+ * trampoline of a compile-time trampoline table with HAL, so the trampoline
+ * reaches its instance in O(1) without searching for the handle.
+ *
+ * ArgumentsV are functions reading event data from the handle (e.g., __HalErrorCode),
+ * their results are passed to the callback, so callbacks do not have to query HAL.
+ * CompleteV is called with the handle on every event before the callback, even
+ * when no callback is set (e.g., __ProbeComplete counting the bytes of a transfer).
+ *
+ * @tparam HandleT                 Type of the HAL peripheral handle (e.g., SPI_HandleTypeDef).
+ * @tparam HalRegisterFunctionT    HAL registration function (e.g., HAL_SPI_RegisterCallback).
+ * @tparam HalUnregisterFunctionT  HAL unregistration function (e.g., HAL_SPI_UnRegisterCallback).
+ * @tparam HalCallbackIdV          HAL callback ID constant (e.g., HAL_SPI_ERROR_CB_ID).
+ * @tparam CompleteV               Function taking `const void*` or nullptr (default is nullptr).
+ * @tparam ArgumentsV              Functions taking `const HandleT&`, their results are the callback arguments.
+ *
+ * @note This is an internal class. Do not use directly in application code.
+ * @note At most STM32_CALLBACK_INSTANCE_CAPACITY instances may exist at the same time,
+ *       further instances call STM32_CALLBACK_INSTANCE_OVERFLOW() and are not registered.
+ * @note With ArgumentsV, Set() also takes a CallbackT ignoring the arguments, the
+ *       callback buffer is then sizeof(CallbackT) bytes to hold it.
+ * @note ArgumentsV must be named functions, lambdas in class templates would create
+ *       a distinct instantiation per enclosing specialization.
+ *
+ * @example Usage Pattern:
+ *
+ * @code {.cpp}
+ * using ErrorCallbackT = __Internal::__InstanceCallbackManager<
+ *     SPI_HandleTypeDef,
+ *     HAL_SPI_RegisterCallback, HAL_SPI_UnRegisterCallback, HAL_SPI_ERROR_CB_ID,
+ *     nullptr, __Internal::__HalErrorCode<SPI_HandleTypeDef>
+ * >;
+ *
+ * ErrorCallbackT m_error_callback{handle};
+ *
+ * m_error_callback.Set([](std::uint32_t error_code){
+ *     // Handle the error without calling HAL_SPI_GetError()
+ * });
+ * @endcode
+ */
+template <
+    typename HandleT,
+    auto HalRegisterFunctionT,
+    auto HalUnregisterFunctionT,
+    auto HalCallbackIdV,
+    auto CompleteV = nullptr,
+    auto... ArgumentsV
+>
+class __InstanceCallbackManager {
+    static constexpr std::size_t s_capacity{STM32_CALLBACK_INSTANCE_CAPACITY};
+    static constexpr std::size_t s_defer_capacity{STM32_CALLBACK_DEFER_CAPACITY};
+
+    static_assert(s_capacity > 0, "STM32_CALLBACK_INSTANCE_CAPACITY must be greater than zero!");
+    static_assert(s_defer_capacity > 0, "STM32_CALLBACK_DEFER_CAPACITY must be greater than zero!");
+public:
+
+    /**
+     * @typedef CallbackType, Callback type receiving the results of ArgumentsV.
+     */
+    using CallbackType = std::conditional_t<
+        sizeof...(ArgumentsV) == 0,
+        CallbackT,
+        __InplaceFunction<
+            sizeof(CallbackT), alignof(CallbackT),
+            std::invoke_result_t<decltype(ArgumentsV), const HandleT&>...
+        >
+    >;
+
+    /**
+     * @brief Construct, take a table entry and register with HAL.
+     *
+     * @param handle    Reference to the peripheral handle.
+     */
+    explicit __InstanceCallbackManager(HandleT& handle) noexcept
+      : m_handle{handle}
+    {
+        {
+            __CriticalSection critical_section{};
+            for (std::size_t slot = 0; slot < s_capacity; ++slot) {
+                if (s_instances[slot] == nullptr) {
+                    s_instances[slot] = this;
+                    m_slot = slot;
+                    break;
+                }
+            }
+        }
+        if (!IsRegistered()) {
+            STM32_CALLBACK_INSTANCE_OVERFLOW();
+            return;
+        }
+        HalRegisterFunctionT(&m_handle, HalCallbackIdV, Trampoline(m_slot));
+    }
+
+    /**
+     * @brief Destroy, unregister from HAL and release the table entry.
+     *
+     * Work posted but not run yet is dropped.
+     */
+    ~__InstanceCallbackManager()
+    {
+        if (IsRegistered()) {
+            HalUnregisterFunctionT(&m_handle, HalCallbackIdV);
+            __CriticalSection critical_section{};
+            s_instances[m_slot] = nullptr;
+            ++s_generations[m_slot];
+        }
+    }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    __InstanceCallbackManager(const __InstanceCallbackManager&) = delete;
+    __InstanceCallbackManager& operator=(const __InstanceCallbackManager&) = delete;
+    __InstanceCallbackManager(__InstanceCallbackManager&&) = delete;
+    __InstanceCallbackManager& operator=(__InstanceCallbackManager&&) = delete;
+    /** @} */
+
+    /**
+     * @returns True if a table entry was available and the callback is registered with HAL.
+     */
+    [[nodiscard]]
+    bool IsRegistered() const noexcept
+    {
+        return m_slot < s_capacity;
+    }
+
+    /**
+     * @returns True if a callback is set, including one lent to pending deferred work.
+     */
+    [[nodiscard]]
+    bool IsSet() const noexcept
+    {
+        __CriticalSection critical_section{};
+        return (m_lent < s_defer_capacity) ? static_cast<bool>(m_deferred[m_lent]) : static_cast<bool>(m_callback);
+    }
+
+    /**
+     * @brief Set a callback.
+     *
+     * @param callback  Callback function to invoke upon event completion.
+     */
+    void Set(CallbackType&& callback) noexcept
+    {
+        __CriticalSection critical_section{};
+        m_lent = s_defer_capacity;
+        m_callback = std::move(callback);
+    }
+
+    /**
+     * @brief Set a callback ignoring the ArgumentsV results.
+     *
+     * @param callback  Callback function to invoke upon event completion.
+     */
+    void Set(CallbackT&& callback) noexcept
+    requires (sizeof...(ArgumentsV) != 0)
+    {
+        Set(CallbackType{[callback = std::move(callback)]([[maybe_unused]] auto... arguments) noexcept {
+            callback();
+        }});
+    }
+
+    /**
+     * @brief Clear the callback.
+     */
+    void Clear() noexcept
+    {
+        __CriticalSection critical_section{};
+        m_lent = s_defer_capacity;
+        m_callback = nullptr;
+    }
+
+    /**
+     * @brief Post the callback invocations to a deferred-work queue instead of running them in interrupt context.
+     *
+     * @tparam PostArgumentsV  Trailing arguments of QueueT::Post() (e.g., EventPriority::High).
+     *
+     * @param queue     Queue providing `bool Post(CallbackT&&, PostArgumentsV...)` (e.g., EventQueue).
+     *
+     * @note The posted work calls the callback set when the event occurred, with the ArgumentsV
+     *       results read in interrupt context, even if Set() replaces it before the work runs.
+     * @note If the queue is full or STM32_CALLBACK_DEFER_CAPACITY callbacks are pending,
+     *       the callback runs in interrupt context.
+     */
+    template <auto... PostArgumentsV, typename QueueT>
+    void Defer(QueueT& queue) noexcept
+    {
+        __CriticalSection critical_section{};
+        m_queue = &queue;
+        m_post = [](void* queue_pointer, CallbackT&& work) noexcept {
+            return static_cast<QueueT*>(queue_pointer)->Post(std::move(work), PostArgumentsV...);
+        };
+    }
+
+    /**
+     * @brief Run the callback invocations in interrupt context again.
+     *
+     * @note Work already posted still runs from the queue.
+     */
+    void ClearDefer() noexcept
+    {
+        __CriticalSection critical_section{};
+        m_queue = nullptr;
+        m_post = nullptr;
+    }
+
+private:
+    HandleT& m_handle;
+    CallbackType m_callback{};
+    std::size_t m_slot{s_capacity};
+    void* m_queue{};
+    bool (*m_post)(void*, CallbackT&&) noexcept {};
+    std::array<CallbackType, s_defer_capacity> m_deferred{};
+    std::array<std::size_t, s_defer_capacity> m_deferred_uses{};
+    std::size_t m_lent{s_defer_capacity};
+    static inline std::array<__InstanceCallbackManager*, s_capacity> s_instances{};
+    static inline std::array<std::size_t, s_capacity> s_generations{};
+
+    /**
+     * @returns The callback to run now, lent to a deferred entry while its work is pending.
+     */
+    CallbackType& Current() noexcept
+    {
+        return (m_lent < s_defer_capacity) ? m_deferred[m_lent] : m_callback;
+    }
+
+    /**
+     * @brief Lend the current callback to a deferred entry and post work running it.
+     *
+     * @tparam SlotV    Table entry of the instance.
+     *
+     * @param arguments ArgumentsV results read in interrupt context.
+     *
+     * @returns True if the work is posted, false otherwise.
+     */
+    template <std::size_t SlotV>
+    bool Post(auto... arguments) noexcept
+    {
+        auto entry = m_lent;
+        if (entry == s_defer_capacity) {
+            for (entry = 0; entry < s_defer_capacity && m_deferred_uses[entry] != 0; ++entry) { }
+            if (entry == s_defer_capacity) {
+                return false;
+            }
+        }
+        const auto generation = s_generations[SlotV];
+        if (!m_post(m_queue, [entry, generation, arguments...](){
+                RunDeferred<SlotV>(entry, generation, arguments...);
+            })) {
+            return false;
+        }
+        if (m_lent != entry) {
+            m_deferred[entry] = std::move(m_callback);
+            m_lent = entry;
+        }
+        ++m_deferred_uses[entry];
+        return true;
+    }
+
+    /**
+     * @brief Posted work, runs a lent callback unless its instance has been destroyed.
+     *
+     * The callback returns to the instance after its last pending work, unless it has been replaced.
+     *
+     * @tparam SlotV        Table entry of the instance.
+     *
+     * @param entry         Deferred entry holding the callback.
+     * @param generation    Generation of the table entry when the work was posted.
+     * @param arguments     ArgumentsV results read in interrupt context.
+     */
+    template <std::size_t SlotV>
+    static void RunDeferred(std::size_t entry, std::size_t generation, auto... arguments) noexcept
+    {
+        auto* instance = s_instances[SlotV];
+        if (instance == nullptr || s_generations[SlotV] != generation) {
+            return;
+        }
+        if (instance->m_deferred[entry]) {
+            instance->m_deferred[entry](arguments...);
+        }
+        __CriticalSection critical_section{};
+        if (s_instances[SlotV] != instance || s_generations[SlotV] != generation) {
+            return;
+        }
+        if (--instance->m_deferred_uses[entry] != 0) {
+            return;
+        }
+        if (instance->m_lent == entry) {
+            instance->m_callback = std::move(instance->m_deferred[entry]);
+            instance->m_lent = s_defer_capacity;
+        }
+        instance->m_deferred[entry] = nullptr;
+    }
+
+    /**
+     * @brief HAL-compatible callback function pointer of one table entry.
+     *
+     * @tparam SlotV    Table entry of the instance.
+     *
+     * @param handle    Pointer to the peripheral handle, passed to CompleteV and ArgumentsV.
+     */
+    template <std::size_t SlotV>
+    static void Invoke(HandleT* handle) noexcept
+    {
+        [[maybe_unused]] __Probe<InstrumentationProbe::CallbackDispatch> probe{handle};
+        if constexpr (!std::is_null_pointer_v<decltype(CompleteV)>) {
+            CompleteV(handle);
+        }
+        auto* instance = s_instances[SlotV];
+        if (instance == nullptr || !instance->Current()) {
+            return;
+        }
+        if (instance->m_post != nullptr && instance->template Post<SlotV>(ArgumentsV(*handle)...)) {
+            return;
+        }
+        instance->Current()(ArgumentsV(*handle)...);
+    }
+
+    /**
+     * @returns Trampoline of a table entry, from a compile-time table.
+     *
+     * @param slot      Table entry of the instance.
+     */
+    static auto Trampoline(std::size_t slot) noexcept
+    {
+        static constexpr auto trampolines = []<std::size_t... SlotsV>(std::index_sequence<SlotsV...>){
+            return std::array{&__InstanceCallbackManager::Invoke<SlotsV>...};
+        }(std::make_index_sequence<s_capacity>{});
+        return trampolines[slot];
+    }
+};
+
 } /* namespace __Internal */
 
 } /* namespace STM32 */
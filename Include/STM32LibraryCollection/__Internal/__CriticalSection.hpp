@@ -0,0 +1,71 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_CRITICAL_SECTION_HPP
+#define STM32_CRITICAL_SECTION_HPP
+
+#include <cstdint>
+
+#include "main.h"
+
+namespace STM32 {
+
+namespace __Internal {
+
+/**
+ * @class __CriticalSection, A scoped RAII guard that masks interrupts.
+ * 
+ * Saves PRIMASK and disables interrupts on construction, restores the saved
+ * PRIMASK on destruction. Nesting is safe: an inner guard restores the masked
+ * state, only the outermost guard re-enables interrupts.
+ * 
+ * @note Keep the guarded region as short as possible, it adds interrupt latency.
+ * @note This is an internal class. Do not use directly in application code.
+ * 
+ * @example Usage:
+ * @code {.cpp}
+ * {
+ *     __Internal::__CriticalSection critical_section{};
+ *     // Check and update state shared with an ISR
+ * }
+ * @endcode
+ */
+class __CriticalSection {
+public:
+
+    /**
+     * @brief Save PRIMASK and disable interrupts.
+     */
+    __CriticalSection() noexcept
+      : m_primask{__get_PRIMASK()}
+    {
+        __disable_irq();
+    }
+
+    /**
+     * @brief Restore the saved PRIMASK.
+     */
+    ~__CriticalSection()
+    {
+        __set_PRIMASK(m_primask);
+    }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    __CriticalSection(const __CriticalSection&) = delete;
+    __CriticalSection& operator=(const __CriticalSection&) = delete;
+    __CriticalSection(__CriticalSection&&) = delete;
+    __CriticalSection& operator=(__CriticalSection&&) = delete;
+    /** @} */
+
+private:
+    std::uint32_t m_primask;
+};
+
+} /* namespace __Internal */
+
+} /* namespace STM32 */
+
+#endif /* STM32_CRITICAL_SECTION_HPP */
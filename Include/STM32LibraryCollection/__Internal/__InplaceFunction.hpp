@@ -6,6 +6,7 @@
 
 #include <concepts>
 #include <cstddef>
+#include <cstring>
 #include <memory>
 #include <type_traits>
 #include <utility>
@@ -14,6 +15,42 @@ namespace STM32 {
 
 namespace __Internal {
 
+/**
+ * @struct __InplaceStorage, Aligned in-place buffer of an __InplaceFunction.
+ *
+ * @tparam CapacityV     Size of the buffer in bytes, 0 for stateless callables only.
+ * @tparam AlignmentV    Alignment of the buffer in bytes.
+ *
+ * @note This is an internal class. Do not use directly in application code.
+ */
+template <std::size_t CapacityV, std::size_t AlignmentV>
+struct __InplaceStorage {
+    alignas(AlignmentV) std::byte bytes[CapacityV]{};
+
+    /**
+     * @returns Pointer to the buffer.
+     */
+    void* Data() noexcept
+    {
+        return bytes;
+    }
+};
+
+/**
+ * @brief __InplaceStorage specialization without a buffer.
+ */
+template <std::size_t AlignmentV>
+struct __InplaceStorage<0, AlignmentV> {
+
+    /**
+     * @returns nullptr, stateless callables are not stored.
+     */
+    void* Data() noexcept
+    {
+        return nullptr;
+    }
+};
+
 /**
  * @class __InplaceFunction, A non-allocating callable wrapper for embedded systems.
  * 
@@ -21,9 +58,17 @@ namespace __Internal {
  * function pointers, functors) without heap allocation. The callable is stored
  * in a fixed-size internal buffer (similar to std::inplace_function proposal).
  * 
+ * Besides the buffer, an instance holds a single pointer to a static table of
+ * operations shared by all instances storing the same callable type. Trivially
+ * copyable callables (e.g., lambdas capturing pointers or references, function
+ * pointers) are moved with a plain copy and are not destroyed, so only invocation
+ * is an indirect call. Stateless callables (e.g., lambdas without captures) are
+ * not stored at all and fit into any capacity, including 0.
+ * 
  * @tparam CapacityV     Size of the internal buffer in bytes (default: 64).
  *                       Must be large enough to hold the callable and its captures.
  * @tparam AlignmentV    Alignment requirement of the internal buffer in bytes (default: max alignment).
+ * @tparam ArgsT         Argument types passed to the callable on invocation (default: none).
  * 
  * If a callable exceeds the capacity, a static_assert will trigger at compile time.
  * 
@@ -32,12 +77,14 @@ namespace __Internal {
  * 
  * ## Typical Capture Sizes
  * 
- * - Empty lambda `[](){}`: ~1 byte
- * - One pointer capture `[ptr](){}`: ~8 bytes
- * - Two pointer captures `[a, b](){}`: ~16 bytes
- * - Reference capture (pointer internally): ~8 bytes per reference
+ * - Empty lambda `[](){}`: 0 bytes (not stored)
+ * - Function pointer: one pointer
+ * - One pointer capture `[ptr](){}`: one pointer
+ * - Two pointer captures `[a, b](){}`: two pointers
+ * - Reference capture (pointer internally): one pointer per reference
  * 
- * The default 64-byte capacity handles most common embedded callback patterns.
+ * The default 64-byte capacity handles most common embedded callback patterns,
+ * the library-wide CallbackT capacity is set by STM32_CALLBACK_CAPACITY.
  * 
  * @example Usage:
  * @code {.cpp}
@@ -50,10 +97,70 @@ namespace __Internal {
  * std::array<int, 100> big_data{};
  * __InplaceFunction<512> cb3 = [big_data]() { useBigData(big_data); };  // OK with larger capacity
  * // __InplaceFunction<32> cb4 = [big_data]() {};  // Compile error! Too large
+ * 
+ * // Callable taking arguments
+ * __InplaceFunction<64, alignof(std::max_align_t), std::uint16_t> cb5 = [](std::uint16_t size) { use(size); };
+ * cb5(42);
+ * 
+ * // Stateless callables only, sizeof(cb6) is one pointer
+ * __InplaceFunction<0> cb6 = []() { doSomething(); };
  * @endcode
  */
-template <std::size_t CapacityV = 64, std::size_t AlignmentV = alignof(std::max_align_t)>
+template <
+    std::size_t CapacityV = 64,
+    std::size_t AlignmentV = alignof(std::max_align_t),
+    typename... ArgsT
+>
 class __InplaceFunction {
+
+    /**
+     * @struct Operations, Static table of the operations of one callable type.
+     *
+     * Null move and destroy mean a trivially copyable callable, moved by copying size bytes.
+     */
+    struct Operations {
+        void (*invoke)(void*, ArgsT...) noexcept;
+        void (*move)(void*, void*) noexcept;
+        void (*destroy)(void*) noexcept;
+        std::size_t size;
+    };
+
+    template <typename F>
+    static constexpr bool s_is_stateless{
+        std::is_empty_v<F> &&
+        std::is_trivially_default_constructible_v<F> &&
+        std::is_trivially_destructible_v<F>
+    };
+
+    template <typename F>
+    static constexpr bool s_is_trivial{
+        s_is_stateless<F> || (
+            std::is_trivially_copyable_v<F> &&
+            std::is_trivially_destructible_v<F>
+        )
+    };
+
+    template <typename F>
+    static constexpr Operations s_operations{
+        .invoke = [](void* ptr, ArgsT... args) noexcept {
+            if constexpr (s_is_stateless<F>) {
+                F{}(std::forward<ArgsT>(args)...);
+            } else {
+                (*static_cast<F*>(ptr))(std::forward<ArgsT>(args)...);
+            }
+        },
+        .move = s_is_trivial<F> ? nullptr : +[](void* dst, void* src) noexcept {
+            std::construct_at(
+                static_cast<F*>(dst),
+                std::move(*static_cast<F*>(src))
+            );
+            std::destroy_at(static_cast<F*>(src));
+        },
+        .destroy = s_is_trivial<F> ? nullptr : +[](void* ptr) noexcept {
+            std::destroy_at(static_cast<F*>(ptr));
+        },
+        .size = s_is_stateless<F> ? 0 : sizeof(F)
+    };
 public:
 
     /**
@@ -71,47 +178,37 @@ public:
     /**
      * @brief Construct from a callable (lambda, functor, function pointer).
      * 
-     * @tparam F    Callable type (must be invocable with no arguments).
+     * @tparam F    Callable type (must be invocable with ArgsT...).
      * @param f     The callable to store.
      * 
-     * @note Fails at compile time if sizeof(F) > CapacityV.
+     * @note Fails at compile time if sizeof(F) > CapacityV, unless F is stateless.
      */
     template <typename F>
     __InplaceFunction(F&& f) noexcept
-    requires std::invocable<F> && 
+    requires std::invocable<F, ArgsT...> && 
         (!std::same_as<std::decay_t<F>, __InplaceFunction>)
     {
         using DecayedF = std::decay_t<F>;
-        static_assert(
-            sizeof(DecayedF) <= CapacityV,
-            "Callable captures too large for fixed buffer! "
-            "Reduce captures or increase __InplaceFunction capacity."
-        );
-        static_assert(
-            alignof(DecayedF) <= AlignmentV,
-            "Callable alignment requirement exceeds buffer alignment!"
-        );
-        static_assert(
-            std::is_nothrow_move_constructible_v<DecayedF>,
-            "Callable must be nothrow move constructible for embedded safety."
-        );
-        std::construct_at(
-            reinterpret_cast<DecayedF*>(m_storage),
-            std::forward<F>(f)
-        );
-        m_invoke = [](void* ptr) noexcept {
-            (*static_cast<DecayedF*>(ptr))();
-        };
-        m_destroy = [](void* ptr) noexcept {
-            std::destroy_at(static_cast<DecayedF*>(ptr));
-        };
-        m_move = [](void* dst, void* src) noexcept {
+        if constexpr (!s_is_stateless<DecayedF>) {
+            static_assert(
+                sizeof(DecayedF) <= CapacityV,
+                "Callable captures too large for fixed buffer! "
+                "Reduce captures or increase __InplaceFunction capacity."
+            );
+            static_assert(
+                alignof(DecayedF) <= AlignmentV,
+                "Callable alignment requirement exceeds buffer alignment!"
+            );
+            static_assert(
+                std::is_nothrow_move_constructible_v<DecayedF>,
+                "Callable must be nothrow move constructible for embedded safety."
+            );
             std::construct_at(
-                static_cast<DecayedF*>(dst),
-                std::move(*static_cast<DecayedF*>(src))
+                static_cast<DecayedF*>(m_storage.Data()),
+                std::forward<F>(f)
             );
-            std::destroy_at(static_cast<DecayedF*>(src));
-        };
+        }
+        m_operations = &s_operations<DecayedF>;
     }
 
     /**
@@ -128,16 +225,8 @@ public:
      * @param other     Function to move from (becomes null after move).
      */
     __InplaceFunction(__InplaceFunction&& other) noexcept
-      : m_invoke{other.m_invoke},
-        m_destroy{other.m_destroy},
-        m_move{other.m_move}
     {
-        if (m_move) {
-            m_move(m_storage, other.m_storage);
-        }
-        other.m_invoke = nullptr;
-        other.m_destroy = nullptr;
-        other.m_move = nullptr;
+        MoveFrom(other);
     }
 
     /**
@@ -151,15 +240,7 @@ public:
     {
         if (this != &other) {
             Reset();
-            m_invoke = other.m_invoke;
-            m_destroy = other.m_destroy;
-            m_move = other.m_move;
-            if (m_move) {
-                m_move(m_storage, other.m_storage);
-            }
-            other.m_invoke = nullptr;
-            other.m_destroy = nullptr;
-            other.m_move = nullptr;
+            MoveFrom(other);
         }
         return *this;
     }
@@ -193,7 +274,7 @@ public:
      */
     template <typename F>
     __InplaceFunction& operator=(F&& f) noexcept
-    requires std::invocable<F> && 
+    requires std::invocable<F, ArgsT...> && 
              (!std::same_as<std::decay_t<F>, __InplaceFunction>)
     {
         Reset();
@@ -204,12 +285,17 @@ public:
     /**
      * @brief Invoke the stored callable.
      * 
+     * @param args  Arguments forwarded to the stored callable.
+     * 
      * @note Does nothing if the function is null (safe to call on empty function).
      */
-    void operator()() const noexcept
+    void operator()(ArgsT... args) const noexcept
     {
-        if (m_invoke) {
-            m_invoke(const_cast<void*>(static_cast<const void*>(m_storage)));
+        if (m_operations) {
+            m_operations->invoke(
+                const_cast<__InplaceStorage<CapacityV, AlignmentV>&>(m_storage).Data(),
+                std::forward<ArgsT>(args)...
+            );
         }
     }
 
@@ -220,7 +306,7 @@ public:
      */
     explicit operator bool() const noexcept
     {
-        return m_invoke != nullptr;
+        return m_operations != nullptr;
     }
 
     /**
@@ -228,19 +314,33 @@ public:
      */
     void Reset() noexcept
     {
-        if (m_destroy) {
-            m_destroy(m_storage);
+        if (m_operations && m_operations->destroy) {
+            m_operations->destroy(m_storage.Data());
         }
-        m_invoke = nullptr;
-        m_destroy = nullptr;
-        m_move = nullptr;
+        m_operations = nullptr;
     }
 
 private:
-    alignas(AlignmentV) std::byte m_storage[CapacityV]{};
-    void (*m_invoke)(void*) noexcept = nullptr;
-    void (*m_destroy)(void*) noexcept = nullptr;
-    void (*m_move)(void*, void*) noexcept = nullptr;
+    [[no_unique_address]] __InplaceStorage<CapacityV, AlignmentV> m_storage{};
+    const Operations* m_operations{};
+
+    /**
+     * @brief Take over the callable of other, leaving other null.
+     * 
+     * @param other     Function to move from.
+     */
+    void MoveFrom(__InplaceFunction& other) noexcept
+    {
+        m_operations = other.m_operations;
+        if (m_operations) {
+            if (m_operations->move) {
+                m_operations->move(m_storage.Data(), other.m_storage.Data());
+            } else if (m_operations->size != 0) {
+                std::memcpy(m_storage.Data(), other.m_storage.Data(), m_operations->size);
+            }
+        }
+        other.m_operations = nullptr;
+    }
 };
 
 } /* namespace __Internal */
@@ -0,0 +1,365 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_INSTRUMENTATION_INTERNAL_HPP
+#define STM32_INSTRUMENTATION_INTERNAL_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <utility>
+
+#include "__CriticalSection.hpp"
+
+#include "main.h"
+
+/**
+ * @def STM32_INSTRUMENTATION
+ * @brief Enable the DWT cycle counter instrumentation of peripheral operations.
+ *
+ * Define as 1 before including the library to record latency histograms and
+ * transfer statistics (default is 0, probes then compile to nothing).
+ */
+#if !defined(STM32_INSTRUMENTATION)
+#define STM32_INSTRUMENTATION 0
+#endif
+
+/**
+ * @def STM32_INSTRUMENTATION_BUCKETS
+ * @brief Number of logarithmic latency histogram buckets per probe (1 to 33, default is 32).
+ */
+#if !defined(STM32_INSTRUMENTATION_BUCKETS)
+#define STM32_INSTRUMENTATION_BUCKETS 32
+#endif
+
+/**
+ * @def STM32_INSTRUMENTATION_ENTRIES
+ * @brief Number of counter entries, one per instrumented peripheral handle and probe (default is 16).
+ *
+ * Operations of a new handle and probe pair are not recorded once all entries are in use
+ * (see Instrumentation::Dropped()).
+ */
+#if !defined(STM32_INSTRUMENTATION_ENTRIES)
+#define STM32_INSTRUMENTATION_ENTRIES 16
+#endif
+
+#if STM32_INSTRUMENTATION && !defined(DWT_CTRL_CYCCNTENA_Msk) /* module check */
+#error "STM32_INSTRUMENTATION requires a core with the DWT cycle counter (Cortex-M3 and above)!"
+#endif
+
+namespace STM32 {
+
+/**
+ * @enum InstrumentationProbe, Instrumented peripheral operations.
+ *
+ * Interrupt and DMA transfers are measured until the transfer is started and
+ * count their bytes on completion, the completion itself is covered by CallbackDispatch.
+ */
+enum class InstrumentationProbe : std::uint8_t {
+    UartTransmit,
+    UartReceive,
+    SpiTransmit,
+    SpiReceive,
+    SpiTransmitReceive,
+    I2cTransmit,
+    I2cReceive,
+    I2cMemoryWrite,
+    I2cMemoryRead,
+    AdcConversion,
+    CallbackDispatch
+};
+
+/**
+ * @struct InstrumentationStats, Counters of one InstrumentationProbe of one peripheral handle.
+ *
+ * histogram[i] counts operations of [2^(i-1), 2^i) cycles (histogram[0] zero cycles),
+ * the last bucket also counts all longer operations.
+ */
+struct InstrumentationStats {
+    std::array<std::uint32_t, STM32_INSTRUMENTATION_BUCKETS> histogram;
+    std::uint64_t bytes;
+    std::uint32_t count;
+    std::uint32_t busy_count;
+    std::uint32_t error_count;
+    std::uint32_t max_cycles;
+};
+
+namespace __Internal {
+
+static_assert(
+    STM32_INSTRUMENTATION_BUCKETS > 0 && STM32_INSTRUMENTATION_BUCKETS <= 33,
+    "STM32_INSTRUMENTATION_BUCKETS must be in range [1, 33]!"
+);
+
+static_assert(
+    STM32_INSTRUMENTATION_ENTRIES > 0,
+    "STM32_INSTRUMENTATION_ENTRIES must be greater than zero!"
+);
+
+/**
+ * @enum __ProbeBytes, When a measured transfer counts its bytes.
+ */
+enum class __ProbeBytes : bool {
+    OnReturn,   /**< Blocking operations, when the HAL function returns HAL_OK. */
+    OnComplete  /**< Interrupt and DMA transfers, when the completion callback is dispatched. */
+};
+
+/**
+ * @brief Number of InstrumentationProbe values.
+ */
+inline constexpr std::size_t __instrumentation_probe_count{
+    static_cast<std::size_t>(InstrumentationProbe::CallbackDispatch) + 1
+};
+
+/**
+ * @brief Names of the InstrumentationProbe values.
+ */
+inline constexpr std::array<std::string_view, __instrumentation_probe_count> __instrumentation_probe_names{
+    "UartTransmit", "UartReceive",
+    "SpiTransmit", "SpiReceive", "SpiTransmitReceive",
+    "I2cTransmit", "I2cReceive", "I2cMemoryWrite", "I2cMemoryRead",
+    "AdcConversion",
+    "CallbackDispatch"
+};
+
+#if STM32_INSTRUMENTATION
+
+/**
+ * @struct __InstrumentationEntry, Counters of one peripheral handle and probe pair.
+ */
+struct __InstrumentationEntry {
+    const void* handle;
+    InstrumentationProbe probe;
+    std::size_t pending_bytes;
+    InstrumentationStats stats;
+};
+
+/**
+ * @brief Counter entries in order of first use, updated under a critical section.
+ */
+inline std::array<__InstrumentationEntry, STM32_INSTRUMENTATION_ENTRIES> __instrumentation_entries{};
+
+/**
+ * @brief Number of entries in use.
+ */
+inline std::size_t __instrumentation_entry_count{};
+
+/**
+ * @brief Number of operations not recorded because all entries are in use.
+ */
+inline std::uint32_t __instrumentation_dropped{};
+
+/**
+ * @returns Entry of a handle and probe pair, taking a free entry on first use, nullptr if none is free.
+ *
+ * @param handle    Peripheral handle.
+ * @param probe     Instrumented operation.
+ *
+ * @note Must be called inside a critical section.
+ */
+inline __InstrumentationEntry* __GetInstrumentationEntry(const void* handle, InstrumentationProbe probe) noexcept
+{
+    const auto first = __instrumentation_entries.begin();
+    const auto last = first + __instrumentation_entry_count;
+    const auto entry = std::find_if(first, last, [=](const __InstrumentationEntry& candidate){
+        return candidate.handle == handle && candidate.probe == probe;
+    });
+    if (entry != last) {
+        return &*entry;
+    }
+    if (__instrumentation_entry_count == __instrumentation_entries.size()) {
+        ++__instrumentation_dropped;
+        return nullptr;
+    }
+    ++__instrumentation_entry_count;
+    *entry = {.handle = handle, .probe = probe, .pending_bytes = 0, .stats = {}};
+    return &*entry;
+}
+
+/**
+ * @class __Probe, A scoped RAII guard measuring one operation with the DWT cycle counter.
+ *
+ * Reads CYCCNT on construction and records the elapsed cycles, the HAL status and
+ * the transferred bytes given to Finish() on destruction, in the entry of the handle.
+ *
+ * @tparam ProbeV       Probe to be recorded.
+ *
+ * @note This is an internal class. Do not use directly in application code, peripheral
+ *       transfers are measured with __Measure().
+ * @note With STM32_INSTRUMENTATION disabled the class is empty and Finish() returns its argument.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * __Internal::__Probe<InstrumentationProbe::AdcConversion> probe{&handle};
+ * return (HAL_OK == probe.Finish(HAL_ADC_PollForConversion(&handle, timeout), sizeof(value)));
+ * @endcode
+ */
+template <InstrumentationProbe ProbeV>
+class __Probe {
+public:
+
+    /**
+     * @brief Start the measurement.
+     *
+     * @param handle    Peripheral handle the operation belongs to.
+     */
+    explicit __Probe(const void* handle) noexcept
+      : m_handle{handle},
+        m_start{DWT->CYCCNT}
+    { }
+
+    /**
+     * @brief Record the measurement.
+     */
+    ~__Probe()
+    {
+        const std::uint32_t cycles{DWT->CYCCNT - m_start};
+        const auto bucket = std::min<std::size_t>(std::bit_width(cycles), STM32_INSTRUMENTATION_BUCKETS - 1);
+        __CriticalSection critical_section{};
+        auto* entry = __GetInstrumentationEntry(m_handle, ProbeV);
+        if (entry == nullptr) {
+            return;
+        }
+        auto& stats = entry->stats;
+        ++stats.histogram[bucket];
+        ++stats.count;
+        stats.max_cycles = std::max(stats.max_cycles, cycles);
+        if (m_status == HAL_OK) {
+            if (m_bytes_on == __ProbeBytes::OnReturn) {
+                stats.bytes += m_bytes;
+            } else {
+                entry->pending_bytes = m_bytes;
+            }
+        } else if (m_status == HAL_BUSY) {
+            ++stats.busy_count;
+        } else {
+            ++stats.error_count;
+        }
+    }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    __Probe(const __Probe&) = delete;
+    __Probe& operator=(const __Probe&) = delete;
+    __Probe(__Probe&&) = delete;
+    __Probe& operator=(__Probe&&) = delete;
+    /** @} */
+
+    /**
+     * @brief Set the outcome of the operation.
+     *
+     * @param status    HAL status of the operation.
+     * @param bytes     Bytes transferred on success.
+     * @param bytes_on  When the bytes are counted (default is __ProbeBytes::OnReturn).
+     *
+     * @returns status.
+     */
+    HAL_StatusTypeDef Finish(
+        HAL_StatusTypeDef status,
+        std::size_t bytes = 0,
+        __ProbeBytes bytes_on = __ProbeBytes::OnReturn
+    ) noexcept
+    {
+        m_status = status;
+        m_bytes = bytes;
+        m_bytes_on = bytes_on;
+        return status;
+    }
+
+private:
+    const void* m_handle;
+    std::uint32_t m_start;
+    HAL_StatusTypeDef m_status{HAL_OK};
+    std::size_t m_bytes{};
+    __ProbeBytes m_bytes_on{__ProbeBytes::OnReturn};
+};
+
+/**
+ * @brief Count the bytes of a started interrupt or DMA transfer, __InstanceCallbackManager completion hook.
+ *
+ * @tparam ProbeV   Probe of the completed transfer.
+ *
+ * @param handle    Peripheral handle passed to the HAL callback.
+ */
+template <InstrumentationProbe ProbeV>
+void __ProbeComplete(const void* handle) noexcept
+{
+    __CriticalSection critical_section{};
+    for (std::size_t index = 0; index < __instrumentation_entry_count; ++index) {
+        auto& entry = __instrumentation_entries[index];
+        if (entry.handle == handle && entry.probe == ProbeV) {
+            entry.stats.bytes += std::exchange(entry.pending_bytes, 0);
+            return;
+        }
+    }
+}
+
+#else
+
+template <InstrumentationProbe ProbeV>
+class __Probe {
+public:
+    explicit __Probe([[maybe_unused]] const void* handle) noexcept
+    { }
+
+    /**
+     * @defgroup Deleted copy and move members.
+     * @{
+     */
+    __Probe(const __Probe&) = delete;
+    __Probe& operator=(const __Probe&) = delete;
+    __Probe(__Probe&&) = delete;
+    __Probe& operator=(__Probe&&) = delete;
+    /** @} */
+
+    HAL_StatusTypeDef Finish(
+        HAL_StatusTypeDef status,
+        [[maybe_unused]] std::size_t bytes = 0,
+        [[maybe_unused]] __ProbeBytes bytes_on = __ProbeBytes::OnReturn
+    ) noexcept
+    {
+        return status;
+    }
+};
+
+template <InstrumentationProbe ProbeV>
+void __ProbeComplete([[maybe_unused]] const void* handle) noexcept
+{ }
+
+#endif /* STM32_INSTRUMENTATION */
+
+/**
+ * @brief Run and measure one HAL transfer function of a peripheral handle.
+ *
+ * @tparam ProbeV       Probe to be recorded.
+ * @tparam BytesOnV     When the bytes are counted (default is __ProbeBytes::OnReturn).
+ *
+ * @param handle        Peripheral handle, passed by address as the first HAL argument.
+ * @param bytes         Bytes transferred on success.
+ * @param function      HAL transfer function (e.g., HAL_UART_Transmit).
+ * @param arguments     Remaining HAL arguments.
+ *
+ * @returns True if the HAL function returns HAL_OK, false otherwise.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * return __Internal::__Measure<InstrumentationProbe::UartTransmit>(handle, length, HAL_UART_Transmit, data, length, timeout);
+ * @endcode
+ */
+template <InstrumentationProbe ProbeV, __ProbeBytes BytesOnV = __ProbeBytes::OnReturn, typename HandleT>
+bool __Measure(HandleT& handle, std::size_t bytes, auto function, auto... arguments) noexcept
+{
+    __Probe<ProbeV> probe{&handle};
+    return (HAL_OK == probe.Finish(function(&handle, arguments...), bytes, BytesOnV));
+}
+
+} /* namespace __Internal */
+
+} /* namespace STM32 */
+
+#endif /* STM32_INSTRUMENTATION_INTERNAL_HPP */
@@ -0,0 +1,244 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_LINEAR_SCALE_HPP
+#define STM32_LINEAR_SCALE_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace STM32 {
+
+namespace __Internal {
+
+/**
+ * @enum __ScaleRounding, Rounding mode of a fixed-point linear scale.
+ */
+enum class __ScaleRounding {
+    Nearest,    /**< Round to nearest, ties away from zero (like std::round) */
+    Truncate    /**< Round toward zero (like static_cast to an integer) */
+};
+
+/**
+ * @class __LinearScale, A compile-time fixed-point linear scaling engine.
+ *
+ * Computes `x * OutputRangeV / InputRangeV` for `x` in [0, InputRangeV] with
+ * integer multiply and shift only: `(x * multiplier + bias) >> shift`.
+ * The multiplier/shift pair is selected at compile time and is bit-exact with
+ * the rational result for every input in range, so it can replace floating-point
+ * conversions without changing any output value.
+ *
+ * Pair selection:
+ * - For small input ranges, the smallest shift whose multiplication fits in 32 bits
+ *   is searched and verified exhaustively against the exact result.
+ * - Otherwise (or if no 32-bit pair exists), a 64-bit pair with a shift that is
+ *   provably exact for the whole input range is used.
+ *
+ * @tparam InputRangeV      Size of the input range (must be > 0).
+ * @tparam OutputRangeV     Size of the output range.
+ * @tparam RoundingV        Rounding mode (default is __ScaleRounding::Nearest).
+ *
+ * @note Inputs greater than InputRangeV are clamped to InputRangeV.
+ * @note This is an internal class. Do not use directly in application code.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * // 12-bit ADC reading to percentage, rounded to nearest
+ * using AdcToPercent = __Internal::__LinearScale<4095, 100>;
+ * static_assert(AdcToPercent::Apply(4095) == 100);
+ * static_assert(AdcToPercent::Apply(2048) == 50);
+ * @endcode
+ */
+template <
+    std::uint32_t InputRangeV,
+    std::uint32_t OutputRangeV,
+    __ScaleRounding RoundingV = __ScaleRounding::Nearest
+>
+class __LinearScale {
+    static_assert(
+        InputRangeV > 0,
+        "Input range must be greater than zero"
+    );
+
+    struct __Coefficients {
+        std::uint64_t multiplier;
+        std::uint64_t bias;
+        unsigned shift;
+        bool is_narrow;
+    };
+
+    static constexpr std::uint64_t s_exhaustive_search_limit{4096};
+
+    /**
+     * @returns Exact scaled value computed with a rational expression.
+     */
+    static constexpr std::uint64_t Reference(std::uint64_t input) noexcept
+    {
+        if constexpr (RoundingV == __ScaleRounding::Nearest) {
+            return (2 * input * OutputRangeV + InputRangeV) / (2 * std::uint64_t{InputRangeV});
+        } else {
+            return (input * OutputRangeV) / InputRangeV;
+        }
+    }
+
+    /**
+     * @returns Multiplier and bias for a shift, multiplier is rounded up.
+     */
+    static consteval __Coefficients Candidate(unsigned shift, bool is_narrow) noexcept
+    {
+        const std::uint64_t numerator{std::uint64_t{OutputRangeV} << shift};
+        const std::uint64_t multiplier{(numerator + InputRangeV - 1) / InputRangeV};
+        const std::uint64_t bias{
+            (RoundingV == __ScaleRounding::Nearest && shift > 0) ? (std::uint64_t{1} << (shift - 1)) : 0
+        };
+        return {multiplier, bias, shift, is_narrow};
+    }
+
+    /**
+     * @returns Selected multiplier/shift pair.
+     */
+    static consteval __Coefficients Select() noexcept
+    {
+        if constexpr (InputRangeV <= s_exhaustive_search_limit) {
+            for (unsigned shift{}; shift < 32; ++shift) {
+                const auto candidate = Candidate(shift, true);
+                if (InputRangeV * candidate.multiplier + candidate.bias >
+                    std::numeric_limits<std::uint32_t>::max()) {
+                    break;
+                }
+                bool is_exact{true};
+                for (std::uint64_t input{}; input <= InputRangeV && is_exact; ++input) {
+                    is_exact =
+                        ((input * candidate.multiplier + candidate.bias) >> shift) == Reference(input);
+                }
+                if (is_exact) {
+                    return candidate;
+                }
+            }
+        }
+        /* Approximation error stays below the distance to the next rounding boundary. */
+        const std::uint64_t input_range{InputRangeV};
+        const auto bound = (RoundingV == __ScaleRounding::Nearest) ?
+            2 * input_range * input_range : input_range * input_range;
+        return Candidate(static_cast<unsigned>(std::bit_width(bound)), false);
+    }
+
+    static constexpr __Coefficients s_coefficients{Select()};
+
+    static_assert(
+        s_coefficients.is_narrow ||
+        std::bit_width(std::uint64_t{OutputRangeV}) + s_coefficients.shift < 63,
+        "Scaling range too large for 64-bit fixed-point arithmetic"
+    );
+
+public:
+    /** @brief Fixed-point multiplier. */
+    static constexpr std::uint64_t multiplier{s_coefficients.multiplier};
+
+    /** @brief Right shift applied after multiplication. */
+    static constexpr unsigned shift{s_coefficients.shift};
+
+    /** @brief Whether the computation fits in 32-bit arithmetic. */
+    static constexpr bool is_narrow{s_coefficients.is_narrow};
+
+    /**
+     * @brief Scale an input value.
+     *
+     * @param input     Input value in [0, InputRangeV], larger values are clamped.
+     *
+     * @returns Scaled value in [0, OutputRangeV].
+     */
+    [[nodiscard]]
+    static constexpr std::uint32_t Apply(std::uint32_t input) noexcept
+    {
+        input = std::min(input, InputRangeV);
+        if constexpr (is_narrow) {
+            return (input * static_cast<std::uint32_t>(multiplier) +
+                    static_cast<std::uint32_t>(s_coefficients.bias)) >> shift;
+        } else {
+            return static_cast<std::uint32_t>(
+                (input * multiplier + s_coefficients.bias) >> shift
+            );
+        }
+    }
+};
+
+/**
+ * @class __FixedPointScale, A fixed-point affine scaling engine with coefficients set at runtime.
+ *
+ * Computes `floor(x * slope + offset)` with integer multiply and shift only:
+ * `(x * multiplier + bias) >> shift`. Unlike __LinearScale, the coefficients
+ * may depend on runtime configuration (e.g., a timer period read from its handle).
+ * They are converted once on construction, and each Apply() call is free of
+ * floating-point arithmetic.
+ *
+ * The shift is chosen as large as possible for 64-bit arithmetic over
+ * [0, input_max], so the approximation error is far below one output step
+ * for all practical ranges. Multiplier and bias are rounded up with a small
+ * margin, so exact integer results are never truncated to the value below.
+ *
+ * @note Results below zero saturate to 0.
+ * @note This is an internal class. Do not use directly in application code.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * // Map [0, 180] to [500, 2400] timer counts
+ * const __Internal::__FixedPointScale scale{1900. / 180., 500., 180};
+ * auto counts = scale.Apply(90); // 1450
+ * @endcode
+ */
+class __FixedPointScale {
+public:
+
+    /**
+     * @brief Construct a zero scale, Apply() returns 0.
+     */
+    constexpr __FixedPointScale() noexcept = default;
+
+    /**
+     * @brief Construct __FixedPointScale class.
+     *
+     * @param slope         Output change per input step (must be >= 0).
+     * @param offset        Output value at input 0.
+     * @param input_max     Largest input passed to Apply().
+     */
+    __FixedPointScale(double slope, double offset, std::uint32_t input_max) noexcept
+    {
+        const double bound{std::max(1., std::abs(offset) + slope * input_max)};
+        m_shift = static_cast<unsigned>(
+            62 - std::bit_width(static_cast<std::uint64_t>(std::ceil(bound)))
+        );
+        m_multiplier = static_cast<std::uint64_t>(std::ceil(std::ldexp(slope, static_cast<int>(m_shift))));
+        /* Margin above the rounding error of the double coefficients, keeps exact results exact. */
+        const double margin{std::ldexp(bound, -46)};
+        m_bias = static_cast<std::int64_t>(std::ceil(std::ldexp(offset + margin, static_cast<int>(m_shift))));
+    }
+
+    /**
+     * @brief Scale an input value.
+     *
+     * @param input     Input value in [0, input_max].
+     *
+     * @returns Scaled value rounded toward negative infinity, saturated to 0.
+     */
+    [[nodiscard]]
+    constexpr std::uint32_t Apply(std::uint32_t input) const noexcept
+    {
+        const std::int64_t value{static_cast<std::int64_t>(input * m_multiplier) + m_bias};
+        return (value <= 0) ? 0 : static_cast<std::uint32_t>(value >> m_shift);
+    }
+
+private:
+    std::uint64_t m_multiplier{};
+    std::int64_t m_bias{};
+    unsigned m_shift{};
+};
+
+} /* namespace __Internal */
+
+} /* namespace STM32 */
+
+#endif /* STM32_LINEAR_SCALE_HPP */
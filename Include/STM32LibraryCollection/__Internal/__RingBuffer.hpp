@@ -0,0 +1,337 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_RING_BUFFER_HPP
+#define STM32_RING_BUFFER_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+namespace STM32 {
+
+namespace __Internal {
+
+/**
+ * @struct __RingBufferSpans, Up to two contiguous regions of a ring buffer.
+ *
+ * A ring buffer region may wrap around the end of the storage. In that case it is
+ * described by two spans: `first` up to the end of the storage and `second` from
+ * the start of the storage. When the region does not wrap, `second` is empty.
+ *
+ * @tparam T        Element type of the spans (const-qualified for readable regions).
+ *
+ * @note This is an internal struct. Do not use directly in application code.
+ */
+template <typename T>
+struct __RingBufferSpans {
+    std::span<T> first{};
+    std::span<T> second{};
+
+    /**
+     * @returns Total number of elements in both spans.
+     */
+    [[nodiscard]]
+    constexpr std::size_t Size() const noexcept
+    {
+        return first.size() + second.size();
+    }
+};
+
+/**
+ * @class __RingBuffer, A lock-free single-producer/single-consumer ring buffer.
+ *
+ * Fixed-capacity FIFO without heap allocation, safe to share between one producer
+ * and one consumer running in different contexts (e.g., main loop and ISR) without
+ * critical sections. Uses free-running head/tail indices, so all `Capacity` slots
+ * are usable and wraparound is handled by unsigned arithmetic.
+ *
+ * Besides element-wise Push()/Pop() and bulk Write()/Read() copies, the buffer
+ * exposes its free and filled regions as two contiguous spans, so a DMA controller
+ * or HAL call can write into / read from the storage directly:
+ * - Producer: WritableSpans() -> fill -> CommitWrite(count).
+ * - Consumer: ReadableSpans() -> process -> CommitRead(count).
+ *
+ * @tparam T            Element type (must be trivially copyable).
+ * @tparam CapacityV    Number of elements (must be a power of two).
+ *
+ * @note Only load/store atomics are used, so it is lock-free on Cortex-M0 as well.
+ * @note Producer-side members: Push, Write, WritableSpans, CommitWrite.
+ *       Consumer-side members: Pop, Read, Front, ReadableSpans, CommitRead, Clear.
+ * @note This is an internal class. Do not use directly in application code.
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * __Internal::__RingBuffer<std::uint8_t, 256> ring{};
+ *
+ * // Producer (e.g., ISR)
+ * ring.Push(0x42);
+ *
+ * // Consumer (e.g., main loop)
+ * std::uint8_t byte{};
+ * while (ring.Pop(byte)) {
+ *     process(byte);
+ * }
+ *
+ * // Zero-copy consumer: hand filled regions to a DMA transfer
+ * auto readable = ring.ReadableSpans();
+ * transmit(readable.first);
+ * ring.CommitRead(readable.first.size());
+ * @endcode
+ */
+template <typename T, std::size_t CapacityV>
+class __RingBuffer {
+    static_assert(
+        std::has_single_bit(CapacityV),
+        "Capacity must be a power of two"
+    );
+    static_assert(
+        std::is_trivially_copyable_v<T>,
+        "Ring buffer elements must be trivially copyable"
+    );
+public:
+    using ValueTypeT = T;
+    static constexpr std::size_t capacity{CapacityV};
+
+    /**
+     * @returns Maximum number of stored elements.
+     */
+    [[nodiscard]]
+    static constexpr std::size_t Capacity() noexcept
+    {
+        return capacity;
+    }
+
+    /**
+     * @returns Number of stored elements.
+     */
+    [[nodiscard]]
+    std::size_t Size() const noexcept
+    {
+        return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @returns Number of free slots.
+     */
+    [[nodiscard]]
+    std::size_t Free() const noexcept
+    {
+        return capacity - Size();
+    }
+
+    /**
+     * @returns True if no element is stored.
+     */
+    [[nodiscard]]
+    bool IsEmpty() const noexcept
+    {
+        return Size() == 0;
+    }
+
+    /**
+     * @returns True if no more elements can be stored.
+     */
+    [[nodiscard]]
+    bool IsFull() const noexcept
+    {
+        return Size() >= capacity;
+    }
+
+    /* ======================== Producer Operations ======================== */
+
+    /**
+     * @brief Append one element.
+     *
+     * @param value     Element to append.
+     *
+     * @returns True on success, false if the buffer is full.
+     */
+    bool Push(const T& value) noexcept
+    {
+        const auto head = m_head.load(std::memory_order_relaxed);
+        if (head - m_tail.load(std::memory_order_acquire) >= capacity) {
+            return false;
+        }
+        m_storage[head & s_index_mask] = value;
+        m_head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Append as many elements of data as fit.
+     *
+     * @param data      Elements to append.
+     *
+     * @returns Number of elements appended.
+     */
+    std::size_t Write(std::span<const T> data) noexcept
+    {
+        auto writable = WritableSpans();
+        const auto first_count = std::min(data.size(), writable.first.size());
+        const auto second_count = std::min(data.size() - first_count, writable.second.size());
+        std::ranges::copy(data.first(first_count), writable.first.begin());
+        std::ranges::copy(data.subspan(first_count, second_count), writable.second.begin());
+        CommitWrite(first_count + second_count);
+        return first_count + second_count;
+    }
+
+    /**
+     * @brief Get the free regions of the storage for in-place writing.
+     *
+     * @returns Free regions in write order.
+     *
+     * @note Call CommitWrite() to publish the written elements.
+     */
+    [[nodiscard]]
+    __RingBufferSpans<T> WritableSpans() noexcept
+    {
+        const auto head = m_head.load(std::memory_order_relaxed);
+        const auto free = capacity - (head - m_tail.load(std::memory_order_acquire));
+        const auto index = head & s_index_mask;
+        const auto first_size = std::min(free, capacity - index);
+        return {
+            std::span<T>{m_storage}.subspan(index, first_size),
+            std::span<T>{m_storage}.first(free - first_size)
+        };
+    }
+
+    /**
+     * @brief Publish elements written through WritableSpans().
+     *
+     * @param count     Number of elements written, must not exceed the writable size.
+     */
+    void CommitWrite(std::size_t count) noexcept
+    {
+        m_head.store(m_head.load(std::memory_order_relaxed) + count, std::memory_order_release);
+    }
+
+    /* ======================== Consumer Operations ======================== */
+
+    /**
+     * @brief Remove the oldest element.
+     *
+     * @param value     Destination of the removed element.
+     *
+     * @returns True on success, false if the buffer is empty.
+     */
+    bool Pop(T& value) noexcept
+    {
+        const auto tail = m_tail.load(std::memory_order_relaxed);
+        if (m_head.load(std::memory_order_acquire) == tail) {
+            return false;
+        }
+        value = m_storage[tail & s_index_mask];
+        m_tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Remove as many elements as fit into data.
+     *
+     * @param data      Destination of the removed elements.
+     *
+     * @returns Number of elements removed.
+     */
+    std::size_t Read(std::span<T> data) noexcept
+    {
+        const auto readable = ReadableSpans();
+        const auto first_count = std::min(data.size(), readable.first.size());
+        const auto second_count = std::min(data.size() - first_count, readable.second.size());
+        std::ranges::copy(readable.first.first(first_count), data.begin());
+        std::ranges::copy(readable.second.first(second_count), data.begin() + first_count);
+        CommitRead(first_count + second_count);
+        return first_count + second_count;
+    }
+
+    /**
+     * @returns Reference to the oldest element.
+     *
+     * @warning The buffer must not be empty.
+     */
+    [[nodiscard]]
+    const T& Front() const noexcept
+    {
+        return m_storage[m_tail.load(std::memory_order_relaxed) & s_index_mask];
+    }
+
+    /**
+     * @brief Get the filled regions of the storage for in-place reading.
+     *
+     * @returns Filled regions in FIFO order.
+     *
+     * @note Call CommitRead() to release the consumed elements.
+     */
+    [[nodiscard]]
+    __RingBufferSpans<const T> ReadableSpans() const noexcept
+    {
+        const auto tail = m_tail.load(std::memory_order_relaxed);
+        const auto size = m_head.load(std::memory_order_acquire) - tail;
+        const auto index = tail & s_index_mask;
+        const auto first_size = std::min(size, capacity - index);
+        return {
+            std::span<const T>{m_storage}.subspan(index, first_size),
+            std::span<const T>{m_storage}.first(size - first_size)
+        };
+    }
+
+    /**
+     * @brief Release elements consumed through ReadableSpans() or Front().
+     *
+     * @param count     Number of elements consumed, must not exceed the readable size.
+     */
+    void CommitRead(std::size_t count) noexcept
+    {
+        m_tail.store(m_tail.load(std::memory_order_relaxed) + count, std::memory_order_release);
+    }
+
+    /**
+     * @brief Drop all stored elements.
+     */
+    void Clear() noexcept
+    {
+        m_tail.store(m_head.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+private:
+    std::array<T, CapacityV> m_storage{};
+    std::atomic<std::size_t> m_head{};
+    std::atomic<std::size_t> m_tail{};
+
+    static constexpr std::size_t s_index_mask{CapacityV - 1};
+};
+
+/**
+ * @brief __IsRingBuffer, A concept to check if a type satisfies the RingBuffer interface.
+ *
+ * A type satisfies this concept if it provides:
+ * - `capacity`: A static constexpr power-of-two element count.
+ * - `ValueTypeT`: A type alias for the element type.
+ *
+ * @tparam T        Type to be checked.
+ *
+ * @note This is an internal concept. Do not use directly in application code.
+ */
+template <typename T>
+concept __IsRingBuffer =
+    std::same_as<std::remove_cv_t<decltype(T::capacity)>, std::size_t> &&
+    std::has_single_bit(T::capacity) &&
+    requires (T& ring, const typename T::ValueTypeT& value) {
+        typename T::ValueTypeT;
+        { ring.Push(value) } -> std::same_as<bool>;
+        { ring.WritableSpans() };
+        { ring.ReadableSpans() };
+        ring.CommitWrite(std::size_t{});
+        ring.CommitRead(std::size_t{});
+    };
+
+} /* namespace __Internal */
+
+} /* namespace STM32 */
+
+#endif /* STM32_RING_BUFFER_HPP */
@@ -11,9 +11,15 @@
  * This header provides a convenient single include for all internal utilities:
  * - __CallbackManager: Self-registering RAII callback manager for HAL peripherals.
  * - __Constant: Compile-time constant value wrapper.
+ * - __CriticalSection: Scoped interrupt masking guard.
+ * - __FixedPointScale: Fixed-point affine scaling engine with runtime coefficients.
  * - __InplaceFunction: Non-allocating callable wrapper for embedded systems.
+ * - __InstanceCallbackManager: Callback manager with per-instance storage and O(1) dispatch.
+ * - __Instrumentation: DWT cycle counter probes of peripheral operations.
+ * - __LinearScale: Compile-time fixed-point linear scaling engine.
  * - __Message: Message buffer concept and size clamping utility.
  * - __Range: Compile-time numeric range definition.
+ * - __RingBuffer: Lock-free single-producer/single-consumer ring buffer.
  * - __UniqueTag: Unique type generation for template differentiation.
  * 
  * @note These are internal utilities. Application code should not include
@@ -22,9 +28,13 @@
 
 #include "__CallbackManager.hpp"
 #include "__Constant.hpp"
+#include "__CriticalSection.hpp"
 #include "__InplaceFunction.hpp"
+#include "__Instrumentation.hpp"
+#include "__LinearScale.hpp"
 #include "__Message.hpp"
 #include "__Range.hpp"
+#include "__RingBuffer.hpp"
 #include "__UniqueTag.hpp"
 
 #endif /* STM32_UTILITY_HPP */
@@ -0,0 +1,91 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_BENCHMARKS_BENCHMARK_HPP
+#define STM32_BENCHMARKS_BENCHMARK_HPP
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace STM32::Benchmarks {
+
+/**
+ * @brief IsBenchmarkClock, A concept to check if a type is a benchmark time source.
+ *
+ * A clock provides an unsigned TickT, Now() and the unit name of a tick.
+ * Differences are taken in TickT, so a wrapping 32-bit counter (e.g., DWT CYCCNT) is fine.
+ *
+ * @tparam T        Type to be checked.
+ */
+template <typename T>
+concept IsBenchmarkClock =
+    std::unsigned_integral<typename T::TickT> &&
+    requires {
+        { T::Now() } -> std::same_as<typename T::TickT>;
+        { T::unit } -> std::convertible_to<std::string_view>;
+    };
+
+/**
+ * @struct Result, Outcome of one benchmark.
+ */
+struct Result {
+    std::string_view name;
+    std::string_view unit;
+    std::size_t iterations;
+    std::size_t bytes;
+    std::uint64_t ticks;
+};
+
+/**
+ * @struct Check, Outcome of one regression check.
+ */
+struct Check {
+    std::string_view name;
+    bool is_passed;
+};
+
+/**
+ * @brief Keep a value observable, so the work producing it is not optimized away.
+ *
+ * @param value     Result of the measured work.
+ */
+template <std::integral T>
+inline void DoNotOptimize(T value) noexcept
+{
+    asm volatile("" : : "r"(value) : "memory");
+}
+
+/**
+ * @brief Run a piece of work repeatedly and measure it.
+ *
+ * @tparam ClockT               Time source (see IsBenchmarkClock).
+ *
+ * @param name                  Name of the benchmark.
+ * @param iterations            Number of measured calls of work.
+ * @param bytes_per_iteration   Bytes processed per call, 0 if not a throughput benchmark.
+ * @param work                  Work to be measured, called once more before measuring.
+ *
+ * @returns Result of the benchmark.
+ */
+template <IsBenchmarkClock ClockT>
+Result Measure(
+    std::string_view name,
+    std::size_t iterations,
+    std::size_t bytes_per_iteration,
+    std::invocable auto&& work
+)
+{
+    work();
+    const auto start = ClockT::Now();
+    for (std::size_t iteration = 0; iteration < iterations; ++iteration) {
+        work();
+    }
+    const typename ClockT::TickT elapsed = ClockT::Now() - start;
+    return {name, ClockT::unit, iterations, iterations * bytes_per_iteration, elapsed};
+}
+
+} /* namespace STM32::Benchmarks */
+
+#endif /* STM32_BENCHMARKS_BENCHMARK_HPP */
@@ -0,0 +1,69 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+/**
+ * @file Host.cpp
+ * @brief Host runner of the benchmark suite, compiled against the mock main.h.
+ *
+ * Usage: STM32LibraryCollectionBenchmarks [--check]
+ * - Without arguments, runs the regression checks and the benchmarks.
+ * - With --check, runs the regression checks only (used by ctest).
+ *
+ * Returns a non-zero exit code if a regression check fails.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string_view>
+
+#include "Suite.hpp"
+
+namespace {
+
+/**
+ * @struct SteadyClock, Nanosecond host time source.
+ */
+struct SteadyClock {
+    using TickT = std::uint64_t;
+
+    static constexpr std::string_view unit{"ns"};
+
+    static TickT Now() noexcept
+    {
+        return static_cast<TickT>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count());
+    }
+};
+
+} /* namespace */
+
+int main(int argc, char** argv)
+{
+    const bool is_check_only{argc > 1 && std::string_view{argv[1]} == "--check"};
+
+    const bool is_passed = STM32::Benchmarks::RunChecks([](const STM32::Benchmarks::Check& check){
+        std::printf("[%s] %.*s\n",
+            check.is_passed ? " OK " : "FAIL",
+            static_cast<int>(check.name.size()), check.name.data()
+        );
+    });
+
+    if (!is_check_only) {
+        std::printf("\n%-32s %14s %12s\n", "Benchmark", "per call", "MB/s");
+        STM32::Benchmarks::RunBenchmarks<SteadyClock>(1'000, [](const STM32::Benchmarks::Result& result){
+            const double per_call{static_cast<double>(result.ticks) / static_cast<double>(result.iterations)};
+            std::printf("%-32.*s %11.2f %.*s",
+                static_cast<int>(result.name.size()), result.name.data(),
+                per_call, static_cast<int>(result.unit.size()), result.unit.data()
+            );
+            if (result.bytes != 0) {
+                std::printf(" %12.1f", static_cast<double>(result.bytes) * 1'000. / static_cast<double>(result.ticks));
+            }
+            std::printf("\n");
+        });
+    }
+
+    return is_passed ? 0 : 1;
+}
@@ -0,0 +1,57 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+/**
+ * @file main.h
+ * @brief Minimal host stand-in for the CubeMX main.h.
+ *
+ * Provides just enough of CMSIS and the HAL for the benchmarked headers to
+ * compile on the host. Interrupt masking is a no-op and the ADC reads a
+ * deterministic pseudo-random sequence.
+ */
+
+#ifndef STM32_BENCHMARKS_MOCK_MAIN_H
+#define STM32_BENCHMARKS_MOCK_MAIN_H
+
+#include <cstdint>
+
+/* CMSIS core */
+
+inline std::uint32_t __get_PRIMASK(void) { return 0; }
+inline void __set_PRIMASK(std::uint32_t) {}
+inline void __disable_irq(void) {}
+inline void __enable_irq(void) {}
+inline void __WFI(void) {}
+
+/* CubeMX */
+
+inline void Error_Handler(void) {}
+
+/* HAL common */
+
+typedef enum {
+    HAL_OK = 0x00U,
+    HAL_ERROR = 0x01U,
+    HAL_BUSY = 0x02U,
+    HAL_TIMEOUT = 0x03U
+} HAL_StatusTypeDef;
+
+/* HAL ADC */
+
+#define HAL_ADC_MODULE_ENABLED
+
+typedef struct {
+    std::uint32_t state;
+} ADC_HandleTypeDef;
+
+inline HAL_StatusTypeDef HAL_ADC_Start(ADC_HandleTypeDef*) { return HAL_OK; }
+inline HAL_StatusTypeDef HAL_ADC_Stop(ADC_HandleTypeDef*) { return HAL_OK; }
+inline HAL_StatusTypeDef HAL_ADC_PollForConversion(ADC_HandleTypeDef*, std::uint32_t) { return HAL_OK; }
+
+inline std::uint32_t HAL_ADC_GetValue(ADC_HandleTypeDef* handle)
+{
+    handle->state = handle->state * 1664525U + 1013904223U;
+    return handle->state >> 20; /* 12-bit sample */
+}
+
+#endif /* STM32_BENCHMARKS_MOCK_MAIN_H */
@@ -0,0 +1,219 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_BENCHMARKS_SUITE_HPP
+#define STM32_BENCHMARKS_SUITE_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include <STM32LibraryCollection/Adc.hpp>
+#include <STM32LibraryCollection/Crc16.hpp>
+#include <STM32LibraryCollection/__Internal/__LinearScale.hpp>
+
+#include "Benchmark.hpp"
+
+/**
+ * @file Suite.hpp
+ * @brief Benchmarks and regression checks of the library hot paths, shared by host and target.
+ *
+ * - CRC-16: every software engine over a 1 KiB block.
+ * - Filters: median networks of Adc::Get() and the running median window.
+ * - Scaling: __LinearScale and __FixedPointScale against the floating-point conversion they replaced.
+ *
+ * The checks compare the engines with each other, with published check values
+ * and with exact reference arithmetic, so an optimization cannot change a result unnoticed.
+ */
+
+namespace STM32::Benchmarks {
+
+namespace __Internal {
+
+inline constexpr std::size_t __block_size{1'024};
+
+/**
+ * @returns Deterministic pseudo-random bytes (xorshift32).
+ */
+inline const std::array<std::uint8_t, __block_size>& __Block() noexcept
+{
+    static const auto block = [](){
+        std::array<std::uint8_t, __block_size> bytes{};
+        std::uint32_t state{0x1234'5678};
+        for (auto& byte : bytes) {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            byte = static_cast<std::uint8_t>(state);
+        }
+        return bytes;
+    }();
+    return block;
+}
+
+/**
+ * @returns 12-bit sample i of the pseudo-random block.
+ */
+inline std::uint16_t __Sample(std::size_t index) noexcept
+{
+    const auto& block = __Block();
+    const auto low = block[(2 * index) % __block_size];
+    const auto high = block[(2 * index + 1) % __block_size];
+    return static_cast<std::uint16_t>(((high << 8) | low) & 0x0FFF);
+}
+
+/**
+ * @brief Measure one Crc16 variant over the block.
+ */
+template <IsBenchmarkClock ClockT, typename Crc16T>
+Result __MeasureCrc16(std::string_view name, std::size_t iterations)
+{
+    return Measure<ClockT>(name, iterations, __block_size, [](){
+        DoNotOptimize(Crc16T::Calculate(__Block()));
+    });
+}
+
+/**
+ * @brief Measure __Median over windows of the sample sequence.
+ */
+template <IsBenchmarkClock ClockT, std::size_t SizeV>
+Result __MeasureMedian(std::string_view name, std::size_t iterations)
+{
+    return Measure<ClockT>(name, iterations, 0, [offset = std::size_t{}]() mutable {
+        std::array<std::uint16_t, SizeV> window{};
+        for (auto& sample : window) {
+            sample = __Sample(offset++);
+        }
+        DoNotOptimize(STM32::__Internal::__Median(window, SizeV));
+    });
+}
+
+} /* namespace __Internal */
+
+/**
+ * @brief Run all benchmarks.
+ *
+ * @tparam ClockT       Time source (see IsBenchmarkClock).
+ *
+ * @param scale         Iteration multiplier, e.g., 100 on the host and 1 on a target.
+ * @param report        Callable taking each Result.
+ */
+template <IsBenchmarkClock ClockT>
+void RunBenchmarks(std::size_t scale, std::invocable<const Result&> auto&& report)
+{
+    using namespace __Internal;
+    using Modbus = Crc16Modbus;
+
+    report(__MeasureCrc16<ClockT, Modbus::WithEngine<Crc16Engine::Bitwise>>("Crc16Modbus/Bitwise", 2 * scale));
+    report(__MeasureCrc16<ClockT, Modbus::WithEngine<Crc16Engine::Nibble>>("Crc16Modbus/Nibble", 4 * scale));
+    report(__MeasureCrc16<ClockT, Modbus::WithEngine<Crc16Engine::Table>>("Crc16Modbus/Table", 10 * scale));
+    report(__MeasureCrc16<ClockT, Modbus::WithEngine<Crc16Engine::SliceBy4>>("Crc16Modbus/SliceBy4", 10 * scale));
+    report(__MeasureCrc16<ClockT, Modbus::WithEngine<Crc16Engine::SliceBy8>>("Crc16Modbus/SliceBy8", 10 * scale));
+    report(__MeasureCrc16<ClockT, Crc16CcittFalse::WithEngine<Crc16Engine::SliceBy8>>("Crc16CcittFalse/SliceBy8", 10 * scale));
+
+    report(__MeasureMedian<ClockT, 5>("Median/5", 1'000 * scale));
+    report(__MeasureMedian<ClockT, 9>("Median/9", 1'000 * scale));
+    report(__MeasureMedian<ClockT, 15>("Median/15 (nth_element)", 1'000 * scale));
+    report(Measure<ClockT>("RunningMedian/9", 1'000 * scale, 0,
+        [filter = STM32::__Internal::__RunningMedian<9>{}, offset = std::size_t{}]() mutable {
+            DoNotOptimize(filter.Update(__Sample(offset++)));
+        }
+    ));
+
+    report(Measure<ClockT>("LinearScale/4095->100", 1'000 * scale, 0, [offset = std::size_t{}]() mutable {
+        DoNotOptimize(STM32::__Internal::__LinearScale<4'095, 100>::Apply(__Sample(offset++)));
+    }));
+    report(Measure<ClockT>("FixedPointScale/servo", 1'000 * scale, 0,
+        [servo_scale = STM32::__Internal::__FixedPointScale{1'900. / 4'095., 500., 4'095}, offset = std::size_t{}]() mutable {
+            DoNotOptimize(servo_scale.Apply(__Sample(offset++)));
+        }
+    ));
+    report(Measure<ClockT>("DoubleScale/servo (baseline)", 1'000 * scale, 0,
+        [slope = 1'900. / 4'095., offset = std::size_t{}]() mutable {
+            DoNotOptimize(static_cast<std::uint32_t>(__Sample(offset++) * slope + 500.));
+        }
+    ));
+}
+
+/**
+ * @brief Run all regression checks.
+ *
+ * @param report        Callable taking each Check.
+ *
+ * @returns True if all checks passed.
+ */
+inline bool RunChecks(std::invocable<const Check&> auto&& report)
+{
+    using namespace __Internal;
+    bool is_passed{true};
+    const auto check = [&](std::string_view name, bool result){
+        report(Check{name, result});
+        is_passed = is_passed && result;
+    };
+
+    static constexpr std::array<std::uint8_t, 9> check_input{'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    check("Crc16CcittFalse check value", Crc16CcittFalse::Calculate(check_input) == 0x29B1);
+    check("Crc16Xmodem check value", Crc16Xmodem::Calculate(check_input) == 0x31C3);
+    check("Crc16Kermit check value", Crc16Kermit::Calculate(check_input) == 0x2189);
+    check("Crc16X25 check value", Crc16X25::Calculate(check_input) == 0x906E);
+    check("Crc16Modbus check value", Crc16Modbus::Calculate(check_input) == 0x4B37);
+
+    const auto engines_agree = []<typename Crc16T>(){
+        const auto expected = Crc16T::template WithEngine<Crc16Engine::Bitwise>::Calculate(__Block());
+        return Crc16T::template WithEngine<Crc16Engine::Nibble>::Calculate(__Block()) == expected &&
+               Crc16T::template WithEngine<Crc16Engine::Table>::Calculate(__Block()) == expected &&
+               Crc16T::template WithEngine<Crc16Engine::SliceBy4>::Calculate(__Block()) == expected &&
+               Crc16T::template WithEngine<Crc16Engine::SliceBy8>::Calculate(__Block()) == expected;
+    };
+    check("Crc16CcittFalse engines agree", engines_agree.template operator()<Crc16CcittFalse>());
+    check("Crc16Modbus engines agree", engines_agree.template operator()<Crc16Modbus>());
+
+    bool is_median_exact{true};
+    for (std::size_t offset = 0; offset < 512; ++offset) {
+        std::array<std::uint16_t, 9> window{};
+        for (std::size_t index = 0; index < window.size(); ++index) {
+            window[index] = __Sample(offset + index);
+        }
+        auto sorted = window;
+        std::ranges::sort(sorted);
+        is_median_exact = is_median_exact && (STM32::__Internal::__Median(window, window.size()) == sorted[4]);
+    }
+    check("Median/9 matches sort", is_median_exact);
+
+    bool is_running_median_exact{true};
+    STM32::__Internal::__RunningMedian<5> filter{};
+    std::array<std::uint16_t, 5> history{};
+    history.fill(__Sample(0));
+    for (std::size_t offset = 0; offset < 512; ++offset) {
+        history[offset % history.size()] = __Sample(offset);
+        auto sorted = history;
+        std::ranges::sort(sorted);
+        is_running_median_exact = is_running_median_exact && (filter.Update(__Sample(offset)) == sorted[2]);
+    }
+    check("RunningMedian/5 matches sort", is_running_median_exact);
+
+    bool is_linear_scale_exact{true};
+    for (std::uint32_t input = 0; input <= 4'095; ++input) {
+        const auto expected = static_cast<std::uint32_t>((input * 100 + 4'095 / 2) / 4'095);
+        is_linear_scale_exact = is_linear_scale_exact &&
+            (STM32::__Internal::__LinearScale<4'095, 100>::Apply(input) == expected);
+    }
+    check("LinearScale/4095->100 exact", is_linear_scale_exact);
+
+    bool is_fixed_point_scale_exact{true};
+    const STM32::__Internal::__FixedPointScale scale{1'900. / 180., 500., 180};
+    for (std::uint32_t input = 0; input <= 180; ++input) {
+        const auto expected = static_cast<std::uint32_t>(500 + (input * 1'900) / 180);
+        is_fixed_point_scale_exact = is_fixed_point_scale_exact && (scale.Apply(input) == expected);
+    }
+    check("FixedPointScale/servo exact", is_fixed_point_scale_exact);
+
+    return is_passed;
+}
+
+} /* namespace STM32::Benchmarks */
+
+#endif /* STM32_BENCHMARKS_SUITE_HPP */
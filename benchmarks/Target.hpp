@@ -0,0 +1,100 @@
+/* SPDX-FileCopyrightText: Copyright (c) 2022-2026 Oğuz Toraman <oguz.toraman@tutanota.com> */
+/* SPDX-License-Identifier: LGPL-3.0-only */
+
+#ifndef STM32_BENCHMARKS_TARGET_HPP
+#define STM32_BENCHMARKS_TARGET_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <span>
+#include <string_view>
+
+#include <STM32LibraryCollection/Uart.hpp>
+
+#include "Suite.hpp"
+
+/**
+ * @file Target.hpp
+ * @brief On-target runner of the benchmark suite, reports DWT cycle counts over a Uart.
+ *
+ * Not built by CMake: add the benchmarks directory to the include path of a firmware
+ * project (Cortex-M3 and above, with the real CubeMX main.h) and call RunOnTarget().
+ *
+ * @example Usage:
+ * @code {.cpp}
+ * #include "Target.hpp"
+ *
+ * STM32::Uart<STM32::WorkingMode::Blocking, STM32_UNIQUE_TAG> uart{huart2};
+ * STM32::Benchmarks::RunOnTarget(uart);    // Prints one line per check and benchmark
+ * @endcode
+ */
+
+#if !defined(DWT_CTRL_CYCCNTENA_Msk) /* module check */
+#error "Target benchmarks require a core with the DWT cycle counter (Cortex-M3 and above)!"
+#endif /* module check */
+
+namespace STM32::Benchmarks {
+
+/**
+ * @struct DwtClock, Core clock cycle time source.
+ */
+struct DwtClock {
+    using TickT = std::uint32_t;
+
+    static constexpr std::string_view unit{"cycles"};
+
+    static TickT Now() noexcept
+    {
+        return DWT->CYCCNT;
+    }
+};
+
+/**
+ * @brief Run the regression checks and the benchmarks, and report them line by line.
+ *
+ * @param uart      Uart to report with, blocking transmits are used.
+ * @param scale     Iteration multiplier (default is 1).
+ *
+ * @returns True if all checks passed.
+ *
+ * @note Interrupts stay enabled, run on an otherwise idle system for stable numbers.
+ */
+template <typename UartT>
+bool RunOnTarget(UartT& uart, std::size_t scale = 1)
+{
+    CoreDebug->DEMCR = CoreDebug->DEMCR | CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL = DWT->CTRL | DWT_CTRL_CYCCNTENA_Msk;
+
+    std::array<char, 96> line{};
+    const auto print = [&](int length){
+        if (length > 0) {
+            const auto size = std::min(static_cast<std::size_t>(length), line.size() - 1);
+            uart.template Transmit<WorkingMode::Blocking>(std::span<const char>{line.data(), size});
+        }
+    };
+
+    const bool is_passed = RunChecks([&](const Check& check){
+        print(std::snprintf(line.data(), line.size(), "[%s] %.*s\r\n",
+            check.is_passed ? " OK " : "FAIL",
+            static_cast<int>(check.name.size()), check.name.data()
+        ));
+    });
+
+    RunBenchmarks<DwtClock>(scale, [&](const Result& result){
+        const auto per_call = static_cast<unsigned long>(result.ticks / result.iterations);
+        const auto per_byte_x100 = (result.bytes != 0) ?
+            static_cast<unsigned long>(result.ticks * 100 / result.bytes) : 0UL;
+        print(std::snprintf(line.data(), line.size(), "%.*s: %lu cycles/call, %lu.%02lu cycles/byte\r\n",
+            static_cast<int>(result.name.size()), result.name.data(),
+            per_call, per_byte_x100 / 100, per_byte_x100 % 100
+        ));
+    });
+
+    return is_passed;
+}
+
+} /* namespace STM32::Benchmarks */
+
+#endif /* STM32_BENCHMARKS_TARGET_HPP */